@@ -0,0 +1,212 @@
+/**
+ * Created on October 19, 2026. Benchmark.h holds the
+ * timing, element-type, and output helpers shared by the
+ * BII benchmark programs in this directory.
+ *
+ * Every benchmark writes one JSON object per line to its
+ * output file (bench_output.txt unless another path is given
+ * on the command line) so runs can be diffed and tracked for
+ * regressions.
+ */
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+/**
+ * A 64-byte plain struct used as the "large trivially
+ * copyable" element type
+ */
+struct payload64 {
+    uint64_t words[8];
+
+    friend bool operator==(const payload64& left, const payload64& right) {
+        return std::memcmp(left.words, right.words, sizeof(left.words)) == 0;
+    }
+
+    friend bool operator!=(const payload64& left, const payload64& right) {
+        return !(left == right);
+    }
+};
+
+/**
+ * Builds the i-th test value for each benchmarked element type
+ */
+template <typename T>
+T makeValue(size_t i);
+
+template <>
+inline int makeValue<int>(size_t i) {
+    return static_cast<int>(i);
+}
+
+template <>
+inline std::string makeValue<std::string>(size_t i) {
+    // long enough to defeat the small string optimization
+    return "benchmark-element-" + std::to_string(i) + "-padding-padding";
+}
+
+template <>
+inline payload64 makeValue<payload64>(size_t i) {
+    payload64 value;
+    for (int w = 0; w < 8; w++) {
+        value.words[w] = i + w;
+    }
+    return value;
+}
+
+/**
+ * Name of each benchmarked element type as written to the
+ * output file
+ */
+template <typename T>
+const char* typeName();
+
+template <>
+inline const char* typeName<int>() { return "int"; }
+
+template <>
+inline const char* typeName<std::string>() { return "string"; }
+
+template <>
+inline const char* typeName<payload64>() { return "struct64"; }
+
+/**
+ * Reduces a value to something cheap to accumulate, so iteration
+ * benchmarks have to touch every element
+ */
+inline uint64_t digest(int value) { return static_cast<uint64_t>(value); }
+inline uint64_t digest(const std::string& value) { return value.size(); }
+inline uint64_t digest(const payload64& value) { return value.words[0]; }
+
+/**
+ * Keeps the compiler from discarding a computed value
+ */
+template <typename T>
+inline void keep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Number of repetitions for a benchmark over n elements, so
+ * small sizes are repeated until roughly a million element
+ * operations have been timed
+ */
+inline size_t repetitionsFor(size_t n) {
+    const size_t target = 1000000;
+    return n >= target ? 1 : target / n;
+}
+
+/**
+ * Times run(state) for the given number of repetitions, building
+ * a fresh state with setup() before each one. Setup time is not
+ * counted. Returns the mean nanoseconds per repetition.
+ */
+template <typename Setup, typename Run>
+double measure(size_t repetitions, Setup setup, Run run) {
+    using clock = std::chrono::steady_clock;
+    clock::duration total = clock::duration::zero();
+    for (size_t rep = 0; rep < repetitions; rep++) {
+        auto state = setup();
+        clock::time_point start = clock::now();
+        run(state);
+        total += clock::now() - start;
+    }
+    return std::chrono::duration<double, std::nano>(total).count() / repetitions;
+}
+
+/**
+ * Returns the sample below which the given fraction of the
+ * samples fall (0.5 for the median). Sorts the samples.
+ */
+inline double percentile(std::vector<double>& samples, double fraction) {
+    if (samples.empty()) return 0;
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(fraction * (samples.size() - 1) + 0.5);
+    return samples[index];
+}
+
+/**
+ * Writes benchmark results as JSON lines and echoes them to
+ * the console
+ */
+class benchWriter {
+public:
+    explicit benchWriter(const std::string& path) : _out(path) {
+        if (!_out) {
+            cout << "could not open " << path << endl;
+        }
+    }
+
+    /**
+     * Records one measurement. ops is the number of element
+     * operations performed by a single repetition.
+     */
+    void record(const char* suite, const char* operation, const char* container,
+                const char* type, size_t size, size_t ops, double nanoseconds) {
+        double perOp = ops ? nanoseconds / ops : nanoseconds;
+        _out << "{\"suite\":\"" << suite
+             << "\",\"operation\":\"" << operation
+             << "\",\"container\":\"" << container
+             << "\",\"type\":\"" << type
+             << "\",\"size\":" << size
+             << ",\"ops\":" << ops
+             << ",\"ns\":" << nanoseconds
+             << ",\"ns_per_op\":" << perOp << "}\n";
+        cout << suite << ' ' << operation << ' ' << container << '<' << type << "> n="
+             << size << " : " << perOp << " ns/op" << endl;
+    }
+
+    /**
+     * Records the latency distribution of one workload: heap
+     * allocations per operation and the 50th, 99th, and 99.9th
+     * percentile nanoseconds per operation
+     */
+    void recordLatency(const char* suite, const char* operation, const char* container,
+                       const char* type, size_t size, double allocsPerOp,
+                       double p50, double p99, double p999) {
+        _out << "{\"suite\":\"" << suite
+             << "\",\"operation\":\"" << operation
+             << "\",\"container\":\"" << container
+             << "\",\"type\":\"" << type
+             << "\",\"size\":" << size
+             << ",\"allocs_per_op\":" << allocsPerOp
+             << ",\"p50_ns\":" << p50
+             << ",\"p99_ns\":" << p99
+             << ",\"p999_ns\":" << p999 << "}\n";
+        cout << suite << ' ' << operation << ' ' << container << '<' << type << "> n="
+             << size << " : " << allocsPerOp << " allocs/op, p50 " << p50
+             << " p99 " << p99 << " p99.9 " << p999 << " ns/op" << endl;
+    }
+
+private:
+    /* the output file */
+    std::ofstream _out;
+};
+
+/**
+ * Asks the user for the largest power of ten to benchmark,
+ * defaulting to the given exponent
+ */
+inline int askMaxExponent(int fallback, int limit) {
+    std::string response;
+    cout << "Largest size as a power of ten, 1-" << limit
+         << " (enter/return for 10^" << fallback << "): ";
+    std::getline(std::cin, response);
+    cout << endl;
+    if (response.empty()) {
+        return fallback;
+    }
+    int exponent = std::stoi(response);
+    if (exponent < 1) return 1;
+    if (exponent > limit) return limit;
+    return exponent;
+}
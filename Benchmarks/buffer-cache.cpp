@@ -0,0 +1,120 @@
+/**
+ * Created on October 19, 2026. Benchmarks the thread-local
+ * buffer cache behind Vector<T> on a request-handler workload:
+ * every request builds a few short-lived vectors, fills them
+ * with addBack, and drops them.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 -pthread buffer-cache.cpp -o buffer-cache
+ * and run as
+ *     ./buffer-cache [output file]
+ *
+ * This file turns the cache on itself. Each workload runs once
+ * with the default limit and once with a limit of zero, where
+ * every buffer goes straight back to malloc, on one thread and
+ * then on four at once. Requests run 10^3 up to the chosen power
+ * of ten (at most 10^7) times per thread. Results are written as
+ * JSON lines to bench_output.txt by default, and the hit rate of
+ * each cached run is printed.
+ */
+#define BII_BUFFER_CACHE
+#include "benchmark.h"
+#include "../Vector/vector.h"
+#include <thread>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // One thread
+const bool section_B = true; // Four threads
+
+/** The element counts of the vectors each request builds */
+const size_t requestSizes[] = {8, 40, 300, 2000};
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Handles the given number of requests, each building one
+ * vector of every size in requestSizes
+ */
+template <typename T>
+void handleRequests(const std::vector<T>& values, size_t requests, size_t limit) {
+    bufferCache::limit(limit);
+    for (size_t request = 0; request < requests; request++) {
+        for (size_t count : requestSizes) {
+            Vector<T> scratch;
+            for (size_t i = 0; i < count; i++) {
+                scratch.addBack(values[(request + i) % values.size()]);
+            }
+            keep(scratch.back());
+        }
+    }
+}
+
+/**
+ * Runs the requests on the given number of threads, with the
+ * cache at its default limit (cached) or at zero (uncached)
+ */
+template <typename T>
+void requests(benchWriter& out, const std::vector<T>& values, size_t n, size_t threads, bool cached) {
+    size_t limit = cached ? bufferCache::defaultLimit : 0;
+    double hitRate = 0;
+    double ns = measure(1, [] { return 0; }, [&](int&) {
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < threads; t++) {
+            workers.emplace_back([&] { handleRequests(values, n, limit); });
+        }
+        bufferCache::resetStats();
+        handleRequests(values, n, limit);
+        hitRate = bufferCache::stats().hitRate();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+    bufferCache::limit(bufferCache::defaultLimit);
+    const char* operation = threads == 1 ? "requests-1-thread" : "requests-4-threads";
+    out.record("buffer-cache", operation, cached ? "Vector (cached)" : "Vector (uncached)", typeName<T>(), n, n, ns);
+    if (cached) {
+        cout << "  hit rate " << hitRate << endl;
+    }
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    std::vector<T> values;
+    for (size_t i = 0; i < 4096; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        if (section_A) {
+            requests(out, values, n, 1, true);
+            requests(out, values, n, 1, false);
+        }
+        if (section_B) {
+            requests(out, values, n, 4, true);
+            requests(out, values, n, 4, false);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Buffer Cache Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(5, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * Created on October 19, 2026. Benchmarks the throughput
+ * of the lock-free ConcurrentStack<T> against a Stack<T> and
+ * a std::stack guarded by a mutex, across thread counts.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 -pthread concurrent-stack.cpp -o concurrent-stack
+ * and run as
+ *     ./concurrent-stack [output file]
+ *
+ * Every thread performs the same number of operations, 10^3
+ * up to the chosen power of ten (at most 10^7), and the wall
+ * time of the whole run is recorded. Thread counts double from
+ * one up to the number of hardware threads. Results are written
+ * as JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Stack/stack.h"
+#include "../Stack/concurrent-stack.h"
+#include <mutex>
+#include <stack>
+#include <thread>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Push then pull (each thread pairs its operations)
+const bool section_B = true; // Producers and consumers (half the threads each)
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+/**
+ * A Stack<T> behind a mutex, the way it was shared before
+ * ConcurrentStack
+ */
+template <typename T>
+class lockedStack {
+public:
+    void push(const T& element) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _elements.push(element);
+    }
+
+    std::optional<T> pull() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_elements.empty()) return std::nullopt;
+        return _elements.pull();
+    }
+
+private:
+    std::mutex _mutex;
+    Stack<T> _elements;
+};
+
+/**
+ * A std::stack behind a mutex
+ */
+template <typename T>
+class lockedStdStack {
+public:
+    void push(const T& element) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _elements.push(element);
+    }
+
+    std::optional<T> pull() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_elements.empty()) return std::nullopt;
+        std::optional<T> top(std::move(_elements.top()));
+        _elements.pop();
+        return top;
+    }
+
+private:
+    std::mutex _mutex;
+    std::stack<T> _elements;
+};
+
+template <typename T>
+const char* containerName(const ConcurrentStack<T>&) { return "ConcurrentStack"; }
+
+template <typename T>
+const char* containerName(const lockedStack<T>&) { return "Stack+mutex"; }
+
+template <typename T>
+const char* containerName(const lockedStdStack<T>&) { return "std::stack+mutex"; }
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Starts the given number of threads running work(thread) at
+ * the same moment and returns the nanoseconds until all finish
+ */
+template <typename Work>
+double timeThreads(int threads, Work work) {
+    using clock = std::chrono::steady_clock;
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            ready++;
+            while (!go.load()) { }
+            work(t);
+        });
+    }
+    while (ready.load() < threads) { }
+    clock::time_point start = clock::now();
+    go.store(true);
+    for (std::thread& worker : workers) worker.join();
+    return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+}
+
+/**
+ * Every thread pushes an element and pulls one back, n times
+ */
+template <typename Container, typename T>
+void pushPull(benchWriter& out, const std::vector<T>& values, size_t n, int threads) {
+    Container stk;
+    double ns = timeThreads(threads, [&](int) {
+        for (size_t i = 0; i < n; i++) {
+            stk.push(values[i % values.size()]);
+            keep(stk.pull());
+        }
+    });
+    std::string operation = "push-pull-t" + std::to_string(threads);
+    out.record("concurrent-stack", operation.c_str(), containerName(stk), typeName<T>(), n,
+               2 * n * threads, ns);
+}
+
+/**
+ * Half the threads push n elements each while the other half
+ * pull until they have received as many
+ */
+template <typename Container, typename T>
+void producerConsumer(benchWriter& out, const std::vector<T>& values, size_t n, int threads) {
+    Container stk;
+    double ns = timeThreads(threads, [&](int t) {
+        if (t % 2 == 0) {
+            for (size_t i = 0; i < n; i++) {
+                stk.push(values[i % values.size()]);
+            }
+        } else {
+            for (size_t received = 0; received < n; ) {
+                if (std::optional<T> value = stk.pull()) {
+                    keep(*value);
+                    received++;
+                }
+            }
+        }
+    });
+    std::string operation = "producer-consumer-t" + std::to_string(threads);
+    out.record("concurrent-stack", operation.c_str(), containerName(stk), typeName<T>(), n,
+               n * threads, ns);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    std::vector<T> values;
+    for (size_t i = 0; i < 4096; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+    int hardware = std::thread::hardware_concurrency();
+    if (hardware < 2) hardware = 2;
+
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        for (int threads = 1; threads <= hardware; threads *= 2) {
+            if (section_A) {
+                pushPull<ConcurrentStack<T>>(out, values, n, threads);
+                pushPull<lockedStack<T>>(out, values, n, threads);
+                pushPull<lockedStdStack<T>>(out, values, n, threads);
+            }
+            if (section_B && threads > 1) {
+                producerConsumer<ConcurrentStack<T>>(out, values, n, threads);
+                producerConsumer<lockedStack<T>>(out, values, n, threads);
+                producerConsumer<lockedStdStack<T>>(out, values, n, threads);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Concurrent Stack Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(6, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
@@ -0,0 +1,247 @@
+/**
+ * Created on October 19, 2026. Comparative benchmarks
+ * for Vector<T> and Stack<T> against std::vector and
+ * std::stack.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 containers.cpp -o containers
+ * and run as
+ *     ./containers [output file]
+ *
+ * Every operation runs for sizes 10^1 up to the chosen power
+ * of ten (at most 10^8) and for int, string, and a 64-byte
+ * struct. Results are written as JSON lines to bench_output.txt
+ * by default.
+ */
+#include "benchmark.h"
+#include "../Vector/vector.h"
+#include "../Stack/stack.h"
+#include <memory>
+#include <stack>
+#include <utility>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Vector vs std::vector (8 Operations)
+const bool section_B = true; // Stack vs std::stack (2 Operations)
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+void pushBack(Vector<T>& vec, const T& value) { vec.addBack(value); }
+
+template <typename T>
+void pushBack(std::vector<T>& vec, const T& value) { vec.push_back(value); }
+
+template <typename T>
+void insertFront(Vector<T>& vec, const T& value) { vec.insert(value, vec.begin()); }
+
+template <typename T>
+void insertFront(std::vector<T>& vec, const T& value) { vec.insert(vec.begin(), value); }
+
+template <typename T>
+void removeFront(Vector<T>& vec) { vec.remove(vec.begin()); }
+
+template <typename T>
+void removeFront(std::vector<T>& vec) { vec.erase(vec.begin()); }
+
+template <typename T>
+void mergeInto(Vector<T>& vec, const Vector<T>& other) { vec.merge(other); }
+
+template <typename T>
+void mergeInto(std::vector<T>& vec, const std::vector<T>& other) {
+    vec.insert(vec.end(), other.begin(), other.end());
+}
+
+template <typename T>
+const char* containerName(const Vector<T>&) { return "Vector"; }
+
+template <typename T>
+const char* containerName(const std::vector<T>&) { return "std::vector"; }
+
+template <typename T>
+void push(Stack<T>& stk, const T& value) { stk.push(value); }
+
+template <typename T>
+void push(std::stack<T>& stk, const T& value) { stk.push(value); }
+
+template <typename T>
+void pull(Stack<T>& stk) { keep(stk.pull()); }
+
+template <typename T>
+void pull(std::stack<T>& stk) { keep(stk.top()); stk.pop(); }
+
+template <typename T>
+const char* containerName(const Stack<T>&) { return "Stack"; }
+
+template <typename T>
+const char* containerName(const std::stack<T>&) { return "std::stack"; }
+
+/**
+ * Number of insert/remove operations at the front of an
+ * n-element vector; each one is O(n), so large sizes do fewer
+ */
+size_t frontOpsFor(size_t n) {
+    size_t ops = 1000000 / n;
+    if (ops < 1) ops = 1;
+    if (ops > n) ops = n;
+    return ops;
+}
+
+/**
+ * Builds a container holding the first n given values
+ */
+template <typename Container, typename T>
+Container filled(const std::vector<T>& values, size_t n) {
+    Container container;
+    for (size_t i = 0; i < n; i++) {
+        pushBack(container, values[i]);
+    }
+    return container;
+}
+
+// Vector Benchmarks –––––––––––––––––––––––––––––––––––––
+
+/**
+ * Runs every vector operation for one container, element
+ * type, and size
+ */
+template <typename Container, typename T>
+void benchVector(benchWriter& out, const std::vector<T>& values, size_t n) {
+    const size_t reps = repetitionsFor(n);
+    const char* name = containerName(Container());
+    const char* type = typeName<T>();
+    const Container source = filled<Container>(values, n);
+    const Container sourceCopy = source;
+
+    double ns = measure(reps, [] { return Container(); }, [&](Container& vec) {
+        for (size_t i = 0; i < n; i++) {
+            pushBack(vec, values[i]);
+        }
+    });
+    out.record("vector", "addBack", name, type, n, n, ns);
+
+    const size_t frontOps = frontOpsFor(n);
+    ns = measure(frontOps == n ? reps : 1, [&] { return source; }, [&](Container& vec) {
+        for (size_t i = 0; i < frontOps; i++) {
+            insertFront(vec, values[i]);
+        }
+    });
+    out.record("vector", "insert", name, type, n, frontOps, ns);
+
+    ns = measure(frontOps == n ? reps : 1, [&] { return source; }, [&](Container& vec) {
+        for (size_t i = 0; i < frontOps; i++) {
+            removeFront(vec);
+        }
+    });
+    out.record("vector", "remove", name, type, n, frontOps, ns);
+
+    const size_t half = n / 2;
+    ns = measure(reps, [&] {
+        return std::make_pair(filled<Container>(values, half), filled<Container>(values, n - half));
+    }, [&](std::pair<Container, Container>& halves) {
+        mergeInto(halves.first, halves.second);
+    });
+    out.record("vector", "merge", name, type, n, n - half, ns);
+
+    ns = measure(reps, [] { return std::unique_ptr<Container>(); }, [&](std::unique_ptr<Container>& copy) {
+        copy.reset(new Container(source));
+    });
+    out.record("vector", "copy", name, type, n, n, ns);
+
+    ns = measure(reps, [&] {
+        return std::make_pair(std::unique_ptr<Container>(new Container(source)), std::unique_ptr<Container>());
+    }, [&](std::pair<std::unique_ptr<Container>, std::unique_ptr<Container>>& slots) {
+        slots.second.reset(new Container(std::move(*slots.first)));
+    });
+    out.record("vector", "move", name, type, n, 1, ns);
+
+    ns = measure(reps, [] { return 0; }, [&](int&) {
+        uint64_t sum = 0;
+        for (const T& value : source) {
+            sum += digest(value);
+        }
+        keep(sum);
+    });
+    out.record("vector", "iterate", name, type, n, n, ns);
+
+    ns = measure(reps, [] { return 0; }, [&](int&) {
+        keep(source == sourceCopy);
+    });
+    out.record("vector", "operator==", name, type, n, n, ns);
+}
+
+// Stack Benchmarks ––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Runs push and pull for one container, element type, and size
+ */
+template <typename Container, typename T>
+void benchStack(benchWriter& out, const std::vector<T>& values, size_t n) {
+    const size_t reps = repetitionsFor(n);
+    const char* name = containerName(Container());
+    const char* type = typeName<T>();
+
+    double ns = measure(reps, [] { return std::unique_ptr<Container>(new Container()); },
+                        [&](std::unique_ptr<Container>& stk) {
+        for (size_t i = 0; i < n; i++) {
+            push(*stk, values[i]);
+        }
+    });
+    out.record("stack", "push", name, type, n, n, ns);
+
+    ns = measure(reps, [&] {
+        std::unique_ptr<Container> stk(new Container());
+        for (size_t i = 0; i < n; i++) {
+            push(*stk, values[i]);
+        }
+        return stk;
+    }, [&](std::unique_ptr<Container>& stk) {
+        for (size_t i = 0; i < n; i++) {
+            pull(*stk);
+        }
+    });
+    out.record("stack", "pull", name, type, n, n, ns);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    for (size_t n = 10; n <= largest; n *= 10) {
+        if (section_A) {
+            benchVector<Vector<T>>(out, values, n);
+            benchVector<std::vector<T>>(out, values, n);
+        }
+        if (section_B) {
+            benchStack<Stack<T>>(out, values, n);
+            benchStack<std::stack<T>>(out, values, n);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Container Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(6, 8);
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+    benchType<payload64>(out, maxExponent);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * Created on October 19, 2026. Benchmarks comparing HashMap<K, V>
+ * with std::unordered_map at load factors from 0.5 to 0.9.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 hash-map.cpp -o hash-map
+ * and run as
+ *     ./hash-map [output file]
+ *
+ * For each table size (a power of two from 2^10 up to about the
+ * chosen power of ten, at most 10^8) the HashMap is reserved to
+ * exactly that many slots and filled to each load factor, so every
+ * run probes the same table at a different fullness. The
+ * unordered_map holds the same keys with room reserved for all of
+ * them; its buckets are chained, so the load factor only sets how
+ * many keys both tables hold. Results are written as JSON lines
+ * to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../HashMap/hash-map.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Insert into a reserved table
+const bool section_B = true; // Lookups of present keys
+const bool section_C = true; // Lookups of absent keys
+
+/** The load factors to fill each table to */
+const double loadFactors[] = {0.5, 0.6, 0.7, 0.8, 0.9};
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename K>
+struct hashMapAdapter {
+    HashMap<K, int> map;
+
+    hashMapAdapter(size_t slots, size_t count) {
+        // at 0.95 the smallest table that fits half or more of
+        // its slots is exactly the one asked for
+        map.maxLoadFactor(0.95);
+        map.reserve(count);
+        if (map.capacity() != slots) cout << "unexpected capacity " << map.capacity() << endl;
+    }
+
+    static const char* name() { return "HashMap"; }
+    void insert(const K& key, int value) { map.insert(key, value); }
+    bool contains(const K& key) const { return map.tryAt(key) != nullptr; }
+};
+
+template <typename K>
+struct unorderedMapAdapter {
+    std::unordered_map<K, int> map;
+
+    unorderedMapAdapter(size_t, size_t count) { map.reserve(count); }
+
+    static const char* name() { return "std::unordered_map"; }
+    void insert(const K& key, int value) { map.emplace(key, value); }
+    bool contains(const K& key) const { return map.find(key) != map.end(); }
+};
+
+/**
+ * The i-th key: distinct for distinct i and scattered,
+ * so neither table sees keys in hash order
+ */
+template <typename K>
+K keyAt(size_t i) {
+    return makeValue<K>((i * 2654435761u) & 0x7FFFFFFF);
+}
+
+/**
+ * Names an operation together with its load factor
+ */
+std::string labelled(const char* operation, double loadFactor) {
+    return std::string(operation) + "-lf" + std::to_string(loadFactor).substr(0, 3);
+}
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Inserts count keys into a table reserved for them
+ */
+template <typename Adapter, typename K>
+void insert(benchWriter& out, const std::vector<K>& keys, size_t slots, size_t count, double loadFactor) {
+    double ns = measure(repetitionsFor(count), [&] { return std::unique_ptr<Adapter>(new Adapter(slots, count)); },
+                        [&](std::unique_ptr<Adapter>& table) {
+        for (size_t i = 0; i < count; i++) {
+            table->insert(keys[i], static_cast<int>(i));
+        }
+    });
+    out.record("hash-map", labelled("insert", loadFactor).c_str(), Adapter::name(), typeName<K>(), slots, count, ns);
+}
+
+/**
+ * Looks up count keys in a table holding count keys, all of
+ * them present (hits) or all of them absent (misses)
+ */
+template <typename Adapter, typename K>
+void lookup(benchWriter& out, const std::vector<K>& keys, size_t slots, size_t count, double loadFactor, bool hits) {
+    Adapter table(slots, count);
+    for (size_t i = 0; i < count; i++) {
+        table.insert(keys[i], static_cast<int>(i));
+    }
+    // absent keys come from past the inserted ones
+    const size_t offset = hits ? 0 : count;
+    size_t found = 0;
+    double ns = measure(repetitionsFor(count), [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < count; i++) {
+            found += table.contains(keys[offset + (i * 7919) % count]);
+        }
+    });
+    keep(found);
+    out.record("hash-map", labelled(hits ? "lookup-hit" : "lookup-miss", loadFactor).c_str(), Adapter::name(),
+               typeName<K>(), slots, count, ns);
+}
+
+/**
+ * Runs every enabled section for one key type
+ */
+template <typename K>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    size_t slotLimit = 1024;
+    while (slotLimit * 2 <= largest) slotLimit *= 2;
+    std::vector<K> keys;
+    keys.reserve(2 * slotLimit);
+    for (size_t i = 0; i < 2 * slotLimit; i++) {
+        keys.push_back(keyAt<K>(i));
+    }
+
+    for (size_t slots = 1024; slots <= slotLimit; slots *= 8) {
+        for (double loadFactor : loadFactors) {
+            size_t count = static_cast<size_t>(slots * loadFactor);
+            if (section_A) {
+                insert<hashMapAdapter<K>>(out, keys, slots, count, loadFactor);
+                insert<unorderedMapAdapter<K>>(out, keys, slots, count, loadFactor);
+            }
+            if (section_B) {
+                lookup<hashMapAdapter<K>>(out, keys, slots, count, loadFactor, true);
+                lookup<unorderedMapAdapter<K>>(out, keys, slots, count, loadFactor, true);
+            }
+            if (section_C) {
+                lookup<hashMapAdapter<K>>(out, keys, slots, count, loadFactor, false);
+                lookup<unorderedMapAdapter<K>>(out, keys, slots, count, loadFactor, false);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Hash Map Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(6, 8);
+    if (maxExponent < 4) maxExponent = 4;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
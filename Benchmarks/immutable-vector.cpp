@@ -0,0 +1,208 @@
+/**
+ * Created on October 19, 2026. Benchmarks ImmutableVector<T>, the
+ * persistent RRB-tree vector, against Vector<T> on the operations a
+ * snapshot-per-request reader cares about.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 immutable-vector.cpp -o immutable-vector
+ * and run as
+ *     ./immutable-vector [output file]
+ *
+ * At sizes 10^3 up to the chosen power of ten (at most 10^7) this
+ * times taking a snapshot (a copy), reading random indexes, building
+ * by addBack (one version per element, and in a transient), setting
+ * random indexes (one version per set), and concatenating two halves.
+ * The Vector runs copy the whole array where ImmutableVector shares
+ * it. Results are written as JSON lines to bench_output.txt by
+ * default.
+ */
+#include "benchmark.h"
+#include "../Vector/immutable-vector.h"
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Snapshot
+const bool section_B = true; // Random reads
+const bool section_C = true; // Build by addBack
+const bool section_D = true; // Random sets
+const bool section_E = true; // Concatenate two halves
+
+/** Operations timed per snapshot, read, and set run */
+const size_t sampleOps = 1 << 12;
+
+/**
+ * The i-th index of a scattered walk over n elements
+ */
+size_t scatteredIndex(size_t i, size_t n) {
+    return (i * 2654435761u) % n;
+}
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Returns a version holding the first n values, built in a transient
+ */
+template <typename T>
+ImmutableVector<T> builtImmutable(const std::vector<T>& values, size_t n) {
+    typename ImmutableVector<T>::transientVector draft;
+    for (size_t i = 0; i < n; i++) {
+        draft.addBack(values[i]);
+    }
+    return draft.persistent();
+}
+
+/**
+ * Returns a Vector holding the first n values
+ */
+template <typename T>
+Vector<T> builtVector(const std::vector<T>& values, size_t n) {
+    Vector<T> list;
+    for (size_t i = 0; i < n; i++) {
+        list.addBack(values[i]);
+    }
+    return list;
+}
+
+/**
+ * Times taking snapshots of a list of n elements
+ */
+template <typename T>
+void snapshot(benchWriter& out, const std::vector<T>& values, size_t n) {
+    ImmutableVector<T> version = builtImmutable(values, n);
+    Vector<T> list = builtVector(values, n);
+    size_t ops = n >= 100000 ? sampleOps / 64 : sampleOps;
+    size_t seen = 0;
+    double ns = measure(1, [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < ops; i++) {
+            ImmutableVector<T> copy = version;
+            seen += copy.size();
+        }
+    });
+    out.record("immutable-vector", "snapshot", "ImmutableVector", typeName<T>(), n, ops, ns);
+    ns = measure(1, [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < ops; i++) {
+            Vector<T> copy = list;
+            seen += copy.size();
+        }
+    });
+    out.record("immutable-vector", "snapshot", "Vector", typeName<T>(), n, ops, ns);
+    keep(seen);
+}
+
+/**
+ * Times reading scattered indexes of a list of n elements
+ */
+template <typename T>
+void reads(benchWriter& out, const std::vector<T>& values, size_t n) {
+    ImmutableVector<T> version = builtImmutable(values, n);
+    Vector<T> list = builtVector(values, n);
+    double ns = measure(repetitionsFor(sampleOps), [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < sampleOps; i++) {
+            keep(version[scatteredIndex(i, n)]);
+        }
+    });
+    out.record("immutable-vector", "read-random", "ImmutableVector", typeName<T>(), n, sampleOps, ns);
+    ns = measure(repetitionsFor(sampleOps), [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < sampleOps; i++) {
+            keep(list[scatteredIndex(i, n)]);
+        }
+    });
+    out.record("immutable-vector", "read-random", "Vector", typeName<T>(), n, sampleOps, ns);
+}
+
+/**
+ * Times building a list of n elements by addBack
+ */
+template <typename T>
+void build(benchWriter& out, const std::vector<T>& values, size_t n) {
+    size_t repetitions = repetitionsFor(n);
+    double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        ImmutableVector<T> version;
+        for (size_t i = 0; i < n; i++) {
+            version = version.addBack(values[i]);
+        }
+        keep(version.size());
+    });
+    out.record("immutable-vector", "build", "ImmutableVector", typeName<T>(), n, n, ns);
+    ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep(builtImmutable(values, n).size());
+    });
+    out.record("immutable-vector", "build", "ImmutableVector (transient)", typeName<T>(), n, n, ns);
+    ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep(builtVector(values, n).size());
+    });
+    out.record("immutable-vector", "build", "Vector", typeName<T>(), n, n, ns);
+}
+
+/**
+ * Times making a new version per set of a scattered index
+ */
+template <typename T>
+void sets(benchWriter& out, const std::vector<T>& values, size_t n) {
+    ImmutableVector<T> version = builtImmutable(values, n);
+    double ns = measure(repetitionsFor(sampleOps), [&] { return version; }, [&](ImmutableVector<T>& current) {
+        for (size_t i = 0; i < sampleOps; i++) {
+            current = current.set(scatteredIndex(i, n), values[i % n]);
+        }
+    });
+    out.record("immutable-vector", "set-random", "ImmutableVector", typeName<T>(), n, sampleOps, ns);
+}
+
+/**
+ * Times joining two halves of n elements into one list
+ */
+template <typename T>
+void concat(benchWriter& out, const std::vector<T>& values, size_t n) {
+    ImmutableVector<T> left = builtImmutable(values, n / 2 + 7);
+    ImmutableVector<T> right = builtImmutable(values, n - n / 2 - 7);
+    Vector<T> leftList = builtVector(values, n / 2 + 7);
+    Vector<T> rightList = builtVector(values, n - n / 2 - 7);
+    size_t repetitions = repetitionsFor(n);
+    double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep((left + right).size());
+    });
+    out.record("immutable-vector", "concat", "ImmutableVector", typeName<T>(), n, 1, ns);
+    ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep((leftList + rightList).size());
+    });
+    out.record("immutable-vector", "concat", "Vector", typeName<T>(), n, 1, ns);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        if (section_A) snapshot(out, values, n);
+        if (section_B) reads(out, values, n);
+        if (section_C) build(out, values, n);
+        if (section_D) sets(out, values, n);
+        if (section_E) concat(out, values, n);
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Immutable Vector Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(5, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
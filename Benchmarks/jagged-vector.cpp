@@ -0,0 +1,201 @@
+/**
+ * Created on October 19, 2026. Benchmarks JaggedVector<T>, which
+ * keeps every row in one flat array, against Vector<Vector<T>>
+ * on adjacency-list workloads.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 -pthread jagged-vector.cpp -o jagged-vector
+ * and run as
+ *     ./jagged-vector [output file]
+ *
+ * For 10^3 up to the chosen power of ten (at most 10^7) edges
+ * spread over an eighth as many rows, this times building the
+ * rows from an edge list (by counting sort on one thread and on
+ * every core, and by addBack into per-row Vectors), building them
+ * row by row, walking every value, and reading scattered rows.
+ * Results are written as JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Vector/jagged-vector.h"
+#include <string>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Build from an edge list
+const bool section_B = true; // Build row by row
+const bool section_C = true; // Walk every value
+const bool section_D = true; // Read scattered rows
+
+/** Edges per row, on average */
+const size_t degree = 8;
+
+/** Rows read per scattered-read run */
+const size_t sampleOps = 1 << 12;
+
+/**
+ * The i-th index of a scattered walk over n elements
+ */
+size_t scatteredIndex(size_t i, size_t n) {
+    return (i * 2654435761u) % n;
+}
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Returns n edges over the given number of rows, in scattered order
+ */
+template <typename T>
+Vector<std::pair<size_t, T>> edgeList(const std::vector<T>& values, size_t n, size_t rows) {
+    Vector<std::pair<size_t, T>> edges(static_cast<int>(n));
+    for (size_t i = 0; i < n; i++) {
+        edges.addBack(std::make_pair(scatteredIndex(i, rows), values[i]));
+    }
+    return edges;
+}
+
+/**
+ * Returns the edges as one Vector per row
+ */
+template <typename T>
+Vector<Vector<T>> nestedRows(const Vector<std::pair<size_t, T>>& edges, size_t rows) {
+    Vector<Vector<T>> nested(static_cast<int>(rows));
+    for (size_t row = 0; row < rows; row++) {
+        nested.addBack(Vector<T>());
+    }
+    for (const std::pair<size_t, T>& edge : edges) {
+        nested.begin()[edge.first].addBack(edge.second);
+    }
+    return nested;
+}
+
+/**
+ * Times building the rows of n edges from the edge list
+ */
+template <typename T>
+void buildFromEdges(benchWriter& out, const Vector<std::pair<size_t, T>>& edges, size_t n, size_t rows) {
+    size_t repetitions = repetitionsFor(n);
+    double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep(JaggedVector<T>(rows, edges, 1).size());
+    });
+    out.record("jagged-vector", "build-edges", "JaggedVector (1 thread)", typeName<T>(), n, n, ns);
+    ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep(JaggedVector<T>(rows, edges).size());
+    });
+    out.record("jagged-vector", "build-edges", "JaggedVector", typeName<T>(), n, n, ns);
+    ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        keep(nestedRows(edges, rows).size());
+    });
+    out.record("jagged-vector", "build-edges", "Vector<Vector>", typeName<T>(), n, n, ns);
+}
+
+/**
+ * Times building the rows one after another, each filled in turn
+ */
+template <typename T>
+void buildByRows(benchWriter& out, const std::vector<T>& values, size_t n, size_t rows) {
+    size_t repetitions = repetitionsFor(n);
+    double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        JaggedVector<T> jagged;
+        for (size_t i = 0; i < n; i++) {
+            if (i % degree == 0) jagged.addRow();
+            jagged.addBack(values[i]);
+        }
+        keep(jagged.size());
+    });
+    out.record("jagged-vector", "build-rows", "JaggedVector", typeName<T>(), n, n, ns);
+    ns = measure(repetitions, [] { return 0; }, [&](int&) {
+        Vector<Vector<T>> nested(static_cast<int>(rows));
+        for (size_t i = 0; i < n; i++) {
+            if (i % degree == 0) nested.addBack(Vector<T>());
+            nested.begin()[nested.size() - 1].addBack(values[i]);
+        }
+        keep(nested.size());
+    });
+    out.record("jagged-vector", "build-rows", "Vector<Vector>", typeName<T>(), n, n, ns);
+}
+
+/**
+ * Times walking every value of every row
+ */
+template <typename T>
+void walk(benchWriter& out, const JaggedVector<T>& jagged, const Vector<Vector<T>>& nested, size_t n) {
+    uint64_t sum = 0;
+    double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        for (Span<const T> row : jagged) {
+            for (const T& value : row) sum += digest(value);
+        }
+    });
+    out.record("jagged-vector", "walk", "JaggedVector", typeName<T>(), n, n, ns);
+    ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        for (const Vector<T>& row : nested) {
+            for (const T& value : row) sum += digest(value);
+        }
+    });
+    out.record("jagged-vector", "walk", "Vector<Vector>", typeName<T>(), n, n, ns);
+    keep(sum);
+}
+
+/**
+ * Times reading every value of scattered rows
+ */
+template <typename T>
+void reads(benchWriter& out, const JaggedVector<T>& jagged, const Vector<Vector<T>>& nested, size_t n, size_t rows) {
+    uint64_t sum = 0;
+    double ns = measure(repetitionsFor(sampleOps), [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < sampleOps; i++) {
+            for (const T& value : jagged[scatteredIndex(i, rows)]) sum += digest(value);
+        }
+    });
+    out.record("jagged-vector", "read-rows", "JaggedVector", typeName<T>(), n, sampleOps, ns);
+    ns = measure(repetitionsFor(sampleOps), [] { return 0; }, [&](int&) {
+        for (size_t i = 0; i < sampleOps; i++) {
+            for (const T& value : nested.begin()[scatteredIndex(i, rows)]) sum += digest(value);
+        }
+    });
+    out.record("jagged-vector", "read-rows", "Vector<Vector>", typeName<T>(), n, sampleOps, ns);
+    keep(sum);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        size_t rows = n / degree;
+        Vector<std::pair<size_t, T>> edges = edgeList(values, n, rows);
+        if (section_A) buildFromEdges(out, edges, n, rows);
+        if (section_B) buildByRows(out, values, n, rows);
+        if (section_C || section_D) {
+            JaggedVector<T> jagged(rows, edges);
+            Vector<Vector<T>> nested = nestedRows(edges, rows);
+            if (section_C) walk(out, jagged, nested, n);
+            if (section_D) reads(out, jagged, nested, n, rows);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Jagged Vector Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(5, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * Created on October 19, 2026. Benchmarks comparing
+ * PriorityQueue<T> heaps of arity 2, 4, and 8 with
+ * std::priority_queue and with the sorted Vector<T> that
+ * schedulers kept before there was a priority queue.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 priority-queue.cpp -o priority-queue
+ * and run as
+ *     ./priority-queue [output file]
+ *
+ * Each workload works on 10^3 up to the chosen power of
+ * ten (at most 10^8) elements. The sorted Vector is skipped
+ * past 10^5, where each insert moves too much to finish.
+ * Results are written as JSON lines to bench_output.txt by
+ * default.
+ */
+#include "benchmark.h"
+#include "../PriorityQueue/priority-queue.h"
+#include "../PriorityQueue/indexed-priority-queue.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <queue>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Push all, then pop all
+const bool section_B = true; // Hold: pop one, push one, at a steady size
+const bool section_C = true; // Heapify, then pop all
+const bool section_D = true; // Sorted Vector (the old way)
+const bool section_E = true; // Dijkstra-style decreaseKey
+
+/** The largest size the sorted Vector is run at */
+const size_t sortedLimit = 100000;
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t Arity>
+void pop(PriorityQueue<T, std::less<T>, Arity>& queue) { keep(queue.pop()); }
+
+template <typename T>
+void pop(std::priority_queue<T>& queue) { keep(queue.top()); queue.pop(); }
+
+template <typename T, size_t Arity>
+const char* containerName(const PriorityQueue<T, std::less<T>, Arity>&) {
+    return Arity == 2 ? "PriorityQueue<2>" : Arity == 4 ? "PriorityQueue<4>" : "PriorityQueue<8>";
+}
+
+template <typename T>
+const char* containerName(const std::priority_queue<T>&) { return "std::priority_queue"; }
+
+/**
+ * Keeps the vector sorted, least first, by inserting in place
+ */
+template <typename T>
+void sortedInsert(Vector<T>& sorted, const T& value) {
+    T* position = std::lower_bound(sorted.begin(), sorted.end(), value);
+    if (position == sorted.end()) {
+        sorted.addBack(value);
+    } else {
+        sorted.insert(value, position);
+    }
+}
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Pushes n elements and then pops all of them
+ */
+template <typename Container, typename T>
+void fillDrain(benchWriter& out, const std::vector<T>& values, size_t n) {
+    double ns = measure(repetitionsFor(n), [] { return std::unique_ptr<Container>(new Container()); },
+                        [&](std::unique_ptr<Container>& queue) {
+        for (size_t i = 0; i < n; i++) {
+            queue->push(values[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            pop(*queue);
+        }
+    });
+    out.record("priority-queue", "fill-drain", containerName(Container()), typeName<T>(), n, 2 * n, ns);
+}
+
+/**
+ * Starting from n elements, pops one and pushes one n times,
+ * the steady state of an event scheduler
+ */
+template <typename Container, typename T>
+void hold(benchWriter& out, const std::vector<T>& values, size_t n) {
+    double ns = measure(repetitionsFor(n), [&] {
+        std::unique_ptr<Container> queue(new Container());
+        for (size_t i = 0; i < n; i++) {
+            queue->push(values[i]);
+        }
+        return queue;
+    }, [&](std::unique_ptr<Container>& queue) {
+        for (size_t i = 0; i < n; i++) {
+            pop(*queue);
+            queue->push(values[n - 1 - i]);
+        }
+    });
+    out.record("priority-queue", "hold", containerName(Container()), typeName<T>(), n, 2 * n, ns);
+}
+
+/**
+ * Builds a heap of n elements at once and pops all of them
+ */
+template <size_t Arity, typename T>
+void heapifyDrain(benchWriter& out, const std::vector<T>& values, size_t n) {
+    using Queue = PriorityQueue<T, std::less<T>, Arity>;
+    double ns = measure(repetitionsFor(n), [&] {
+        Vector<T> elements;
+        for (size_t i = 0; i < n; i++) {
+            elements.addBack(values[i]);
+        }
+        return elements;
+    }, [&](Vector<T>& elements) {
+        Queue queue(move(elements));
+        for (size_t i = 0; i < n; i++) {
+            pop(queue);
+        }
+    });
+    out.record("priority-queue", "heapify-drain", containerName(Queue()), typeName<T>(), n, n, ns);
+}
+
+/**
+ * Inserts n elements into a sorted Vector and removes
+ * them from the back, largest first
+ */
+template <typename T>
+void sortedVector(benchWriter& out, const std::vector<T>& values, size_t n) {
+    double ns = measure(repetitionsFor(n), [] { return Vector<T>(); }, [&](Vector<T>& sorted) {
+        for (size_t i = 0; i < n; i++) {
+            sortedInsert(sorted, values[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            keep(sorted.removeBack());
+        }
+    });
+    out.record("priority-queue", "fill-drain", "sorted Vector", typeName<T>(), n, 2 * n, ns);
+}
+
+/**
+ * Runs Dijkstra's algorithm over a random graph of n vertices
+ * with four edges each, improving keys with decreaseKey
+ */
+template <size_t Arity>
+void dijkstra(benchWriter& out, size_t n) {
+    std::vector<uint32_t> targets(4 * n);
+    std::vector<uint32_t> weights(4 * n);
+    uint64_t state = 88172645463325252ull;
+    for (size_t e = 0; e < 4 * n; e++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        targets[e] = static_cast<uint32_t>(state % n);
+        weights[e] = static_cast<uint32_t>(state >> 40) % 1000 + 1;
+    }
+    size_t improved = 0;
+    double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        IndexedPriorityQueue<uint64_t, std::greater<uint64_t>, Arity> frontier;
+        const size_t unseen = static_cast<size_t>(-1);
+        std::vector<size_t> handles(n, unseen);
+        std::vector<uint64_t> distance(n, UINT64_MAX);
+        std::vector<bool> done(n, false);
+        distance[0] = 0;
+        handles[0] = frontier.push(0);
+        std::vector<uint32_t> vertexOf(1, 0);
+        improved = 0;
+        while (!frontier.empty()) {
+            uint32_t vertex = vertexOf[frontier.topHandle()];
+            frontier.pop();
+            done[vertex] = true;
+            for (size_t e = 4 * size_t(vertex); e < 4 * size_t(vertex) + 4; e++) {
+                uint32_t target = targets[e];
+                uint64_t through = distance[vertex] + weights[e];
+                if (done[target] || through >= distance[target]) {
+                    continue;
+                }
+                distance[target] = through;
+                if (handles[target] != unseen && frontier.contains(handles[target])
+                    && vertexOf[handles[target]] == target) {
+                    frontier.decreaseKey(handles[target], through);
+                    improved++;
+                } else {
+                    handles[target] = frontier.push(through);
+                    if (handles[target] >= vertexOf.size()) vertexOf.resize(handles[target] + 1);
+                    vertexOf[handles[target]] = target;
+                }
+            }
+        }
+        keep(distance[n - 1]);
+    });
+    const char* name = Arity == 2 ? "IndexedPriorityQueue<2>" : "IndexedPriorityQueue<4>";
+    out.record("priority-queue", "dijkstra", name, "uint64", n, 5 * n, ns);
+    keep(improved);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i * 2654435761u % largest));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        if (section_A) {
+            fillDrain<PriorityQueue<T, std::less<T>, 2>>(out, values, n);
+            fillDrain<PriorityQueue<T, std::less<T>, 4>>(out, values, n);
+            fillDrain<PriorityQueue<T, std::less<T>, 8>>(out, values, n);
+            fillDrain<std::priority_queue<T>>(out, values, n);
+        }
+        if (section_B) {
+            hold<PriorityQueue<T, std::less<T>, 2>>(out, values, n);
+            hold<PriorityQueue<T, std::less<T>, 4>>(out, values, n);
+            hold<PriorityQueue<T, std::less<T>, 8>>(out, values, n);
+            hold<std::priority_queue<T>>(out, values, n);
+        }
+        if (section_C) {
+            heapifyDrain<2>(out, values, n);
+            heapifyDrain<4>(out, values, n);
+            heapifyDrain<8>(out, values, n);
+        }
+        if (section_D && n <= sortedLimit) {
+            sortedVector(out, values, n);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Priority Queue Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(7, 8);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    if (section_E) {
+        size_t largest = 1;
+        for (int e = 0; e < maxExponent; e++) largest *= 10;
+        for (size_t n = 1000; n <= largest; n *= 10) {
+            dijkstra<2>(out, n);
+            dijkstra<4>(out, n);
+        }
+    }
+
+    return 0;
+}
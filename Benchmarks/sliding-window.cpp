@@ -0,0 +1,127 @@
+/**
+ * Created on October 19, 2026. Benchmarks of sliding-window
+ * minimums, comparing the two-stack AggregateQueue<T> with
+ * rescanning the window (std::deque) and the monotonic deque
+ * that only works for min and max.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 sliding-window.cpp -o sliding-window
+ * and run as
+ *     ./sliding-window [output file]
+ *
+ * Each workload slides a window of 16, 256, or 4096 elements
+ * over 10^3 up to the chosen power of ten (at most 10^8)
+ * elements. Rescanning is skipped once it would cost more
+ * than 10^9 comparisons. Results are written as JSON lines
+ * to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Stack/aggregate-stack.h"
+#include <deque>
+#include <string>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // AggregateQueue
+const bool section_B = true; // Rescanning the window
+const bool section_C = true; // Monotonic deque
+
+/** The window widths to try */
+const size_t windows[] = {16, 256, 4096};
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Reports the minimum of every window with an AggregateQueue
+ */
+void aggregateQueue(benchWriter& out, const std::vector<int>& values, size_t n, size_t window) {
+    double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        AggregateQueue<int, minOf<int>> queue;
+        for (size_t i = 0; i < n; i++) {
+            queue.push(values[i]);
+            if (queue.size() > window) {
+                keep(queue.pull());
+            }
+            keep(queue.aggregate());
+        }
+    });
+    out.record("sliding-window", ("min-w" + std::to_string(window)).c_str(), "AggregateQueue", "int", n, n, ns);
+}
+
+/**
+ * Reports the minimum of every window by scanning all of it
+ */
+void rescan(benchWriter& out, const std::vector<int>& values, size_t n, size_t window) {
+    double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        std::deque<int> queue;
+        for (size_t i = 0; i < n; i++) {
+            queue.push_back(values[i]);
+            if (queue.size() > window) {
+                queue.pop_front();
+            }
+            int low = queue.front();
+            for (int value : queue) {
+                low = value < low ? value : low;
+            }
+            keep(low);
+        }
+    });
+    out.record("sliding-window", ("min-w" + std::to_string(window)).c_str(), "rescan", "int", n, n, ns);
+}
+
+/**
+ * Reports the minimum of every window with a deque of
+ * indices whose values only increase
+ */
+void monotonic(benchWriter& out, const std::vector<int>& values, size_t n, size_t window) {
+    double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        std::deque<size_t> candidates;
+        for (size_t i = 0; i < n; i++) {
+            while (!candidates.empty() && values[i] <= values[candidates.back()]) {
+                candidates.pop_back();
+            }
+            candidates.push_back(i);
+            if (candidates.front() + window <= i) {
+                candidates.pop_front();
+            }
+            keep(values[candidates.front()]);
+        }
+    });
+    out.record("sliding-window", ("min-w" + std::to_string(window)).c_str(), "monotonic-deque", "int", n, n, ns);
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Sliding Window Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(7, 8);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<int> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<int>(i * 2654435761u % largest));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        for (size_t window : windows) {
+            if (section_A) {
+                aggregateQueue(out, values, n, window);
+            }
+            if (section_B && n * window <= 1000000000) {
+                rescan(out, values, n, window);
+            }
+            if (section_C) {
+                monotonic(out, values, n, window);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/**
+ * Created on October 19, 2026. Benchmarks SlotMap<T>, which hands
+ * out generational handles, against the usual way of keeping
+ * values under ids that outlive erases: a HashMap<uint64_t, T>
+ * keyed by a counter.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 slot-map.cpp -o slot-map
+ * and run as
+ *     ./slot-map [output file]
+ *
+ * At sizes 10^3 up to the chosen power of ten (at most 10^7) this
+ * times inserting n values, looking up live ids in scattered
+ * order, looking up ids whose values were erased, erasing half of
+ * the values, and walking every value. Results are written as
+ * JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../HashMap/hash-map.h"
+#include "../SlotMap/slot-map.h"
+#include <string>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Insert
+const bool section_B = true; // Lookups of live ids
+const bool section_C = true; // Lookups of stale ids
+const bool section_D = true; // Erase half
+const bool section_E = true; // Iterate
+
+/** Lookups timed per lookup run */
+const size_t sampleOps = 1 << 14;
+
+/**
+ * The i-th index of a scattered walk over n elements
+ */
+size_t scatteredIndex(size_t i, size_t n) {
+    return (i * 2654435761u) % n;
+}
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+struct slotMapAdapter {
+    SlotMap<T> map;
+
+    static const char* name() { return "SlotMap"; }
+    uint64_t insert(const T& value) { return map.insert(value).raw(); }
+    bool erase(uint64_t id) { return map.erase(slotHandle::fromRaw(id)); }
+    const T* find(uint64_t id) const { return map.tryAt(slotHandle::fromRaw(id)); }
+
+    template <typename Visit>
+    void scan(Visit visit) const {
+        for (const T& value : map) visit(value);
+    }
+};
+
+template <typename T>
+struct hashMapAdapter {
+    HashMap<uint64_t, T> map;
+    uint64_t nextId = 0;
+
+    static const char* name() { return "HashMap"; }
+
+    uint64_t insert(const T& value) {
+        map.insert(nextId, value);
+        return nextId++;
+    }
+
+    bool erase(uint64_t id) { return map.erase(id); }
+    const T* find(uint64_t id) const { return map.tryAt(id); }
+
+    template <typename Visit>
+    void scan(Visit visit) const {
+        for (const std::pair<const uint64_t, T>& entry : map) visit(entry.second);
+    }
+};
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Fills the container with the first n values, keeping their ids
+ */
+template <typename Adapter, typename T>
+void fill(Adapter& container, std::vector<uint64_t>& ids, const std::vector<T>& values, size_t n) {
+    ids.clear();
+    for (size_t i = 0; i < n; i++) {
+        ids.push_back(container.insert(values[i]));
+    }
+}
+
+/**
+ * Times every enabled workload on one container of n values
+ */
+template <typename Adapter, typename T>
+void run(benchWriter& out, const std::vector<T>& values, size_t n) {
+    const char* type = typeName<T>();
+    std::vector<uint64_t> ids;
+
+    if (section_A) {
+        double ns = measure(repetitionsFor(n), [] { return Adapter(); }, [&](Adapter& container) {
+            fill(container, ids, values, n);
+        });
+        out.record("slot-map", "insert", Adapter::name(), type, n, n, ns);
+    }
+
+    Adapter container;
+    fill(container, ids, values, n);
+
+    if (section_B) {
+        double ns = measure(repetitionsFor(sampleOps), [] { return 0; }, [&](int&) {
+            for (size_t i = 0; i < sampleOps; i++) {
+                keep(*container.find(ids[scatteredIndex(i, n)]));
+            }
+        });
+        out.record("slot-map", "lookup-live", Adapter::name(), type, n, sampleOps, ns);
+    }
+
+    if (section_C) {
+        // erase every other value, refill, and look up the old ids
+        Adapter churned;
+        std::vector<uint64_t> stale;
+        fill(churned, stale, values, n);
+        for (size_t i = 0; i < n; i += 2) churned.erase(stale[i]);
+        for (size_t i = 0; i < n; i += 2) churned.insert(values[i]);
+        size_t misses = 0;
+        double ns = measure(repetitionsFor(sampleOps), [] { return 0; }, [&](int&) {
+            for (size_t i = 0; i < sampleOps; i++) {
+                misses += churned.find(stale[scatteredIndex(i, n) & ~size_t(1)]) == nullptr;
+            }
+        });
+        keep(misses);
+        out.record("slot-map", "lookup-stale", Adapter::name(), type, n, sampleOps, ns);
+    }
+
+    if (section_D) {
+        double ns = measure(repetitionsFor(n), [&] {
+            Adapter fresh;
+            fill(fresh, ids, values, n);
+            return fresh;
+        }, [&](Adapter& fresh) {
+            for (size_t i = 0; i < n; i += 2) keep(fresh.erase(ids[scatteredIndex(i, n)]));
+        });
+        out.record("slot-map", "erase-half", Adapter::name(), type, n, n / 2, ns);
+    }
+
+    if (section_E) {
+        uint64_t sum = 0;
+        double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+            container.scan([&](const T& value) { sum += digest(value); });
+        });
+        keep(sum);
+        out.record("slot-map", "iterate", Adapter::name(), type, n, n, ns);
+    }
+}
+
+/**
+ * Runs both containers for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        run<slotMapAdapter<T>>(out, values, n);
+        run<hashMapAdapter<T>>(out, values, n);
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Slot Map Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(5, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/**
+ * Created on October 19, 2026. Benchmarks erase-heavy workloads
+ * on StableIndexVector<T>, which leaves a tombstone per erase,
+ * against Vector<T>::remove, which shifts the tail down.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 stable-index-vector.cpp -o stable-index-vector
+ * and run as
+ *     ./stable-index-vector [output file]
+ *
+ * Lists of 10^3 up to the chosen power of ten (at most 10^7)
+ * elements have 10% and then 50% of their elements erased from
+ * random positions. Each erase pass is timed on its own, then
+ * with a full scan of the survivors after it, and for the
+ * StableIndexVector the compaction that reclaims the tombstones
+ * is timed as well. Vector::remove is quadratic in this workload,
+ * so it is skipped past 10^5 elements. Results are written as
+ * JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Vector/stable-index-vector.h"
+#include <algorithm>
+#include <random>
+#include <string>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Erase
+const bool section_B = true; // Erase, then scan
+const bool section_C = true; // Compact after erasing
+
+/** The fractions of each list that are erased */
+const double eraseFractions[] = {0.1, 0.5};
+
+/** The largest list Vector::remove is run on */
+const size_t vectorLimit = 100000;
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+struct stableAdapter {
+    StableIndexVector<T> list;
+
+    static const char* name() { return "StableIndexVector"; }
+    void addBack(const T& value) { list.addBack(value); }
+
+    /** Erases the element that was added index-th */
+    void erase(size_t index, size_t) { list.erase(index); }
+
+    template <typename Visit>
+    void scan(Visit visit) const {
+        for (const T& value : list) visit(value);
+    }
+};
+
+template <typename T>
+struct vectorAdapter {
+    Vector<T> list;
+
+    static const char* name() { return "Vector"; }
+    void addBack(const T& value) { list.addBack(value); }
+
+    /** Erases the element now at the given position */
+    void erase(size_t, size_t position) { list.remove(list.begin() + position); }
+
+    template <typename Visit>
+    void scan(Visit visit) const {
+        for (const T& value : list) visit(value);
+    }
+};
+
+/**
+ * Picks count erase targets for a list of n elements: for the
+ * StableIndexVector, distinct original indexes; for the Vector,
+ * the position each of those elements has when it is removed
+ */
+struct eraseTargets {
+    std::vector<size_t> indexes;
+    std::vector<size_t> positions;
+
+    eraseTargets(size_t n, size_t count) {
+        std::vector<size_t> order(n);
+        for (size_t i = 0; i < n; i++) order[i] = i;
+        std::shuffle(order.begin(), order.end(), std::minstd_rand(7));
+        indexes.assign(order.begin(), order.begin() + count);
+        // a position drops by one for every earlier erase in front of it,
+        // counted with a Fenwick tree over the original indexes
+        std::vector<size_t> erasedBefore(n + 1, 0);
+        for (size_t index : indexes) {
+            size_t position = index;
+            for (size_t i = index; i > 0; i -= i & (0 - i)) position -= erasedBefore[i];
+            positions.push_back(position);
+            for (size_t i = index + 1; i <= n; i += i & (0 - i)) erasedBefore[i]++;
+        }
+    }
+};
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Returns a list holding n elements
+ */
+template <typename Adapter, typename T>
+Adapter filled(const std::vector<T>& values, size_t n) {
+    Adapter list;
+    for (size_t i = 0; i < n; i++) {
+        list.addBack(values[i]);
+    }
+    return list;
+}
+
+/**
+ * Times erasing the targets from a fresh list, then optionally
+ * scanning what survives
+ */
+template <typename Adapter, typename T>
+void erase(benchWriter& out, const std::vector<T>& values, const eraseTargets& targets, size_t n, bool scan) {
+    size_t count = targets.indexes.size();
+    size_t visited = 0;
+    double ns = measure(repetitionsFor(n), [&] { return filled<Adapter>(values, n); }, [&](Adapter& list) {
+        for (size_t e = 0; e < count; e++) {
+            list.erase(targets.indexes[e], targets.positions[e]);
+        }
+        if (scan) {
+            list.scan([&](const T& value) { keep(value); visited++; });
+        }
+    });
+    keep(visited);
+    std::string operation = std::string(scan ? "erase-scan-" : "erase-") + std::to_string(100 * count / n) + "pct";
+    out.record("stable-index-vector", operation.c_str(), Adapter::name(), typeName<T>(), n, count, ns);
+}
+
+/**
+ * Times compacting a StableIndexVector after the targets are erased
+ */
+template <typename T>
+void compact(benchWriter& out, const std::vector<T>& values, const eraseTargets& targets, size_t n) {
+    size_t count = targets.indexes.size();
+    size_t remapped = 0;
+    double ns = measure(repetitionsFor(n), [&] {
+        stableAdapter<T> list = filled<stableAdapter<T>>(values, n);
+        for (size_t index : targets.indexes) list.list.erase(index);
+        return list;
+    }, [&](stableAdapter<T>& list) {
+        remapped += list.list.compact().size();
+    });
+    keep(remapped);
+    std::string operation = "compact-" + std::to_string(100 * count / n) + "pct";
+    out.record("stable-index-vector", operation.c_str(), "StableIndexVector", typeName<T>(), n, n, ns);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        for (double fraction : eraseFractions) {
+            eraseTargets targets(n, static_cast<size_t>(n * fraction));
+            bool runVector = n <= vectorLimit;
+            if (section_A) {
+                erase<stableAdapter<T>>(out, values, targets, n, false);
+                if (runVector) erase<vectorAdapter<T>>(out, values, targets, n, false);
+            }
+            if (section_B) {
+                erase<stableAdapter<T>>(out, values, targets, n, true);
+                if (runVector) erase<vectorAdapter<T>>(out, values, targets, n, true);
+            }
+            if (section_C) {
+                compact(out, values, targets, n);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Stable Index Vector Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(5, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * Created on October 19, 2026. Benchmarks comparing
+ * the linked Stack<T> with the contiguous ArrayStack<T>,
+ * the inline SmallStack<T, N> (and std::stack as a baseline).
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 stack-backends.cpp -o stack-backends
+ * and run as
+ *     ./stack-backends [output file]
+ *
+ * Each workload performs 10^3 up to the chosen power of
+ * ten (at most 10^8) operations. Results are written as
+ * JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Stack/stack.h"
+#include "../Stack/array-stack.h"
+#include "../Stack/small-stack.h"
+#include <memory>
+#include <stack>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Fill then drain
+const bool section_B = true; // Parser-style churn
+const bool section_C = true; // Shallow stacks, built fresh each time
+
+/** The deepest a shallow stack gets, and SmallStack's inline capacity */
+const size_t shallowDepth = 32;
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+void pull(Stack<T>& stk) { keep(stk.pull()); }
+
+template <typename T>
+void pull(ArrayStack<T>& stk) { keep(stk.pull()); }
+
+template <typename T, size_t N>
+void pull(SmallStack<T, N>& stk) { keep(stk.pull()); }
+
+template <typename T>
+void pull(std::stack<T>& stk) { keep(stk.top()); stk.pop(); }
+
+template <typename T>
+const char* containerName(const Stack<T>&) { return "Stack"; }
+
+template <typename T>
+const char* containerName(const ArrayStack<T>&) { return "ArrayStack"; }
+
+template <typename T, size_t N>
+const char* containerName(const SmallStack<T, N>&) { return "SmallStack"; }
+
+template <typename T>
+const char* containerName(const std::stack<T>&) { return "std::stack"; }
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Pushes n elements and then pulls all of them
+ */
+template <typename Container, typename T>
+void fillDrain(benchWriter& out, const std::vector<T>& values, size_t n) {
+    double ns = measure(repetitionsFor(n), [] { return std::unique_ptr<Container>(new Container()); },
+                        [&](std::unique_ptr<Container>& stk) {
+        for (size_t i = 0; i < n; i++) {
+            stk->push(values[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            pull(*stk);
+        }
+    });
+    out.record("stack-backends", "fill-drain", containerName(Container()), typeName<T>(), n, 2 * n, ns);
+}
+
+/**
+ * Performs n operations in the shape of a shift-reduce
+ * parser: two pushes for every pull, draining at the end
+ */
+template <typename Container, typename T>
+void churn(benchWriter& out, const std::vector<T>& values, size_t n) {
+    double ns = measure(repetitionsFor(n), [] { return std::unique_ptr<Container>(new Container()); },
+                        [&](std::unique_ptr<Container>& stk) {
+        size_t live = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (i % 3 == 2) {
+                pull(*stk);
+                live--;
+            } else {
+                stk->push(values[i]);
+                live++;
+            }
+        }
+        for (; live > 0; live--) {
+            pull(*stk);
+        }
+    });
+    out.record("stack-backends", "churn", containerName(Container()), typeName<T>(), n, n, ns);
+}
+
+/**
+ * Builds a fresh stack for every group of shallowDepth elements,
+ * the way an expression evaluator makes one per expression,
+ * pushing and pulling n elements in total
+ */
+template <typename Container, typename T>
+void shallow(benchWriter& out, const std::vector<T>& values, size_t n) {
+    double ns = measure(repetitionsFor(n), [] { return 0; }, [&](int&) {
+        for (size_t done = 0; done < n; done += shallowDepth) {
+            Container stk;
+            for (size_t i = 0; i < shallowDepth; i++) {
+                stk.push(values[done + i < n ? done + i : i]);
+            }
+            for (size_t i = 0; i < shallowDepth; i++) {
+                pull(stk);
+            }
+        }
+    });
+    out.record("stack-backends", "shallow", containerName(Container()), typeName<T>(), n, 2 * n, ns);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<T> values;
+    values.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        if (section_A) {
+            fillDrain<Stack<T>>(out, values, n);
+            fillDrain<ArrayStack<T>>(out, values, n);
+            fillDrain<std::stack<T>>(out, values, n);
+        }
+        if (section_B) {
+            churn<Stack<T>>(out, values, n);
+            churn<ArrayStack<T>>(out, values, n);
+            churn<std::stack<T>>(out, values, n);
+        }
+        if (section_C) {
+            shallow<Stack<T>>(out, values, n);
+            shallow<ArrayStack<T>>(out, values, n);
+            shallow<SmallStack<T, shallowDepth>>(out, values, n);
+            shallow<std::stack<T>>(out, values, n);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Stack Backend Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(7, 8);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+    benchType<payload64>(out, maxExponent);
+
+    return 0;
+}
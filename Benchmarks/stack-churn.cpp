@@ -0,0 +1,161 @@
+/**
+ * Created on October 19, 2026. Benchmarks the heap
+ * traffic and latency distribution of push/pull churn on
+ * the pooled Stack<T>, against a node-per-push stack
+ * (std::stack over std::list) and the contiguous ArrayStack<T>.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 stack-churn.cpp -o stack-churn
+ * and run as
+ *     ./stack-churn [output file]
+ *
+ * Each stack is first filled to a resting depth of 10^2 up to
+ * the chosen power of ten (at most 10^7) and then churned:
+ * bursts of pushes followed by as many pulls. Every global
+ * operator new during the churn is counted, and each burst is
+ * timed so percentiles of the per-operation latency can be
+ * reported. Results are written as JSON lines to
+ * bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Stack/stack.h"
+#include "../Stack/array-stack.h"
+#include <list>
+#include <new>
+#include <stack>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Short bursts (8 pushes, 8 pulls)
+const bool section_B = true; // Long bursts (256 pushes, 256 pulls)
+
+/** Operations timed per churn run */
+const size_t churnOps = 1 << 20;
+
+// Allocation Counting –––––––––––––––––––––––––––––––––––
+
+/** Number of calls to the global operator new */
+static size_t heapAllocations = 0;
+
+/**
+ * Counts the call and takes the memory from the library's aligned
+ * operator new, which the deletes below hand it back to, so every
+ * block is freed by the function matching its allocation
+ */
+void* operator new(size_t bytes) {
+    heapAllocations++;
+    return operator new(bytes, std::align_val_t(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+}
+
+void operator delete(void* memory) noexcept {
+    operator delete(memory, std::align_val_t(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    operator delete(memory, std::align_val_t(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+}
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+using listStack = std::stack<T, std::list<T>>;
+
+template <typename T>
+void pull(Stack<T>& stk) { keep(stk.pull()); }
+
+template <typename T>
+void pull(ArrayStack<T>& stk) { keep(stk.pull()); }
+
+template <typename T>
+void pull(listStack<T>& stk) { keep(stk.top()); stk.pop(); }
+
+template <typename T>
+const char* containerName(const Stack<T>&) { return "Stack"; }
+
+template <typename T>
+const char* containerName(const ArrayStack<T>&) { return "ArrayStack"; }
+
+template <typename T>
+const char* containerName(const listStack<T>&) { return "std::stack<list>"; }
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Fills a stack to the given depth, then performs churnOps
+ * operations in bursts of the given length, recording heap
+ * allocations per operation and per-burst latency percentiles
+ */
+template <typename Container, typename T>
+void churn(benchWriter& out, const char* operation, const std::vector<T>& values,
+           size_t depth, size_t burst) {
+    using clock = std::chrono::steady_clock;
+    Container stk;
+    for (size_t i = 0; i < depth; i++) {
+        stk.push(values[i % values.size()]);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(churnOps / (2 * burst));
+    size_t allocationsBefore = heapAllocations;
+    for (size_t done = 0; done < churnOps; done += 2 * burst) {
+        clock::time_point start = clock::now();
+        for (size_t i = 0; i < burst; i++) {
+            stk.push(values[(done + i) % values.size()]);
+        }
+        for (size_t i = 0; i < burst; i++) {
+            pull(stk);
+        }
+        samples.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count() / (2 * burst));
+    }
+    double allocsPerOp = double(heapAllocations - allocationsBefore) / churnOps;
+
+    double p50 = percentile(samples, 0.5);
+    double p99 = percentile(samples, 0.99);
+    double p999 = percentile(samples, 0.999);
+    out.recordLatency("stack-churn", operation, containerName(stk), typeName<T>(), depth,
+                      allocsPerOp, p50, p99, p999);
+}
+
+/**
+ * Runs every enabled section for one element type
+ */
+template <typename T>
+void benchType(benchWriter& out, int maxExponent) {
+    std::vector<T> values;
+    for (size_t i = 0; i < 4096; i++) {
+        values.push_back(makeValue<T>(i));
+    }
+
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    for (size_t depth = 100; depth <= largest; depth *= 10) {
+        if (section_A) {
+            churn<Stack<T>>(out, "burst-8", values, depth, 8);
+            churn<listStack<T>>(out, "burst-8", values, depth, 8);
+            churn<ArrayStack<T>>(out, "burst-8", values, depth, 8);
+        }
+        if (section_B) {
+            churn<Stack<T>>(out, "burst-256", values, depth, 256);
+            churn<listStack<T>>(out, "burst-256", values, depth, 256);
+            churn<ArrayStack<T>>(out, "burst-256", values, depth, 256);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Stack Churn Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(6, 7);
+    if (maxExponent < 2) maxExponent = 2;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchType<int>(out, maxExponent);
+    benchType<std::string>(out, maxExponent);
+    benchType<payload64>(out, maxExponent);
+
+    return 0;
+}
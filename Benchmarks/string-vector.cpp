@@ -0,0 +1,147 @@
+/**
+ * Created on October 19, 2026. Benchmarks comparing StringVector,
+ * which packs every string into one character blob, with
+ * Vector<std::string>, which holds a heap string per element.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 string-vector.cpp -o string-vector
+ * and run as
+ *     ./string-vector [output file]
+ *
+ * Each list is built by addBack, copied, scanned front to back,
+ * and sorted, at sizes 10^3 up to the chosen power of ten (at
+ * most 10^7). Both short strings, which std::string keeps inline,
+ * and long ones, which it allocates, are measured. Results are
+ * written as JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../Vector/string-vector.h"
+#include <string>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Build by addBack
+const bool section_B = true; // Copy
+const bool section_C = true; // Scan
+const bool section_D = true; // Sort
+
+// Container Adapters ––––––––––––––––––––––––––––––––––––
+
+struct stringVectorAdapter {
+    StringVector list;
+
+    static const char* name() { return "StringVector"; }
+    void addBack(const std::string& text) { list.addBack(text); }
+    size_t size() const { return list.size(); }
+    size_t lengthAt(size_t i) const { return list[i].size(); }
+    void sort() { list.sort(); }
+};
+
+struct vectorAdapter {
+    Vector<std::string> list;
+
+    static const char* name() { return "Vector<std::string>"; }
+    void addBack(const std::string& text) { list.addBack(text); }
+    size_t size() const { return list.size(); }
+    size_t lengthAt(size_t i) const { return list[i].size(); }
+    void sort() { std::sort(list.begin(), list.end()); }
+};
+
+/**
+ * The i-th string, scattered so the lists start unsorted; short
+ * strings fit in std::string's inline buffer, long ones do not
+ */
+std::string textAt(size_t i, bool longText) {
+    size_t scattered = (i * 2654435761u) & 0x7FFFFFFF;
+    return longText ? makeValue<std::string>(scattered) : std::to_string(scattered);
+}
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Returns a list holding the first n strings
+ */
+template <typename Adapter>
+Adapter filled(const std::vector<std::string>& texts, size_t n) {
+    Adapter list;
+    for (size_t i = 0; i < n; i++) {
+        list.addBack(texts[i]);
+    }
+    return list;
+}
+
+/**
+ * Runs every enabled section for one container at one size
+ */
+template <typename Adapter>
+void benchContainer(benchWriter& out, const std::vector<std::string>& texts, size_t n, const char* type) {
+    size_t repetitions = repetitionsFor(n);
+    if (section_A) {
+        double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+            Adapter list = filled<Adapter>(texts, n);
+            keep(list.size());
+        });
+        out.record("string-vector", "build", Adapter::name(), type, n, n, ns);
+    }
+
+    Adapter list = filled<Adapter>(texts, n);
+    if (section_B) {
+        double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+            Adapter copy = list;
+            keep(copy.size());
+        });
+        out.record("string-vector", "copy", Adapter::name(), type, n, n, ns);
+    }
+    if (section_C) {
+        size_t total = 0;
+        double ns = measure(repetitions, [] { return 0; }, [&](int&) {
+            for (size_t i = 0; i < n; i++) {
+                total += list.lengthAt(i);
+            }
+        });
+        keep(total);
+        out.record("string-vector", "scan", Adapter::name(), type, n, n, ns);
+    }
+    if (section_D) {
+        double ns = measure(repetitions, [&] { return list; }, [](Adapter& unsorted) {
+            unsorted.sort();
+        });
+        out.record("string-vector", "sort", Adapter::name(), type, n, n, ns);
+    }
+}
+
+/**
+ * Runs both containers over one string length
+ */
+void benchLength(benchWriter& out, int maxExponent, bool longText) {
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    std::vector<std::string> texts;
+    texts.reserve(largest);
+    for (size_t i = 0; i < largest; i++) {
+        texts.push_back(textAt(i, longText));
+    }
+
+    const char* type = longText ? "long-string" : "short-string";
+    for (size_t n = 1000; n <= largest; n *= 10) {
+        benchContainer<stringVectorAdapter>(out, texts, n, type);
+        benchContainer<vectorAdapter>(out, texts, n, type);
+    }
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning String Vector Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(5, 7);
+    if (maxExponent < 3) maxExponent = 3;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+
+    benchLength(out, maxExponent, false);
+    benchLength(out, maxExponent, true);
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+/**
+ * Created on October 19, 2026. Benchmarks a small task
+ * scheduler built on WorkStealingDeque<T> against the same
+ * scheduler sharing one mutex-guarded global queue, on
+ * recursive fib and parallel quicksort, across thread counts.
+ *
+ * Build with optimizations, for example
+ *     g++ -std=c++17 -O2 -pthread work-stealing.cpp -o work-stealing
+ * and run as
+ *     ./work-stealing [output file]
+ *
+ * fib(n) spawns two tasks per call above a serial cutoff,
+ * and quicksort spawns a task per partition above a cutoff,
+ * so both produce many small tasks. Thread counts double from
+ * one up to the number of hardware threads. Results are
+ * written as JSON lines to bench_output.txt by default.
+ */
+#include "benchmark.h"
+#include "../CircularBuffer/work-stealing-deque.h"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <thread>
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Benchmark Settings
+const bool section_A = true; // Recursive fib
+const bool section_B = true; // Parallel quicksort
+
+/** fib is computed serially below this argument */
+const int fibCutoff = 12;
+
+/** Ranges shorter than this are sorted serially */
+const size_t sortCutoff = 2048;
+
+// Tasks –––––––––––––––––––––––––––––––––––––––––––––––––
+
+class scheduler;
+
+/**
+ * A unit of work. A task that spawns children finishes when
+ * the last of them does, which then finishes its parent.
+ */
+struct task {
+    task* parent;
+    std::atomic<int> pending;
+
+    explicit task(task* parent) : parent(parent), pending(0) { }
+    virtual ~task() { }
+
+    /** Does the work, spawning children through the scheduler */
+    virtual void run(scheduler& pool, int worker) = 0;
+
+    /** Called once the task and all of its children are done */
+    virtual void finish() { }
+};
+
+/**
+ * Worker threads that run tasks until the root task finishes,
+ * either from one deque per worker with stealing or from one
+ * global queue
+ */
+class scheduler {
+public:
+    scheduler(int threads, bool stealing) :
+        _threads(threads), _stealing(stealing), _done(false) {
+        for (int i = 0; i < threads; i++) {
+            _deques.emplace_back(new WorkStealingDeque<task*>());
+        }
+    }
+
+    ~scheduler() {
+        for (WorkStealingDeque<task*>* deque : _deques) delete deque;
+    }
+
+    /** Runs the root task to completion on every worker */
+    void run(task* root) {
+        _done.store(false);
+        spawn(root, 0);
+        std::vector<std::thread> workers;
+        for (int t = 1; t < _threads; t++) {
+            workers.emplace_back([this, t] { work(t); });
+        }
+        work(0);
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    /** Makes a task runnable from the given worker */
+    void spawn(task* job, int worker) {
+        if (_stealing) {
+            _deques[worker]->push(job);
+        } else {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _global.push_back(job);
+        }
+    }
+
+    /** Marks a task done, finishing its parent with its last child */
+    void complete(task* job) {
+        while (job != nullptr) {
+            job->finish();
+            task* parent = job->parent;
+            delete job;
+            if (parent == nullptr) {
+                _done.store(true);
+                return;
+            }
+            if (parent->pending.fetch_sub(1) != 1) {
+                return;
+            }
+            job = parent;
+        }
+    }
+
+private:
+    int _threads;
+    bool _stealing;
+    std::atomic<bool> _done;
+    std::vector<WorkStealingDeque<task*>*> _deques;
+    std::mutex _mutex;
+    std::deque<task*> _global;
+
+    task* next(int worker, std::minstd_rand& random) {
+        if (!_stealing) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_global.empty()) return nullptr;
+            task* job = _global.back();
+            _global.pop_back();
+            return job;
+        }
+        if (std::optional<task*> job = _deques[worker]->pop()) {
+            return *job;
+        }
+        if (_threads > 1) {
+            int victim = random() % (_threads - 1);
+            if (victim >= worker) victim++;
+            if (std::optional<task*> job = _deques[victim]->steal()) {
+                return *job;
+            }
+        }
+        return nullptr;
+    }
+
+    void work(int worker) {
+        std::minstd_rand random(worker + 1);
+        while (!_done.load(std::memory_order_relaxed)) {
+            if (task* job = next(worker, random)) {
+                job->pending.store(1);
+                job->run(*this, worker);
+                // the task's own share of pending; children hold the rest
+                if (job->pending.fetch_sub(1) == 1) {
+                    complete(job);
+                }
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+long serialFib(int n) {
+    return n < 2 ? n : serialFib(n - 1) + serialFib(n - 2);
+}
+
+/**
+ * Computes fib(n) by spawning fib(n - 1) and fib(n - 2)
+ */
+struct fibTask : task {
+    int n;
+    std::atomic<long> sum;
+    long* out;
+
+    fibTask(task* parent, int n, long* out) : task(parent), n(n), sum(0), out(out) { }
+
+    void run(scheduler& pool, int worker) override {
+        if (n < fibCutoff) {
+            sum.store(serialFib(n));
+            return;
+        }
+        pending.fetch_add(2);
+        pool.spawn(new fibTask(this, n - 1, nullptr), worker);
+        pool.spawn(new fibTask(this, n - 2, nullptr), worker);
+    }
+
+    void finish() override {
+        if (parent != nullptr) {
+            static_cast<fibTask*>(parent)->sum.fetch_add(sum.load());
+        } else {
+            *out = sum.load();
+        }
+    }
+};
+
+/**
+ * Sorts [first, last) by partitioning and spawning both halves
+ */
+struct sortTask : task {
+    int* first;
+    int* last;
+
+    sortTask(task* parent, int* first, int* last) : task(parent), first(first), last(last) { }
+
+    void run(scheduler& pool, int worker) override {
+        if (size_t(last - first) < sortCutoff) {
+            std::sort(first, last);
+            return;
+        }
+        int pivot = *(first + (last - first) / 2);
+        int* middle = std::partition(first, last, [pivot](int value) { return value < pivot; });
+        int* upper = std::partition(middle, last, [pivot](int value) { return !(pivot < value); });
+        pending.fetch_add(2);
+        pool.spawn(new sortTask(this, first, middle), worker);
+        pool.spawn(new sortTask(this, upper, last), worker);
+    }
+};
+
+// Workloads –––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * Computes fib(n) and records the time per spawned task
+ */
+void fib(benchWriter& out, int n, int threads, bool stealing) {
+    long result = 0;
+    double ns = measure(1, [] { return 0; }, [&](int&) {
+        scheduler pool(threads, stealing);
+        pool.run(new fibTask(nullptr, n, &result));
+    });
+    if (result != serialFib(n)) {
+        cout << "fib failed\n";
+    }
+    size_t tasks = 2 * size_t(serialFib(n - fibCutoff + 2)) - 1;
+    std::string operation = "fib-t" + std::to_string(threads);
+    out.record("work-stealing", operation.c_str(), stealing ? "WorkStealingDeque" : "global-queue",
+               "task", n, tasks, ns);
+}
+
+/**
+ * Sorts n shuffled integers and records the time per element
+ */
+void quicksort(benchWriter& out, size_t n, int threads, bool stealing) {
+    std::vector<int> values(n);
+    double ns = measure(1, [&] {
+        std::minstd_rand random(7);
+        for (size_t i = 0; i < n; i++) values[i] = static_cast<int>(random());
+        return 0;
+    }, [&](int&) {
+        scheduler pool(threads, stealing);
+        pool.run(new sortTask(nullptr, values.data(), values.data() + n));
+    });
+    if (!std::is_sorted(values.begin(), values.end())) {
+        cout << "quicksort failed\n";
+    }
+    std::string operation = "quicksort-t" + std::to_string(threads);
+    out.record("work-stealing", operation.c_str(), stealing ? "WorkStealingDeque" : "global-queue",
+               "int", n, n, ns);
+}
+
+int main(int argc, char** argv) {
+    cout << BOLD << "Beginning Work-Stealing Benchmarks..." << RESET << endl;
+    cout << endl;
+
+    int maxExponent = askMaxExponent(7, 8);
+    if (maxExponent < 4) maxExponent = 4;
+    benchWriter out(argc > 1 ? argv[1] : "bench_output.txt");
+    int hardware = std::thread::hardware_concurrency();
+    if (hardware < 1) hardware = 1;
+
+    size_t largest = 1;
+    for (int e = 0; e < maxExponent; e++) largest *= 10;
+    for (int threads = 1; threads <= hardware; threads *= 2) {
+        for (bool stealing : {true, false}) {
+            if (section_A) {
+                fib(out, 30, threads, stealing);
+            }
+            if (section_B) {
+                quicksort(out, largest, threads, stealing);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,304 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the BII CircularBuffer class
+ */
+#pragma once
+#include <stdexcept>
+#include "circular-buffer.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+size_t CircularBuffer<T>::roundUp(size_t value) {
+    size_t power = 1;
+    while (power < value) {
+        power <<= 1;
+    }
+    return power;
+}
+
+template <typename T>
+inline size_t CircularBuffer<T>::slot(const size_t index) const {
+    return (_head + index) & (_capacity - 1);
+}
+
+template <typename T>
+void CircularBuffer<T>::expand(size_t amount) {
+    T* newArray = Storage<T>::allocate(amount);
+    Span<T> first = firstSpan();
+    Span<T> second = secondSpan();
+    Storage<T>::relocate(first.begin(), first.end(), newArray);
+    Storage<T>::relocate(second.begin(), second.end(), newArray + first.size());
+    Storage<T>::deallocate(_elements, _capacity);
+    _elements = newArray;
+    _head = 0;
+    _capacity = amount;
+}
+
+template <typename T>
+void CircularBuffer<T>::makeRoom(const char* caller) {
+    if (_size < _capacity) {
+        return;
+    }
+    if (!_growable) {
+        cout << caller << " failed\n";
+        BII_THROW(full_buffer());
+    }
+    expand(_capacity == 0 ? 1 : _capacity * 2);
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+CircularBuffer<T>::CircularBuffer(const size_t givenCapacity, const bool growable) :
+    _elements(Storage<T>::allocate(roundUp(givenCapacity))),
+    _head(0),
+    _size(0),
+    _capacity(roundUp(givenCapacity)),
+    _growable(growable) { }
+
+template <typename T>
+CircularBuffer<T>::CircularBuffer(const CircularBuffer<T>& given) :
+    _elements(Storage<T>::allocate(given._capacity)),
+    _head(0),
+    _size(0),
+    _capacity(given._capacity),
+    _growable(given._growable) {
+    Span<const T> first = given.firstSpan();
+    Span<const T> second = given.secondSpan();
+    Storage<T>::copy(first.begin(), first.end(), _elements);
+    _size = first.size();
+    Storage<T>::copy(second.begin(), second.end(), _elements + _size);
+    _size += second.size();
+}
+
+template <typename T>
+CircularBuffer<T>::CircularBuffer(CircularBuffer<T>&& given) :
+    _elements(given._elements),
+    _head(given._head),
+    _size(given._size),
+    _capacity(given._capacity),
+    _growable(given._growable) {
+    given._elements = nullptr;
+    given._head = 0;
+    given._size = 0;
+    given._capacity = 0;
+}
+
+template <typename T>
+CircularBuffer<T>::~CircularBuffer() {
+    clear();
+    Storage<T>::deallocate(_elements, _capacity);
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t CircularBuffer<T>::size() const {
+    return _size;
+}
+
+template <typename T>
+inline bool CircularBuffer<T>::empty() const {
+    return _size == 0;
+}
+
+template <typename T>
+inline bool CircularBuffer<T>::full() const {
+    return _size == _capacity;
+}
+
+template <typename T>
+inline size_t CircularBuffer<T>::capacity() const {
+    return _capacity;
+}
+
+template <typename T>
+inline bool CircularBuffer<T>::growable() const {
+    return _growable;
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::pushBack(const T& value) {
+    if (full()) {
+        // value may live in the array that makeRoom releases
+        return pushBack(T(value));
+    }
+    Storage<T>::construct(_elements + slot(_size), value);
+    _size++;
+    return *this;
+}
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::pushBack(T&& value) {
+    makeRoom("pushBack");
+    Storage<T>::construct(_elements + slot(_size), move(value));
+    _size++;
+    return *this;
+}
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::pushFront(const T& value) {
+    if (full()) {
+        return pushFront(T(value));
+    }
+    size_t newHead = (_head + _capacity - 1) & (_capacity - 1);
+    Storage<T>::construct(_elements + newHead, value);
+    _head = newHead;
+    _size++;
+    return *this;
+}
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::pushFront(T&& value) {
+    makeRoom("pushFront");
+    size_t newHead = (_head + _capacity - 1) & (_capacity - 1);
+    Storage<T>::construct(_elements + newHead, move(value));
+    _head = newHead;
+    _size++;
+    return *this;
+}
+
+template <typename T>
+T CircularBuffer<T>::popBack() {
+    if (empty()) {
+        cout << "popBack failed\n";
+        BII_THROW(empty_buffer());
+    }
+    T* last = _elements + slot(_size - 1);
+    T element(move(*last));
+    Storage<T>::destroy(last, last + 1);
+    _size--;
+    return element;
+}
+
+template <typename T>
+T CircularBuffer<T>::popFront() {
+    if (empty()) {
+        cout << "popFront failed\n";
+        BII_THROW(empty_buffer());
+    }
+    T* first = _elements + _head;
+    T element(move(*first));
+    Storage<T>::destroy(first, first + 1);
+    _head = slot(1);
+    _size--;
+    return element;
+}
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::clear() {
+    Span<T> first = firstSpan();
+    Span<T> second = secondSpan();
+    Storage<T>::destroy(first.begin(), first.end());
+    Storage<T>::destroy(second.begin(), second.end());
+    _head = 0;
+    _size = 0;
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+T& CircularBuffer<T>::check(const size_t index) {
+    return const_cast<T&>(static_cast<const CircularBuffer<T>*>(this)->check(index));
+}
+
+template <typename T>
+const T& CircularBuffer<T>::check(const size_t index) const {
+    if (index >= _size) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of buffer"));
+    }
+    return _elements[slot(index)];
+}
+
+template <typename T>
+T& CircularBuffer<T>::front() {
+    return const_cast<T&>(static_cast<const CircularBuffer<T>*>(this)->front());
+}
+
+template <typename T>
+const T& CircularBuffer<T>::front() const {
+    if (empty()) {
+        cout << "front failed\n";
+        BII_THROW(empty_buffer());
+    }
+    return _elements[_head];
+}
+
+template <typename T>
+T& CircularBuffer<T>::back() {
+    return const_cast<T&>(static_cast<const CircularBuffer<T>*>(this)->back());
+}
+
+template <typename T>
+const T& CircularBuffer<T>::back() const {
+    if (empty()) {
+        cout << "back failed\n";
+        BII_THROW(empty_buffer());
+    }
+    return _elements[slot(_size - 1)];
+}
+
+template <typename T>
+Span<T> CircularBuffer<T>::firstSpan() {
+    size_t length = _capacity - _head < _size ? _capacity - _head : _size;
+    return Span<T>(_elements + _head, length);
+}
+
+template <typename T>
+Span<T> CircularBuffer<T>::secondSpan() {
+    size_t length = _capacity - _head < _size ? _size - (_capacity - _head) : 0;
+    return Span<T>(_elements, length);
+}
+
+template <typename T>
+Span<const T> CircularBuffer<T>::firstSpan() const {
+    Span<T> span = const_cast<CircularBuffer<T>*>(this)->firstSpan();
+    return Span<const T>(span.data(), span.size());
+}
+
+template <typename T>
+Span<const T> CircularBuffer<T>::secondSpan() const {
+    Span<T> span = const_cast<CircularBuffer<T>*>(this)->secondSpan();
+    return Span<const T>(span.data(), span.size());
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+T& CircularBuffer<T>::operator[](const size_t index) {
+    return check(index);
+}
+
+template <typename T>
+const T& CircularBuffer<T>::operator[](const size_t index) const {
+    return check(index);
+}
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::operator=(const CircularBuffer<T>& assign) {
+    if (&assign == this) return *this;
+    CircularBuffer<T> copy(assign);
+    return *this = move(copy);
+}
+
+template <typename T>
+CircularBuffer<T>& CircularBuffer<T>::operator=(CircularBuffer<T>&& assign) {
+    if (&assign == this) return *this;
+    clear();
+    Storage<T>::deallocate(_elements, _capacity);
+    _elements = assign._elements;
+    _head = assign._head;
+    _size = assign._size;
+    _capacity = assign._capacity;
+    _growable = assign._growable;
+    assign._elements = nullptr;
+    assign._head = 0;
+    assign._size = 0;
+    assign._capacity = 0;
+    return *this;
+}
@@ -0,0 +1,271 @@
+/**
+ * Created on October 19, 2026. CircularBuffer<T> is
+ * a ring buffer over contiguous storage, for use in
+ * projects by BII.
+ *
+ * Elements can be pushed and popped at either end in
+ * O(1). The capacity is always a power of two, so wrapping
+ * an index is a mask rather than a division. A fixed buffer
+ * throws full_buffer when it runs out of room; a growable
+ * one doubles its storage the same way Vector<T> does,
+ * relocating the elements through Storage<T>.
+ *
+ * The contents are at most two contiguous runs, exposed
+ * through firstSpan and secondSpan for bulk processing.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added CircularBuffer with push/pop at both ends, indexed
+ * access, and two-span views.
+ *
+ * @version 1.0.1: October 19, 2026
+ * Moved empty_buffer to Exceptions/exception.h and routed every
+ * throw through BII_THROW, so the buffer builds with -fno-exceptions.
+ */
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <exception>
+#include "../Exceptions/exception.h"
+#include "../Vector/vector.h"
+#include "../Span/span.h"
+
+using std::cout;
+using std::endl;
+using std::move;
+
+template <typename T>
+class CircularBuffer {
+public:
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty buffer with room for at least the given
+     * number of elements (rounded up to a power of two). A
+     * growable buffer doubles when full; a fixed one throws.
+     */
+    explicit CircularBuffer(const size_t givenCapacity, const bool growable = false);
+
+    /**
+     * Copy Constructor
+     */
+    CircularBuffer(const CircularBuffer<T>& given);
+
+    /**
+     * Move Constructor
+     */
+    CircularBuffer(CircularBuffer<T>&& given);
+
+    /**
+     * Destroys the elements and frees the storage
+     */
+    ~CircularBuffer();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the buffer
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the buffer is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns true if the buffer has no open slots
+     * O(1) asymptotic complexity
+     */
+    inline bool full() const;
+
+    /**
+     * Returns the current capacity of the buffer
+     * O(1) asymptotic complexity
+     */
+    inline size_t capacity() const;
+
+    /**
+     * Returns true if the buffer grows when full
+     * O(1) asymptotic complexity
+     */
+    inline bool growable() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the back of the buffer
+     * Throws an error if a fixed buffer is full
+     * O(1) asymptotic complexity (amortized when growable)
+     */
+    CircularBuffer<T>& pushBack(const T& value);
+
+    /**
+     * Adds an r-value element to the back of the buffer
+     * Throws an error if a fixed buffer is full
+     * O(1) asymptotic complexity (amortized when growable)
+     */
+    CircularBuffer<T>& pushBack(T&& value);
+
+    /**
+     * Adds an l-value element to the front of the buffer
+     * Throws an error if a fixed buffer is full
+     * O(1) asymptotic complexity (amortized when growable)
+     */
+    CircularBuffer<T>& pushFront(const T& value);
+
+    /**
+     * Adds an r-value element to the front of the buffer
+     * Throws an error if a fixed buffer is full
+     * O(1) asymptotic complexity (amortized when growable)
+     */
+    CircularBuffer<T>& pushFront(T&& value);
+
+    /**
+     * Returns and removes the element at the back of the buffer
+     * Throws an error if the buffer is empty
+     * O(1) asymptotic complexity
+     */
+    T popBack();
+
+    /**
+     * Returns and removes the element at the front of the buffer
+     * Throws an error if the buffer is empty
+     * O(1) asymptotic complexity
+     */
+    T popFront();
+
+    /**
+     * Destroys every element, keeping the capacity
+     * O(n) asymptotic complexity
+     */
+    CircularBuffer<T>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a reference to the element a given distance
+     * from the front
+     * Throws an error for invalid indexes
+     */
+    T& check(const size_t index);
+
+    /**
+     * Returns the element a given distance from the front
+     * Throws an error for invalid indexes
+     */
+    const T& check(const size_t index) const;
+
+    /**
+     * Returns a reference to the front element
+     * Throws an error if the buffer is empty
+     */
+    T& front();
+
+    /**
+     * Returns the front element
+     * Throws an error if the buffer is empty
+     */
+    const T& front() const;
+
+    /**
+     * Returns a reference to the back element
+     * Throws an error if the buffer is empty
+     */
+    T& back();
+
+    /**
+     * Returns the back element
+     * Throws an error if the buffer is empty
+     */
+    const T& back() const;
+
+    /**
+     * Returns the run of elements starting at the front,
+     * up to the end of the underlying array
+     */
+    Span<T> firstSpan();
+
+    /**
+     * Returns the wrapped-around run of elements at the
+     * start of the underlying array (empty if none)
+     */
+    Span<T> secondSpan();
+
+    /**
+     * Const versions of firstSpan and secondSpan
+     */
+    Span<const T> firstSpan() const;
+    Span<const T> secondSpan() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a reference to the element a given distance
+     * from the front
+     */
+    T& operator[](const size_t index);
+
+    /**
+     * Returns the element a given distance from the front
+     */
+    const T& operator[](const size_t index) const;
+
+    /**
+     * Copy Assignment
+     */
+    CircularBuffer<T>& operator=(const CircularBuffer<T>& assign);
+
+    /**
+     * Move Assignment
+     */
+    CircularBuffer<T>& operator=(CircularBuffer<T>&& assign);
+
+protected:
+    /* the underlying array */
+    T* _elements;
+
+    /* the index of the front element */
+    size_t _head;
+
+    /* the current number of elements */
+    size_t _size;
+
+    /* the length of the underlying array, a power of two */
+    size_t _capacity;
+
+    /* true if the buffer doubles when full */
+    bool _growable;
+
+    /**
+     * Returns the array slot of the element a given
+     * distance from the front
+     */
+    inline size_t slot(const size_t index) const;
+
+    /**
+     * Makes room for one more element, growing or
+     * throwing when the buffer is full
+     */
+    void makeRoom(const char* caller);
+
+    /**
+     * Moves the elements into a new underlying array of
+     * the given power-of-two length, front first
+     */
+    void expand(size_t amount);
+
+    /**
+     * Returns the smallest power of two no less than value
+     */
+    static size_t roundUp(size_t value);
+};
+
+/**
+ * Exception handler for adding to a full
+ * fixed-capacity buffer
+ */
+struct full_buffer : public std::exception {
+    const char * what () const throw () {
+        return "Trying to add to a full buffer";
+    }
+};
+
+#include "circular-buffer.cpp"
@@ -0,0 +1,33 @@
+/**
+ * Created on October 19, 2026. Deque<T> is a
+ * double-ended queue for use in projects by BII.
+ *
+ * It is a CircularBuffer<T> that always grows: push
+ * and pop at either end are O(1) (amortized for pushes),
+ * and the contents stay in at most two contiguous runs.
+ * Use it instead of Vector<T>::remove(begin()) for FIFO
+ * work, which shifts the whole vector on every pop.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added Deque on top of CircularBuffer.
+ */
+#pragma once
+#include "circular-buffer.h"
+
+template <typename T>
+class Deque : public CircularBuffer<T> {
+public:
+
+    /**
+     * Default Constructor
+     * Creates an empty deque with room for initialCapacity
+     * elements (rounded up to a power of two)
+     */
+    Deque() : CircularBuffer<T>(initialCapacity, true) { }
+
+    /**
+     * Creates an empty deque with room for at least the
+     * given number of elements before it first grows
+     */
+    explicit Deque(const size_t givenCapacity) : CircularBuffer<T>(givenCapacity, true) { }
+};
@@ -0,0 +1,271 @@
+/**
+ * Created on October 19, 2026. Testing harness
+ * for the CircularBuffer<T> and Deque<T> classes.
+ */
+#include "deque.h"
+#include "work-stealing-deque.h"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Test Settings
+const bool section_A = true; // Constructors/Destructor (3 Methods)
+const bool section_B = true; // Fixed Buffers (4 Methods)
+const bool section_C = true; // Deque Modifiers (4 Methods)
+const bool section_D = true; // Spans (2 Methods)
+const bool section_E = true; // Work-Stealing Deque (3 Methods, run under -fsanitize=thread)
+
+/**
+ * Given two values, returns true if they are equal
+ * as the type of the first
+ */
+template <typename T, typename S>
+bool expectEqual(T first, S second) {
+    return first == static_cast<T>(second);
+}
+
+/**
+ * Prints and counts the outcome of a single test
+ */
+void report(const char* name, bool passed, int& numTestsPassed, int& numTestsFailed) {
+    if (passed) {
+        cout << name << " : PASSED" << endl;
+        numTestsPassed++;
+    } else {
+        cout << name << " : FAILED" << endl;
+        numTestsFailed++;
+    }
+}
+
+/**
+ * Macro for testing CircularBuffer Constructor/Destructor methods
+ */
+void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
+    CircularBuffer<int> buffer(size);
+    report("Capacity Rounding", buffer.capacity() >= static_cast<size_t>(size) &&
+           (buffer.capacity() & (buffer.capacity() - 1)) == 0, numTestsPassed, numTestsFailed);
+
+    Deque<std::string> deque;
+    for (int i = 0; i < size; i++) {
+        deque.pushBack(std::to_string(i));
+        deque.popFront();
+        deque.pushBack(std::to_string(i));
+    }
+    Deque<std::string> copy(deque);
+    report("Copy Constructor", expectEqual(copy.size(), deque.size()) &&
+           expectEqual(copy.back(), deque.back()) && expectEqual(copy.front(), deque.front()),
+           numTestsPassed, numTestsFailed);
+
+    Deque<std::string> moved(std::move(copy));
+    report("Move Constructor", expectEqual(moved.size(), deque.size()) && copy.empty(),
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing fixed CircularBuffer methods
+ */
+void testB(const int size, int& numTestsPassed, int& numTestsFailed) {
+    CircularBuffer<int> buffer(8);
+    for (int i = 0; i < 8; i++) {
+        buffer.pushBack(i);
+    }
+    report("Full", buffer.full(), numTestsPassed, numTestsFailed);
+
+    bool threw = false;
+    try {
+        buffer.pushBack(8);
+    } catch (const full_buffer&) {
+        threw = true;
+    }
+    report("PushBack (full)", threw && expectEqual(buffer.size(), 8), numTestsPassed, numTestsFailed);
+
+    // wrap the buffer around many times
+    bool inOrder = true;
+    for (int i = 8; i < size + 8; i++) {
+        inOrder = inOrder && expectEqual(buffer.popFront(), i - 8);
+        buffer.pushBack(i);
+    }
+    report("Wrap Around", inOrder && expectEqual(buffer.capacity(), 8), numTestsPassed, numTestsFailed);
+    report("Indexing", expectEqual(buffer[0], size) && expectEqual(buffer[7], size + 7),
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing Deque Modifier methods
+ */
+void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
+    Deque<int> deque;
+    for (int i = 0; i < size; i++) {
+        deque.pushBack(i);
+        deque.pushFront(-i - 1);
+    }
+    report("PushBack/PushFront", expectEqual(deque.size(), 2 * size) &&
+           expectEqual(deque.front(), -size) && expectEqual(deque.back(), size - 1),
+           numTestsPassed, numTestsFailed);
+
+    bool ordered = true;
+    for (int i = 0; i < 2 * size; i++) {
+        ordered = ordered && expectEqual(deque[i], i - size);
+    }
+    report("Growth Keeps Order", ordered, numTestsPassed, numTestsFailed);
+
+    int back = deque.popBack();
+    int front = deque.popFront();
+    report("PopBack/PopFront", expectEqual(back, size - 1) && expectEqual(front, -size),
+           numTestsPassed, numTestsFailed);
+
+    size_t capacity = deque.capacity();
+    deque.clear();
+    report("Clear", deque.empty() && expectEqual(deque.capacity(), capacity), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing CircularBuffer Span methods
+ */
+void testD(const int size, int& numTestsPassed, int& numTestsFailed) {
+    CircularBuffer<int> buffer(size);
+    int capacity = buffer.capacity();
+    for (int i = 0; i < capacity; i++) {
+        buffer.pushBack(i);
+    }
+    for (int i = 0; i < capacity / 2; i++) {
+        buffer.popFront();
+        buffer.pushBack(capacity + i);
+    }
+    Span<int> first = buffer.firstSpan();
+    Span<int> second = buffer.secondSpan();
+    report("Span Sizes", expectEqual(first.size() + second.size(), buffer.size()) &&
+           expectEqual(first.size(), capacity - capacity / 2), numTestsPassed, numTestsFailed);
+
+    bool ordered = true;
+    int expected = capacity / 2;
+    for (int value : first) {
+        ordered = ordered && expectEqual(value, expected++);
+    }
+    for (int value : second) {
+        ordered = ordered && expectEqual(value, expected++);
+    }
+    report("Span Contents", ordered, numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing WorkStealingDeque methods
+ */
+void testE(const int size, int& numTestsPassed, int& numTestsFailed) {
+    WorkStealingDeque<int> deque(4);
+    for (int i = 0; i < size; i++) {
+        deque.push(i);
+    }
+    report("Push (growing)", expectEqual(deque.size(), size) && deque.capacity() >= static_cast<size_t>(size),
+           numTestsPassed, numTestsFailed);
+
+    // the owner pops the newest elements, thieves steal the oldest
+    std::optional<int> popped = deque.pop();
+    std::optional<int> stolen = deque.steal();
+    bool ends = popped && stolen && expectEqual(*popped, size - 1) && expectEqual(*stolen, 0);
+    while (deque.pop()) { }
+    report("Pop/Steal Ends", ends && deque.empty() && !deque.steal(), numTestsPassed, numTestsFailed);
+
+    // every element is taken exactly once while thieves race the owner
+    const int thieves = 3;
+    std::vector<std::vector<int>> taken(thieves + 1);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < thieves; t++) {
+        workers.emplace_back([&deque, &taken, &done, t] {
+            while (!done.load() || !deque.empty()) {
+                if (std::optional<int> value = deque.steal()) {
+                    taken[t].push_back(*value);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < size; i++) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (std::optional<int> value = deque.pop()) {
+                taken[thieves].push_back(*value);
+            }
+        }
+    }
+    while (std::optional<int> value = deque.pop()) {
+        taken[thieves].push_back(*value);
+    }
+    done.store(true);
+    for (std::thread& worker : workers) worker.join();
+    std::vector<int> seen(size, 0);
+    for (const std::vector<int>& values : taken) {
+        for (int value : values) seen[value]++;
+    }
+    bool exact = true;
+    for (int count : seen) exact = exact && count == 1;
+    report("Concurrent Steal", exact, numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Given the desired section and the appropriate information,
+ * performs the tests of that section
+ */
+void doTest(const char section, const bool option, const int size, int& numTestsPassed, int& numTestsFailed, void (*test)(const int, int&, int&)) {
+    cout << BOLD << "–––– Section " << section << " Tests ––––" << RESET << endl;
+    cout << endl;
+    if (option) {
+        (*test)(size, numTestsPassed, numTestsFailed);
+        cout << endl;
+    } else {
+        cout << "SKIP" << endl;
+        cout << endl;
+    }
+}
+
+int main() {
+    cout << BOLD << "Beginning CircularBuffer Tests..." << RESET << endl;
+    cout << endl;
+
+    cout << BOLD << "Section Key" << RESET << endl;
+    cout << "Section A : Constructors/Destructor" << endl;
+    cout << "Section B : Fixed Buffers" << endl;
+    cout << "Section C : Deque Modifiers" << endl;
+    cout << "Section D : Spans" << endl;
+    cout << "Section E : Work-Stealing Deque" << endl;
+    cout << endl;
+
+    // get testSize
+    int testSize = 0;
+    std::string response;
+    cout << "What is the desired test size (enter/return for default test size): ";
+    std::getline(std::cin, response);
+    if (response.empty()) {
+        testSize = 1000000;
+    } else {
+        testSize = stoi(response);
+    }
+    cout << endl;
+
+    // for use in testing
+    int numTestsFailed = 0;
+    int numTestsPassed = 0;
+
+    doTest('A', section_A, testSize, numTestsPassed, numTestsFailed, testA);
+    doTest('B', section_B, testSize, numTestsPassed, numTestsFailed, testB);
+    doTest('C', section_C, testSize, numTestsPassed, numTestsFailed, testC);
+    doTest('D', section_D, testSize, numTestsPassed, numTestsFailed, testD);
+    doTest('E', section_E, testSize, numTestsPassed, numTestsFailed, testE);
+
+    // Inform user as to which tests passed
+    if (!numTestsFailed) {
+        cout << BOLD << "Passed all " << numTestsPassed << " tests!" << RESET << endl;
+    } else {
+        cout << "Passed " << BOLD << numTestsPassed << RESET << " out of " << BOLD << numTestsPassed + numTestsFailed << RESET << " tests." << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the work-stealing-deque.h class
+ *
+ * The orderings follow Le, Pop, Cohen, and Zappa Nardelli,
+ * "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (2013), with the standalone fences folded into
+ * sequentially consistent loads and stores.
+ */
+#pragma once
+#include "work-stealing-deque.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename WorkStealingDeque<T>::ring* WorkStealingDeque<T>::grow(ring* old, int64_t top, int64_t bottom) {
+    ring* bigger = new ring(old->capacity * 2, old);
+    for (int64_t i = top; i < bottom; i++) {
+        bigger->put(i, old->get(i));
+    }
+    _ring.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(const size_t givenCapacity) :
+    _top(0),
+    _bottom(0),
+    _ring(nullptr) {
+    int64_t capacity = 1;
+    while (static_cast<size_t>(capacity) < givenCapacity) {
+        capacity *= 2;
+    }
+    _ring.store(new ring(capacity, nullptr));
+}
+
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+    ring* current = _ring.load();
+    while (current != nullptr) {
+        ring* retired = current->retired;
+        delete current;
+        current = retired;
+    }
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+bool WorkStealingDeque<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+size_t WorkStealingDeque<T>::size() const {
+    int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t top = _top.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+template <typename T>
+size_t WorkStealingDeque<T>::capacity() const {
+    return static_cast<size_t>(_ring.load(std::memory_order_relaxed)->capacity);
+}
+
+// Owner Operations ––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+void WorkStealingDeque<T>::push(const T& element) {
+    int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t top = _top.load(std::memory_order_acquire);
+    ring* current = _ring.load(std::memory_order_relaxed);
+    if (bottom - top > current->capacity - 1) {
+        current = grow(current, top, bottom);
+    }
+    current->put(bottom, element);
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::pop() {
+    int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    ring* current = _ring.load(std::memory_order_relaxed);
+    // claim the bottom slot before looking at top, so a thief
+    // either sees the claim or the owner sees the steal
+    _bottom.store(bottom, std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_seq_cst);
+
+    if (top > bottom) {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    T element = current->get(bottom);
+    if (top == bottom) {
+        // the last element: race the thieves for it
+        bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        if (!won) {
+            return std::nullopt;
+        }
+    }
+    return element;
+}
+
+// Thief Operations ––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::steal() {
+    int64_t top = _top.load(std::memory_order_seq_cst);
+    int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+    if (top >= bottom) {
+        return std::nullopt;
+    }
+    ring* current = _ring.load(std::memory_order_acquire);
+    T element = current->get(top);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return std::nullopt;
+    }
+    return element;
+}
@@ -0,0 +1,142 @@
+/**
+ * Created on October 19, 2026. WorkStealingDeque<T> is
+ * the Chase-Lev work-stealing deque, for task schedulers
+ * in projects by BII.
+ *
+ * One owner thread pushes and pops at the bottom, LIFO, so
+ * it keeps working on the tasks it made most recently. Any
+ * number of thief threads steal from the top, FIFO, taking the
+ * oldest (usually largest) tasks. The owner only synchronizes
+ * with thieves when one element is left; push never does.
+ *
+ * The elements sit in a power-of-two ring that the owner grows
+ * by doubling. A thief may still be reading the old ring, so
+ * outgrown rings are retired rather than freed and released by
+ * the destructor (their total size is below the current ring's).
+ *
+ * Elements are copied in and out of atomic slots, so T must be
+ * trivially copyable; store task pointers or indices.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added WorkStealingDeque with push, pop, steal, empty, size,
+ * and capacity.
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "elements are copied through atomic slots");
+public:
+
+    /** The capacity of a default-constructed deque */
+    static const size_t initialCapacity = 64;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty deque with room for at least the given
+     * number of elements (rounded up to a power of two)
+     */
+    explicit WorkStealingDeque(const size_t givenCapacity = initialCapacity);
+
+    /**
+     * Frees the ring and every retired ring.
+     * No thief may be using the deque.
+     */
+    ~WorkStealingDeque();
+
+    WorkStealingDeque(const WorkStealingDeque<T>&) = delete;
+    WorkStealingDeque<T>& operator=(const WorkStealingDeque<T>&) = delete;
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns true if the deque was empty when checked
+     * O(1) asymptotic complexity
+     */
+    bool empty() const;
+
+    /**
+     * Returns the number of elements when checked
+     * O(1) asymptotic complexity
+     */
+    size_t size() const;
+
+    /**
+     * Returns the number of elements the ring holds before
+     * it grows
+     * O(1) asymptotic complexity
+     */
+    size_t capacity() const;
+
+    // Owner Operations ––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an element at the bottom. Owner thread only.
+     * O(1) amortized asymptotic complexity (wait-free unless
+     * the ring grows)
+     */
+    void push(const T& element);
+
+    /**
+     * Removes and returns the element at the bottom, or nothing
+     * if the deque is empty or a thief took the last element.
+     * Owner thread only.
+     * O(1) asymptotic complexity
+     */
+    std::optional<T> pop();
+
+    // Thief Operations ––––––––––––––––––––––––––––––––––––––
+    /**
+     * Removes and returns the element at the top, or nothing if
+     * the deque is empty or another thread took it first. Any
+     * thread.
+     * O(1) asymptotic complexity (lock-free)
+     */
+    std::optional<T> steal();
+
+private:
+    /** A power-of-two array of slots */
+    struct ring {
+        /** The number of slots, a power of two */
+        int64_t capacity;
+        /** The slots */
+        std::atomic<T>* slots;
+        /** The ring this one replaced, kept until destruction */
+        ring* retired;
+
+        ring(int64_t capacity, ring* retired) :
+            capacity(capacity), slots(new std::atomic<T>[capacity]), retired(retired) { }
+
+        ~ring() {
+            delete [] slots;
+        }
+
+        T get(int64_t index) const {
+            return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t index, const T& element) {
+            slots[index & (capacity - 1)].store(element, std::memory_order_relaxed);
+        }
+    };
+
+    /** Index of the oldest element, advanced by steals */
+    std::atomic<int64_t> _top;
+
+    /** Index one past the newest element, moved by the owner */
+    std::atomic<int64_t> _bottom;
+
+    /** The current ring */
+    std::atomic<ring*> _ring;
+
+    /**
+     * Moves the elements in [top, bottom) into a ring twice
+     * the size and retires the old one. Owner thread only.
+     */
+    ring* grow(ring* old, int64_t top, int64_t bottom);
+};
+
+#include "work-stealing-deque.cpp"
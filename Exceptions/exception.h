@@ -1,24 +1,93 @@
-/** 
- * Created by Simon Camacho on 
+/**
+ * Created by Simon Camacho on
  * July 9, 2020. Exception.h is an
  * exception struct for use by BII
  * classes and projects
+ *
+ * @version 1.0.1: October 19, 2026
+ * Replaced the empty_container template, which did not compile,
+ * with a plain struct. empty_vector, empty_stack, empty_queue, and
+ * empty_buffer now live here and derive from it, so one handler
+ * can catch an empty access from any container. Every what() returns
+ * a string literal, so none of them allocate.
+ * Added BII_THROW, BII_TRY, BII_CATCH_ALL, and BII_RETHROW. Built
+ * with -fno-exceptions, BII_THROW prints the error and aborts,
+ * and the try/catch macros reduce to the try block alone.
 */
+#pragma once
+#include <cstdlib>
 #include <iostream>
 #include <exception>
-#include <typeinfo>
 
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define BII_EXCEPTIONS 1
+#define BII_THROW(error) throw error
+#define BII_TRY try
+#define BII_CATCH_ALL catch (...)
+#define BII_RETHROW throw
+#else
+#define BII_EXCEPTIONS 0
+#define BII_THROW(error) biiAbort((error).what())
+#define BII_TRY if (true)
+#define BII_CATCH_ALL else
+#define BII_RETHROW ((void)0)
+#endif
+
+/**
+ * Reports an error that cannot be thrown and
+ * ends the program
+ */
+[[noreturn]] inline void biiAbort(const char* message) {
+    std::cerr << message << "\n";
+    std::abort();
+}
 
 /**
  * Exception handler for attempts to access
  * an empty container
  */
-template <typename T>
 struct empty_container : public std::exception {
-    const char* name = typeid(T).name();
-    const char* prefix = 'Trying to acces an empty';
+    const char * what () const throw () {
+        return "Trying to access an empty container";
+    }
+};
+
+/**
+ * Exception handler for attempts to access
+ * an empty vector
+ */
+struct empty_vector : public empty_container {
+    const char * what () const throw () {
+        return "Trying to access an empty vector";
+    }
+};
 
+/**
+ * Exception handler for attempts to access
+ * an empty stack
+ */
+struct empty_stack : public empty_container {
+    const char * what () const throw () {
+        return "Trying to access an empty stack";
+    }
+};
+
+/**
+ * Exception handler for attempts to access
+ * an empty queue
+ */
+struct empty_queue : public empty_container {
+    const char * what () const throw () {
+        return "Trying to access an empty queue";
+    }
+};
+
+/**
+ * Exception handler for attempts to access
+ * an empty buffer
+ */
+struct empty_buffer : public empty_container {
     const char * what () const throw () {
-        return prefix + name;
+        return "Trying to access an empty buffer";
     }
-};
\ No newline at end of file
+};
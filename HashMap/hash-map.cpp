@@ -0,0 +1,104 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the hash-map.h class
+ */
+#pragma once
+#include "hash-map.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename KeyArg, typename... Args>
+std::pair<typename HashMap<K, V, Hash, Equal>::iterator, bool>
+HashMap<K, V, Hash, Equal>::emplaceKey(KeyArg&& key, Args&&... args) {
+    std::pair<size_t, bool> found = this->findOrPrepare(key);
+    if (found.second) {
+        BII_TRY {
+            Storage<std::pair<const K, V>>::construct(this->_slots + found.first, std::piecewise_construct,
+                                                      std::forward_as_tuple(std::forward<KeyArg>(key)),
+                                                      std::forward_as_tuple(std::forward<Args>(args)...));
+        } BII_CATCH_ALL {
+            this->abandon(found.first);
+            BII_RETHROW;
+        }
+    }
+    return std::pair<iterator, bool>(this->iteratorAt(found.first), found.second);
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename K, typename V, typename Hash, typename Equal>
+HashMap<K, V, Hash, Equal>::HashMap(const Hash& hash, const Equal& equal) : table(hash, equal) { }
+
+template <typename K, typename V, typename Hash, typename Equal>
+HashMap<K, V, Hash, Equal>::HashMap(const Vector<std::pair<K, V>>& entries) : table() {
+    insertAll(entries);
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename K, typename V, typename Hash, typename Equal>
+std::pair<typename HashMap<K, V, Hash, Equal>::iterator, bool>
+HashMap<K, V, Hash, Equal>::insert(const K& key, const V& value) {
+    return emplaceKey(key, value);
+}
+
+template <typename K, typename V, typename Hash, typename Equal>
+std::pair<typename HashMap<K, V, Hash, Equal>::iterator, bool>
+HashMap<K, V, Hash, Equal>::insert(K&& key, V&& value) {
+    return emplaceKey(move(key), move(value));
+}
+
+template <typename K, typename V, typename Hash, typename Equal>
+std::pair<typename HashMap<K, V, Hash, Equal>::iterator, bool>
+HashMap<K, V, Hash, Equal>::insertOrAssign(const K& key, const V& value) {
+    std::pair<iterator, bool> result = emplaceKey(key, value);
+    if (!result.second) {
+        result.first->second = value;
+    }
+    return result;
+}
+
+template <typename K, typename V, typename Hash, typename Equal>
+HashMap<K, V, Hash, Equal>& HashMap<K, V, Hash, Equal>::insertAll(const Vector<std::pair<K, V>>& entries) {
+    this->reserve(this->size() + entries.size());
+    for (const std::pair<K, V>& entry : entries) {
+        emplaceKey(entry.first, entry.second);
+    }
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename K, typename V, typename Hash, typename Equal>
+V& HashMap<K, V, Hash, Equal>::at(const K& key) {
+    return const_cast<V&>(static_cast<const HashMap<K, V, Hash, Equal>&>(*this).at(key));
+}
+
+template <typename K, typename V, typename Hash, typename Equal>
+const V& HashMap<K, V, Hash, Equal>::at(const K& key) const {
+    const V* value = tryAt(key);
+    if (value == nullptr) {
+        cout << "at failed\n";
+        BII_THROW(std::out_of_range("key not found"));
+    }
+    return *value;
+}
+
+template <typename K, typename V, typename Hash, typename Equal>
+V* HashMap<K, V, Hash, Equal>::tryAt(const K& key) {
+    return const_cast<V*>(static_cast<const HashMap<K, V, Hash, Equal>&>(*this).tryAt(key));
+}
+
+template <typename K, typename V, typename Hash, typename Equal>
+const V* HashMap<K, V, Hash, Equal>::tryAt(const K& key) const {
+    size_t index = this->findIndex(key, this->hashKey(key));
+    return index == table::none ? nullptr : &this->_slots[index].second;
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename K, typename V, typename Hash, typename Equal>
+V& HashMap<K, V, Hash, Equal>::operator[](const K& key) {
+    return emplaceKey(key).first->second;
+}
@@ -0,0 +1,130 @@
+/**
+ * Created on October 19, 2026. HashMap<K, V, Hash, Equal> is an
+ * unordered map from keys to values, for use in projects by BII.
+ *
+ * Entries are std::pair<const K, V> stored inline in one flat array
+ * of a HashTable (see hash-table.h), so a lookup that hits touches
+ * the control bytes and a single entry. Iterators give the pairs,
+ * whose keys are const so they cannot be changed in place.
+ *
+ * Inserting may move every entry, so it invalidates iterators and
+ * pointers to values unless reserve made room beforehand. Erasing
+ * invalidates only iterators to the erased entry.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added HashMap with insert, insertOrAssign, insertAll, [], at,
+ * and tryAt, on top of the HashTable operations.
+ */
+#pragma once
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Vector/vector.h"
+#include "hash-table.h"
+
+/** Takes the key out of a map entry */
+struct firstOf {
+    template <typename Pair>
+    const typename Pair::first_type& operator()(const Pair& entry) const { return entry.first; }
+};
+
+template <typename K, typename V, typename Hash = hashOf<K>, typename Equal = std::equal_to<>>
+class HashMap : public HashTable<K, std::pair<const K, V>, firstOf, Hash, Equal> {
+    using table = HashTable<K, std::pair<const K, V>, firstOf, Hash, Equal>;
+
+public:
+    using typename table::iterator;
+    using typename table::const_iterator;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty map without allocating
+     */
+    explicit HashMap(const Hash& hash = Hash(), const Equal& equal = Equal());
+
+    /**
+     * Creates a map from key-value pairs; a later
+     * duplicate key does not replace an earlier one
+     * O(N) expected asymptotic complexity
+     */
+    explicit HashMap(const Vector<std::pair<K, V>>& entries);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds a key and value if the key is not present.
+     * Returns an iterator to the key's entry and true
+     * if it was added
+     * O(1) expected amortized asymptotic complexity
+     */
+    std::pair<iterator, bool> insert(const K& key, const V& value);
+
+    /**
+     * Adds an r-value key and value if the key is not present
+     * O(1) expected amortized asymptotic complexity
+     */
+    std::pair<iterator, bool> insert(K&& key, V&& value);
+
+    /**
+     * Adds a key and value, replacing the value if
+     * the key is present. Returns true if it was added
+     * O(1) expected amortized asymptotic complexity
+     */
+    std::pair<iterator, bool> insertOrAssign(const K& key, const V& value);
+
+    /**
+     * Adds every pair whose key is not already present,
+     * reserving room for all of them first
+     * O(N) expected asymptotic complexity
+     */
+    HashMap<K, V, Hash, Equal>& insertAll(const Vector<std::pair<K, V>>& entries);
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the value for a key
+     * Throws an error if the key is not present
+     * O(1) expected asymptotic complexity
+     */
+    V& at(const K& key);
+
+    /**
+     * Views the value for a key (const)
+     * Throws an error if the key is not present
+     * O(1) expected asymptotic complexity
+     */
+    const V& at(const K& key) const;
+
+    /**
+     * Returns a pointer to the value for a key,
+     * or nullptr if the key is not present
+     * O(1) expected asymptotic complexity
+     */
+    V* tryAt(const K& key);
+
+    /**
+     * Returns a pointer to the value for a key, or
+     * nullptr if the key is not present (const)
+     * O(1) expected asymptotic complexity
+     */
+    const V* tryAt(const K& key) const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the value for a key, adding the key with
+     * a default value if it is not present
+     * O(1) expected amortized asymptotic complexity
+     */
+    V& operator[](const K& key);
+
+private:
+    /**
+     * Finds the key or constructs its entry from the
+     * key and the value arguments
+     */
+    template <typename KeyArg, typename... Args>
+    std::pair<iterator, bool> emplaceKey(KeyArg&& key, Args&&... args);
+};
+
+#include "hash-map.cpp"
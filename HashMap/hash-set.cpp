@@ -0,0 +1,54 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the hash-set.h class
+ */
+#pragma once
+#include "hash-set.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename K, typename Hash, typename Equal>
+template <typename KeyArg>
+std::pair<typename HashSet<K, Hash, Equal>::iterator, bool> HashSet<K, Hash, Equal>::emplaceKey(KeyArg&& key) {
+    std::pair<size_t, bool> found = this->findOrPrepare(key);
+    if (found.second) {
+        BII_TRY {
+            Storage<K>::construct(this->_slots + found.first, std::forward<KeyArg>(key));
+        } BII_CATCH_ALL {
+            this->abandon(found.first);
+            BII_RETHROW;
+        }
+    }
+    return std::pair<iterator, bool>(this->iteratorAt(found.first), found.second);
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename K, typename Hash, typename Equal>
+HashSet<K, Hash, Equal>::HashSet(const Hash& hash, const Equal& equal) : table(hash, equal) { }
+
+template <typename K, typename Hash, typename Equal>
+HashSet<K, Hash, Equal>::HashSet(const Vector<K>& keys) : table() {
+    insertAll(keys);
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename K, typename Hash, typename Equal>
+std::pair<typename HashSet<K, Hash, Equal>::iterator, bool> HashSet<K, Hash, Equal>::insert(const K& key) {
+    return emplaceKey(key);
+}
+
+template <typename K, typename Hash, typename Equal>
+std::pair<typename HashSet<K, Hash, Equal>::iterator, bool> HashSet<K, Hash, Equal>::insert(K&& key) {
+    return emplaceKey(move(key));
+}
+
+template <typename K, typename Hash, typename Equal>
+HashSet<K, Hash, Equal>& HashSet<K, Hash, Equal>::insertAll(const Vector<K>& keys) {
+    this->reserve(this->size() + keys.size());
+    for (const K& key : keys) {
+        emplaceKey(key);
+    }
+    return *this;
+}
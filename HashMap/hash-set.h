@@ -0,0 +1,79 @@
+/**
+ * Created on October 19, 2026. HashSet<K, Hash, Equal> is an
+ * unordered set of keys, for use in projects by BII.
+ *
+ * Keys are stored inline in one flat array of a HashTable (see
+ * hash-table.h). Iterators only give const access, since changing
+ * a key in place would lose it.
+ *
+ * Inserting may move every key, so it invalidates iterators unless
+ * reserve made room beforehand. Erasing invalidates only iterators
+ * to the erased key.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added HashSet with insert and insertAll, on top of the
+ * HashTable operations.
+ */
+#pragma once
+#include <functional>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Vector/vector.h"
+#include "hash-table.h"
+
+/** Takes the key out of a set entry, which is the key itself */
+struct identityOf {
+    template <typename K>
+    const K& operator()(const K& entry) const { return entry; }
+};
+
+template <typename K, typename Hash = hashOf<K>, typename Equal = std::equal_to<>>
+class HashSet : public HashTable<K, K, identityOf, Hash, Equal> {
+    using table = HashTable<K, K, identityOf, Hash, Equal>;
+
+public:
+    using typename table::iterator;
+    using typename table::const_iterator;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty set without allocating
+     */
+    explicit HashSet(const Hash& hash = Hash(), const Equal& equal = Equal());
+
+    /**
+     * Creates a set of the given keys
+     * O(N) expected asymptotic complexity
+     */
+    explicit HashSet(const Vector<K>& keys);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds a key if it is not present. Returns an iterator
+     * to the key and true if it was added
+     * O(1) expected amortized asymptotic complexity
+     */
+    std::pair<iterator, bool> insert(const K& key);
+
+    /**
+     * Adds an r-value key if it is not present
+     * O(1) expected amortized asymptotic complexity
+     */
+    std::pair<iterator, bool> insert(K&& key);
+
+    /**
+     * Adds every key not already present,
+     * reserving room for all of them first
+     * O(N) expected asymptotic complexity
+     */
+    HashSet<K, Hash, Equal>& insertAll(const Vector<K>& keys);
+
+private:
+    /**
+     * Finds the key or constructs it in a free slot
+     */
+    template <typename KeyArg>
+    std::pair<iterator, bool> emplaceKey(KeyArg&& key);
+};
+
+#include "hash-set.cpp"
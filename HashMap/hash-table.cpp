@@ -0,0 +1,444 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the hash-table.h class
+ */
+#pragma once
+#include "hash-table.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Query>
+size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::hashKey(const Query& key) const {
+    uint64_t mixed = static_cast<uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(mixed ^ (mixed >> 32));
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Query>
+size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::findIndex(const Query& key, size_t hash) const {
+    if (_capacity == 0) {
+        return none;
+    }
+    const size_t mask = _capacity - 1;
+    const int8_t fragment = static_cast<int8_t>(hash & 0x7F);
+    size_t position = (hash >> 7) & mask;
+    for (size_t step = controlGroup::width; ; step += controlGroup::width) {
+        controlGroup group(_control + position);
+        for (uint64_t matches = group.match(fragment); matches != 0; matches &= matches - 1) {
+            size_t index = (position + controlGroup::lowest(matches)) & mask;
+            if (_equal(KeyOf()(_slots[index]), key)) {
+                return index;
+            }
+        }
+        // an empty slot ends every probe that could have placed the key
+        if (group.matchEmpty() != 0) {
+            return none;
+        }
+        position = (position + step) & mask;
+    }
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::firstFree(size_t hash) const {
+    const size_t mask = _capacity - 1;
+    size_t position = (hash >> 7) & mask;
+    for (size_t step = controlGroup::width; ; step += controlGroup::width) {
+        uint64_t free = controlGroup(_control + position).matchFree();
+        if (free != 0) {
+            return (position + controlGroup::lowest(free)) & mask;
+        }
+        position = (position + step) & mask;
+    }
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Query>
+std::pair<size_t, bool> HashTable<Key, Entry, KeyOf, Hash, Equal>::findOrPrepare(const Query& key) {
+    size_t hash = hashKey(key);
+    size_t index = findIndex(key, hash);
+    if (index != none) {
+        return std::pair<size_t, bool>(index, false);
+    }
+    index = _capacity == 0 ? none : firstFree(hash);
+    // reusing a tombstone does not add to the load
+    if (_growthLeft == 0 && (index == none || _control[index] != deletedControl)) {
+        makeRoom();
+        index = firstFree(hash);
+    }
+    if (_control[index] == emptyControl) {
+        _growthLeft--;
+    }
+    setControl(index, static_cast<int8_t>(hash & 0x7F));
+    _size++;
+    return std::pair<size_t, bool>(index, true);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::iterator
+HashTable<Key, Entry, KeyOf, Hash, Equal>::iteratorAt(size_t index) {
+    return iterator(this, index);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::abandon(size_t index) {
+    setControl(index, deletedControl);
+    _size--;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::setControl(size_t index, int8_t value) {
+    _control[index] = value;
+    if (index < controlGroup::width) {
+        _control[_capacity + index] = value;
+    }
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::eraseAt(size_t index) {
+    const size_t mask = _capacity - 1;
+    uint64_t emptyBefore = controlGroup(_control + ((index - controlGroup::width) & mask)).matchEmpty();
+    uint64_t emptyAfter = controlGroup(_control + index).matchEmpty();
+    size_t fullBefore = emptyBefore ? controlGroup::aboveHighest(emptyBefore) : controlGroup::width;
+    size_t fullAfter = emptyAfter ? controlGroup::lowest(emptyAfter) : controlGroup::width;
+    Storage<Entry>::destroy(_slots + index, _slots + index + 1);
+    // a probe only passes a slot inside a whole group of non-empty
+    // slots, so a slot with no such group around it can be empty again
+    if (fullBefore + fullAfter < controlGroup::width) {
+        setControl(index, emptyControl);
+        _growthLeft++;
+    } else {
+        setControl(index, deletedControl);
+    }
+    _size--;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::nextFull(size_t index) const {
+    while (index < _capacity && _control[index] < 0) {
+        index++;
+    }
+    return index;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::maxGrowth(size_t capacity) const {
+    size_t allowed = static_cast<size_t>(capacity * _maxLoadFactor);
+    // at least one slot stays empty so that every probe ends
+    return allowed < capacity ? allowed : capacity - 1;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::capacityFor(size_t count) const {
+    size_t capacity = minimumCapacity;
+    while (maxGrowth(capacity) < count) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::rehash(size_t capacity) {
+    int8_t* oldControl = _control;
+    Entry* oldSlots = _slots;
+    size_t oldCapacity = _capacity;
+
+    _control = Storage<int8_t>::allocate(capacity + controlGroup::width);
+    _slots = Storage<Entry>::allocate(capacity);
+    _capacity = capacity;
+    std::memset(_control, emptyControl, capacity + controlGroup::width);
+    for (size_t index = 0; index < oldCapacity; index++) {
+        if (oldControl[index] >= 0) {
+            size_t hash = hashKey(KeyOf()(oldSlots[index]));
+            size_t target = firstFree(hash);
+            setControl(target, static_cast<int8_t>(hash & 0x7F));
+            Storage<Entry>::construct(_slots + target, std::move(oldSlots[index]));
+            Storage<Entry>::destroy(oldSlots + index, oldSlots + index + 1);
+        }
+    }
+    // a lowered load factor can leave more entries than the new limit
+    size_t allowed = maxGrowth(capacity);
+    _growthLeft = allowed > _size ? allowed - _size : 0;
+    if (oldCapacity != 0) {
+        Storage<int8_t>::deallocate(oldControl, oldCapacity + controlGroup::width);
+        Storage<Entry>::deallocate(oldSlots, oldCapacity);
+    }
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::makeRoom() {
+    if (_capacity != 0 && _size < maxGrowth(_capacity) / 2) {
+        rehash(_capacity);
+    } else {
+        rehash(capacityFor(_size + 1) > _capacity * 2 ? capacityFor(_size + 1) : _capacity * 2);
+    }
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::release() {
+    if (_capacity == 0) {
+        return;
+    }
+    if (!std::is_trivially_destructible<Entry>::value) {
+        for (size_t index = 0; index < _capacity; index++) {
+            if (_control[index] >= 0) {
+                Storage<Entry>::destroy(_slots + index, _slots + index + 1);
+            }
+        }
+    }
+    Storage<int8_t>::deallocate(_control, _capacity + controlGroup::width);
+    Storage<Entry>::deallocate(_slots, _capacity);
+    _control = nullptr;
+    _slots = nullptr;
+    _capacity = 0;
+    _size = 0;
+    _growthLeft = 0;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Key, Entry, KeyOf, Hash, Equal>::HashTable(const Hash& hash, const Equal& equal) :
+    _control(nullptr), _slots(nullptr), _capacity(0), _size(0), _growthLeft(0),
+    _maxLoadFactor(0.875), _hash(hash), _equal(equal) { }
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Key, Entry, KeyOf, Hash, Equal>::HashTable(const HashTable& other) :
+    _control(nullptr), _slots(nullptr), _capacity(0), _size(0), _growthLeft(0),
+    _maxLoadFactor(other._maxLoadFactor), _hash(other._hash), _equal(other._equal) {
+    *this = other;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Key, Entry, KeyOf, Hash, Equal>::HashTable(HashTable&& other) :
+    _control(other._control), _slots(other._slots), _capacity(other._capacity), _size(other._size),
+    _growthLeft(other._growthLeft), _maxLoadFactor(other._maxLoadFactor), _hash(std::move(other._hash)),
+    _equal(std::move(other._equal)) {
+    other._control = nullptr;
+    other._slots = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+    other._growthLeft = 0;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Key, Entry, KeyOf, Hash, Equal>::~HashTable() {
+    release();
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+inline size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::size() const {
+    return _size;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+inline bool HashTable<Key, Entry, KeyOf, Hash, Equal>::empty() const {
+    return _size == 0;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+inline size_t HashTable<Key, Entry, KeyOf, Hash, Equal>::capacity() const {
+    return _capacity;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+inline double HashTable<Key, Entry, KeyOf, Hash, Equal>::loadFactor() const {
+    return _capacity == 0 ? 0.0 : static_cast<double>(_size) / _capacity;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+inline double HashTable<Key, Entry, KeyOf, Hash, Equal>::maxLoadFactor() const {
+    return _maxLoadFactor;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::maxLoadFactor(double fraction) {
+    fraction = fraction < 0.25 ? 0.25 : fraction > 0.95 ? 0.95 : fraction;
+    // full and deleted slots keep counting against the new limit
+    size_t used = _capacity == 0 ? 0 : maxGrowth(_capacity) - _growthLeft;
+    _maxLoadFactor = fraction;
+    size_t allowed = _capacity == 0 ? 0 : maxGrowth(_capacity);
+    _growthLeft = allowed > used ? allowed - used : 0;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::reserve(size_t count) {
+    size_t capacity = capacityFor(std::max(count, _size));
+    if (capacity > _capacity) {
+        rehash(capacity);
+    }
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+bool HashTable<Key, Entry, KeyOf, Hash, Equal>::erase(const Key& key) {
+    size_t index = findIndex(key, hashKey(key));
+    if (index == none) {
+        return false;
+    }
+    eraseAt(index);
+    return true;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::iterator
+HashTable<Key, Entry, KeyOf, Hash, Equal>::erase(const_iterator position) {
+    eraseAt(position._index);
+    return iterator(this, nextFull(position._index + 1));
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Key, Entry, KeyOf, Hash, Equal>::clear() {
+    if (_capacity == 0) {
+        return;
+    }
+    if (!std::is_trivially_destructible<Entry>::value) {
+        for (size_t index = 0; index < _capacity; index++) {
+            if (_control[index] >= 0) {
+                Storage<Entry>::destroy(_slots + index, _slots + index + 1);
+            }
+        }
+    }
+    std::memset(_control, emptyControl, _capacity + controlGroup::width);
+    _size = 0;
+    _growthLeft = maxGrowth(_capacity);
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::iterator
+HashTable<Key, Entry, KeyOf, Hash, Equal>::find(const Key& key) {
+    size_t index = findIndex(key, hashKey(key));
+    return iterator(this, index == none ? _capacity : index);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::const_iterator
+HashTable<Key, Entry, KeyOf, Hash, Equal>::find(const Key& key) const {
+    size_t index = findIndex(key, hashKey(key));
+    return const_iterator(this, index == none ? _capacity : index);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Query, typename>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::iterator
+HashTable<Key, Entry, KeyOf, Hash, Equal>::find(const Query& key) {
+    size_t index = findIndex(key, hashKey(key));
+    return iterator(this, index == none ? _capacity : index);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Query, typename>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::const_iterator
+HashTable<Key, Entry, KeyOf, Hash, Equal>::find(const Query& key) const {
+    size_t index = findIndex(key, hashKey(key));
+    return const_iterator(this, index == none ? _capacity : index);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+bool HashTable<Key, Entry, KeyOf, Hash, Equal>::contains(const Key& key) const {
+    return findIndex(key, hashKey(key)) != none;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Query, typename>
+bool HashTable<Key, Entry, KeyOf, Hash, Equal>::contains(const Query& key) const {
+    return findIndex(key, hashKey(key)) != none;
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Key, Entry, KeyOf, Hash, Equal>& HashTable<Key, Entry, KeyOf, Hash, Equal>::operator=(const HashTable& assign) {
+    if (&assign == this) return *this;
+    release();
+    _maxLoadFactor = assign._maxLoadFactor;
+    _hash = assign._hash;
+    _equal = assign._equal;
+    if (assign._size == 0) {
+        return *this;
+    }
+    // same capacity and hash, so every entry lands in the same slot
+    _control = Storage<int8_t>::allocate(assign._capacity + controlGroup::width);
+    _slots = Storage<Entry>::allocate(assign._capacity);
+    _capacity = assign._capacity;
+    std::memset(_control, emptyControl, _capacity + controlGroup::width);
+    for (size_t index = 0; index < _capacity; index++) {
+        if (assign._control[index] >= 0) {
+            Storage<Entry>::construct(_slots + index, assign._slots[index]);
+            setControl(index, assign._control[index]);
+            _size++;
+        } else if (assign._control[index] == deletedControl) {
+            setControl(index, deletedControl);
+        }
+    }
+    _growthLeft = assign._growthLeft;
+    return *this;
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Key, Entry, KeyOf, Hash, Equal>& HashTable<Key, Entry, KeyOf, Hash, Equal>::operator=(HashTable&& assign) {
+    if (&assign == this) return *this;
+    release();
+    _control = assign._control;
+    _slots = assign._slots;
+    _capacity = assign._capacity;
+    _size = assign._size;
+    _growthLeft = assign._growthLeft;
+    _maxLoadFactor = assign._maxLoadFactor;
+    _hash = std::move(assign._hash);
+    _equal = std::move(assign._equal);
+    assign._control = nullptr;
+    assign._slots = nullptr;
+    assign._capacity = 0;
+    assign._size = 0;
+    assign._growthLeft = 0;
+    return *this;
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::iterator HashTable<Key, Entry, KeyOf, Hash, Equal>::begin() {
+    return iterator(this, nextFull(0));
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::iterator HashTable<Key, Entry, KeyOf, Hash, Equal>::end() {
+    return iterator(this, _capacity);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::const_iterator HashTable<Key, Entry, KeyOf, Hash, Equal>::begin() const {
+    return const_iterator(this, nextFull(0));
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+typename HashTable<Key, Entry, KeyOf, Hash, Equal>::const_iterator HashTable<Key, Entry, KeyOf, Hash, Equal>::end() const {
+    return const_iterator(this, _capacity);
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename K_, typename E_, typename O_, typename H_, typename Q_>
+bool operator==(const HashTable<K_, E_, O_, H_, Q_>& left, const HashTable<K_, E_, O_, H_, Q_>& right) {
+    if (left.size() != right.size()) {
+        return false;
+    }
+    for (const E_& entry : left) {
+        auto found = right.find(O_()(entry));
+        if (found == right.end() || !(*found == entry)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename K_, typename E_, typename O_, typename H_, typename Q_>
+bool operator!=(const HashTable<K_, E_, O_, H_, Q_>& left, const HashTable<K_, E_, O_, H_, Q_>& right) {
+    return !(left == right);
+}
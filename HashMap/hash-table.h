@@ -0,0 +1,509 @@
+/**
+ * Created on October 19, 2026. HashTable<Key, Entry, KeyOf, Hash,
+ * Equal> is the open-addressing table behind HashMap<K, V> and
+ * HashSet<K>, for use in projects by BII.
+ *
+ * Entries live in one flat array next to an array of control
+ * bytes, one per slot. A control byte is either empty, deleted,
+ * or (for a full slot) the low seven bits of the entry's hash.
+ * Lookups hash the key once, then scan the control bytes a group
+ * at a time (16 with SSE2, 8 with the portable fallback), comparing
+ * keys only where those seven bits match, so most probes never
+ * touch the entries at all. Groups are visited in a triangular
+ * sequence, which reaches every group of a power-of-two table.
+ *
+ * The control array repeats its first group after the last slot,
+ * so a group can be loaded at any slot without wrapping. An erased
+ * slot becomes a tombstone only when a probe could have passed over
+ * it; tombstones count against the load until the next rehash.
+ *
+ * Lookups take any type the hash and equality both accept when they
+ * declare is_transparent (as hashOf<std::string> and std::equal_to<>
+ * do), so a std::string table can be searched with a string_view or
+ * a literal without building a string.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added HashTable with size, empty, capacity, loadFactor, maxLoadFactor,
+ * reserve, clear, find, contains, erase, iterators, ==, and !=.
+ */
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Vector/storage.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BII_HASH_SSE2 1
+#endif
+
+/**
+ * The default hash: std::hash, except that std::string
+ * hashes are transparent over std::string_view
+ */
+template <typename K>
+struct hashOf {
+    size_t operator()(const K& key) const { return std::hash<K>()(key); }
+};
+
+template <>
+struct hashOf<std::string> {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const { return std::hash<std::string_view>()(key); }
+};
+
+/** Control byte of a slot that has never held an entry */
+const int8_t emptyControl = -128;
+
+/** Control byte of a slot whose entry was erased */
+const int8_t deletedControl = -2;
+
+/**
+ * A group of control bytes loaded at once, with bit masks
+ * of the slots that match a hash, are empty, or are free
+ */
+struct controlGroup {
+#ifdef BII_HASH_SSE2
+    /** Slots per group */
+    static constexpr size_t width = 16;
+
+    /** Bits per slot in a mask, as a shift */
+    static constexpr int shift = 0;
+
+    __m128i bytes;
+
+    explicit controlGroup(const int8_t* control) :
+        bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) { }
+
+    /** Slots whose control byte is the given hash fragment */
+    uint64_t match(int8_t fragment) const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(fragment), bytes)));
+    }
+
+    /** Slots that are empty */
+    uint64_t matchEmpty() const {
+        return match(emptyControl);
+    }
+
+    /** Slots that are empty or deleted */
+    uint64_t matchFree() const {
+        // both are below -1; full slots are 0 through 127
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), bytes)));
+    }
+#else
+    static constexpr size_t width = 8;
+    static constexpr int shift = 3;
+
+    uint64_t bytes;
+
+    explicit controlGroup(const int8_t* control) {
+        std::memcpy(&bytes, control, sizeof(bytes));
+    }
+
+    /** Slots whose control byte may be the given hash fragment */
+    uint64_t match(int8_t fragment) const {
+        // a borrow can flag the byte after a true match, which the
+        // key comparison then rejects
+        const uint64_t lows = 0x0101010101010101ull;
+        uint64_t differences = bytes ^ (lows * static_cast<uint8_t>(fragment));
+        return (differences - lows) & ~differences & (lows << 7);
+    }
+
+    uint64_t matchEmpty() const {
+        // empty is the only value with bit 7 set and bit 1 clear
+        return bytes & ~(bytes << 6) & (0x0101010101010101ull << 7);
+    }
+
+    uint64_t matchFree() const {
+        // empty and deleted are the only values with bit 7 set and bit 0 clear
+        return bytes & ~(bytes << 7) & (0x0101010101010101ull << 7);
+    }
+#endif
+
+    /** The slot of the lowest bit in a nonzero mask */
+    static size_t lowest(uint64_t mask) {
+        return static_cast<size_t>(__builtin_ctzll(mask)) >> shift;
+    }
+
+    /** The number of slots above the highest bit in a nonzero mask */
+    static size_t aboveHighest(uint64_t mask) {
+        return (static_cast<size_t>(__builtin_clzll(mask)) >> shift) - (64 >> shift) + width;
+    }
+};
+
+/**
+ * True when a hash or equality type declares is_transparent
+ */
+template <typename T, typename = void>
+struct isTransparent : std::false_type { };
+
+template <typename T>
+struct isTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type { };
+
+template <typename Key, typename Entry, typename KeyOf, typename Hash, typename Equal>
+class HashTable {
+    /** Enabled for lookups by keys of other types */
+    template <typename Query>
+    using transparent = typename std::enable_if<!std::is_same<Query, Key>::value &&
+        isTransparent<Hash>::value && isTransparent<Equal>::value>::type;
+
+    /** Sets do not let their entries be changed in place */
+    static constexpr bool constEntries = std::is_same<Key, Entry>::value;
+
+public:
+    template <bool Const>
+    class tableIterator;
+
+    using iterator = tableIterator<constEntries>;
+    using const_iterator = tableIterator<true>;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty table without allocating
+     */
+    explicit HashTable(const Hash& hash = Hash(), const Equal& equal = Equal());
+
+    /**
+     * Copy Constructor
+     * O(N) asymptotic complexity
+     */
+    HashTable(const HashTable& other);
+
+    /**
+     * Move Constructor
+     * O(1) asymptotic complexity
+     */
+    HashTable(HashTable&& other);
+
+    /**
+     * Destructor
+     * O(N) asymptotic complexity
+     */
+    ~HashTable();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of entries
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if there are no entries
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns the number of slots
+     * O(1) asymptotic complexity
+     */
+    inline size_t capacity() const;
+
+    /**
+     * Returns the fraction of slots that are full
+     * O(1) asymptotic complexity
+     */
+    inline double loadFactor() const;
+
+    /**
+     * Returns the fraction of slots that may be full
+     * or deleted before the table grows
+     * O(1) asymptotic complexity
+     */
+    inline double maxLoadFactor() const;
+
+    /**
+     * Sets the fraction of slots that may be full or deleted
+     * before the table grows (0.875 by default), clamped to
+     * [0.25, 0.95]. Takes effect from the next insert.
+     * O(1) asymptotic complexity
+     */
+    void maxLoadFactor(double fraction);
+
+    /**
+     * Makes room for count entries without growing again
+     * O(N) asymptotic complexity
+     */
+    void reserve(size_t count);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Removes the entry with the given key, returning true
+     * if there was one
+     * O(1) expected asymptotic complexity
+     */
+    bool erase(const Key& key);
+
+    /**
+     * Removes the entry the iterator points to and
+     * returns an iterator to the next one
+     * O(1) expected asymptotic complexity
+     */
+    iterator erase(const_iterator position);
+
+    /**
+     * Removes every entry, keeping the slots
+     * O(N) asymptotic complexity
+     */
+    void clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns an iterator to the entry with the given key,
+     * or end if there is none
+     * O(1) expected asymptotic complexity
+     */
+    iterator find(const Key& key);
+
+    /**
+     * Returns an iterator to the entry with the given key,
+     * or end if there is none (const)
+     * O(1) expected asymptotic complexity
+     */
+    const_iterator find(const Key& key) const;
+
+    /**
+     * Finds an entry by a key of another type, for
+     * transparent hash and equality types
+     * O(1) expected asymptotic complexity
+     */
+    template <typename Query, typename = transparent<Query>>
+    iterator find(const Query& key);
+
+    /**
+     * Finds an entry by a key of another type, for
+     * transparent hash and equality types (const)
+     * O(1) expected asymptotic complexity
+     */
+    template <typename Query, typename = transparent<Query>>
+    const_iterator find(const Query& key) const;
+
+    /**
+     * Returns true if there is an entry with the given key
+     * O(1) expected asymptotic complexity
+     */
+    bool contains(const Key& key) const;
+
+    /**
+     * Returns true if there is an entry with the given key,
+     * for transparent hash and equality types
+     * O(1) expected asymptotic complexity
+     */
+    template <typename Query, typename = transparent<Query>>
+    bool contains(const Query& key) const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Copy Assignment
+     */
+    HashTable& operator=(const HashTable& assign);
+
+    /**
+     * Move Assignment
+     */
+    HashTable& operator=(HashTable&& assign);
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator to the first entry, in slot order
+     */
+    iterator begin();
+
+    /**
+     * Iterator past the last entry
+     */
+    iterator end();
+
+    /**
+     * Const iterator to the first entry, in slot order
+     */
+    const_iterator begin() const;
+
+    /**
+     * Const iterator past the last entry
+     */
+    const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two tables, returns true if they hold the same
+     * entries, in any order
+     */
+    template <typename K_, typename E_, typename O_, typename H_, typename Q_>
+    friend bool operator==(const HashTable<K_, E_, O_, H_, Q_>& left, const HashTable<K_, E_, O_, H_, Q_>& right);
+
+    /**
+     * Given two tables, returns true if they
+     * don't hold the same entries
+     */
+    template <typename K_, typename E_, typename O_, typename H_, typename Q_>
+    friend bool operator!=(const HashTable<K_, E_, O_, H_, Q_>& left, const HashTable<K_, E_, O_, H_, Q_>& right);
+
+    /**
+     * Walks the full slots of a table in order
+     */
+    template <bool Const>
+    class tableIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::conditional<Const, const Entry&, Entry&>::type;
+        using pointer = typename std::conditional<Const, const Entry*, Entry*>::type;
+
+        tableIterator() : _table(nullptr), _index(0) { }
+
+        /** Every iterator converts to a const_iterator */
+        operator tableIterator<true>() const { return tableIterator<true>(_table, _index); }
+
+        reference operator*() const { return _table->_slots[_index]; }
+        pointer operator->() const { return _table->_slots + _index; }
+
+        tableIterator& operator++() {
+            _index = _table->nextFull(_index + 1);
+            return *this;
+        }
+
+        tableIterator operator++(int) {
+            tableIterator before = *this;
+            ++*this;
+            return before;
+        }
+
+        bool operator==(const tableIterator& other) const { return _index == other._index; }
+        bool operator!=(const tableIterator& other) const { return _index != other._index; }
+
+    private:
+        friend class HashTable;
+
+        template <bool>
+        friend class tableIterator;
+
+        tableIterator(const HashTable* table, size_t index) : _table(table), _index(index) { }
+
+        const HashTable* _table;
+        size_t _index;
+    };
+
+protected:
+    /** Returned by lookups that find nothing */
+    static constexpr size_t none = static_cast<size_t>(-1);
+
+    /** The smallest table, one group */
+    static constexpr size_t minimumCapacity = controlGroup::width;
+
+    /** One control byte per slot, then the first group again */
+    int8_t* _control;
+
+    /** The entries, constructed only in full slots */
+    Entry* _slots;
+
+    /** The number of slots, zero or a power of two */
+    size_t _capacity;
+
+    /** The number of full slots */
+    size_t _size;
+
+    /** How many more empty slots may be filled before a rehash */
+    size_t _growthLeft;
+
+    /** The fraction of slots that may be full or deleted */
+    double _maxLoadFactor;
+
+    /** Hashes keys */
+    Hash _hash;
+
+    /** Compares keys */
+    Equal _equal;
+
+    /**
+     * Mixes a key's hash so that its low and high bits
+     * both depend on every bit of the key
+     */
+    template <typename Query>
+    size_t hashKey(const Query& key) const;
+
+    /**
+     * Returns the slot holding the given key, or none
+     */
+    template <typename Query>
+    size_t findIndex(const Query& key, size_t hash) const;
+
+    /**
+     * Returns the slot holding the given key, or claims a free slot
+     * for it (growing first if needed) and returns it with true;
+     * the caller must construct the entry there
+     */
+    template <typename Query>
+    std::pair<size_t, bool> findOrPrepare(const Query& key);
+
+    /**
+     * Returns an iterator to the given slot
+     */
+    iterator iteratorAt(size_t index);
+
+    /**
+     * Releases a slot claimed by findOrPrepare whose
+     * entry could not be constructed
+     */
+    void abandon(size_t index);
+
+    /**
+     * Returns the first free slot on the probe sequence of a hash
+     */
+    size_t firstFree(size_t hash) const;
+
+    /**
+     * Sets a control byte and its copy past the last slot
+     */
+    void setControl(size_t index, int8_t value);
+
+    /**
+     * Destroys the entry in a full slot and frees the slot
+     */
+    void eraseAt(size_t index);
+
+    /**
+     * Returns the first full slot at or after index, or capacity
+     */
+    size_t nextFull(size_t index) const;
+
+    /**
+     * Returns the number of slots the load factor lets fill
+     */
+    size_t maxGrowth(size_t capacity) const;
+
+    /**
+     * Returns the smallest capacity that holds count entries
+     */
+    size_t capacityFor(size_t count) const;
+
+    /**
+     * Moves every entry into a new table of the given capacity,
+     * dropping tombstones
+     * O(N) asymptotic complexity
+     */
+    void rehash(size_t capacity);
+
+    /**
+     * Makes room for one more entry, by dropping tombstones
+     * if they are most of the load and by doubling otherwise
+     */
+    void makeRoom();
+
+    /**
+     * Destroys every entry and frees both arrays
+     */
+    void release();
+};
+
+#include "hash-table.cpp"
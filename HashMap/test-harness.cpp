@@ -0,0 +1,388 @@
+/**
+ * Created on October 19, 2026. Testing harness for the
+ * HashMap<K, V> and HashSet<K> classes.
+ */
+#include "hash-map.h"
+#include "hash-set.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using std::cout;
+using std::endl;
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Test Settings
+const bool section_A = true; // Constructors/Destructor (5 Methods)
+const bool section_B = true; // Modifiers (8 Methods)
+const bool section_C = true; // Element Viewing (6 Methods)
+const bool section_D = true; // Hash Set (5 Methods)
+
+/**
+ * Given two values, returns true if they are equal
+ * as the type of the first
+ */
+template <typename T, typename S>
+bool expectEqual(T first, S second) {
+    return first == static_cast<T>(second);
+}
+
+/**
+ * Prints and counts the outcome of a single test
+ */
+void report(const char* name, bool passed, int& numTestsPassed, int& numTestsFailed) {
+    if (passed) {
+        cout << name << " : PASSED" << endl;
+        numTestsPassed++;
+    } else {
+        cout << name << " : FAILED" << endl;
+        numTestsFailed++;
+    }
+}
+
+/**
+ * Returns the i-th value of a scrambled sequence with repeats
+ */
+int scrambled(int i) {
+    return static_cast<int>((i * 2654435761u) % 10007);
+}
+
+/**
+ * A hash that sends every key to one of three values,
+ * so that probes run long and cross many tombstones
+ */
+struct collidingHash {
+    size_t operator()(int key) const { return static_cast<size_t>(key % 3); }
+};
+
+/**
+ * Given a map and the reference it should match,
+ * returns true if they hold the same entries
+ */
+template <typename Map>
+bool matches(const Map& map, const std::unordered_map<int, int>& reference) {
+    bool same = expectEqual(map.size(), reference.size());
+    size_t visited = 0;
+    for (const std::pair<const int, int>& entry : map) {
+        auto found = reference.find(entry.first);
+        same = same && found != reference.end() && expectEqual(found->second, entry.second);
+        visited++;
+    }
+    for (const std::pair<const int, int>& entry : reference) {
+        const int* value = map.tryAt(entry.first);
+        same = same && value != nullptr && expectEqual(*value, entry.second);
+    }
+    return same && expectEqual(visited, reference.size());
+}
+
+/**
+ * Macro for testing HashMap Constructor/Destructor methods
+ */
+void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
+    HashMap<int, int> empty;
+    report("Default Constructor", empty.empty() && expectEqual(empty.capacity(), 0) && empty.begin() == empty.end(),
+           numTestsPassed, numTestsFailed);
+
+    Vector<std::pair<int, int>> pairs;
+    std::unordered_map<int, int> reference;
+    for (int i = 0; i < size; i++) {
+        pairs.addBack(std::pair<int, int>(scrambled(i), i));
+        reference.emplace(scrambled(i), i);
+    }
+    HashMap<int, int> map(pairs);
+    report("Vector Constructor", matches(map, reference), numTestsPassed, numTestsFailed);
+
+    HashMap<int, int> copied(map);
+    copied.insertOrAssign(-1, -1);
+    report("Copy Constructor", matches(map, reference) && expectEqual(copied.size(), map.size() + 1)
+           && copied.erase(-1) && copied == map, numTestsPassed, numTestsFailed);
+
+    HashMap<int, int> moved(std::move(copied));
+    report("Move Constructor", matches(moved, reference) && copied.empty() && expectEqual(copied.capacity(), 0),
+           numTestsPassed, numTestsFailed);
+
+    HashMap<std::string, std::string> words;
+    for (int i = 0; i < size % 500 + 10; i++) {
+        words[std::to_string(i)] = std::string(40, 'a' + i % 26);
+    }
+    HashMap<std::string, std::string> assigned;
+    assigned["stale"] = "entry";
+    assigned = words;
+    HashMap<std::string, std::string> taken;
+    taken = std::move(assigned);
+    report("Copy/Move Assignment", taken == words && !taken.contains("stale") && assigned.empty(),
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing HashMap Modifiers methods
+ */
+void testB(const int size, int& numTestsPassed, int& numTestsFailed) {
+    HashMap<int, int> map;
+    std::unordered_map<int, int> reference;
+    bool agreed = true;
+    for (int i = 0; i < size; i++) {
+        int key = scrambled(i);
+        std::pair<HashMap<int, int>::iterator, bool> added = map.insert(key, i);
+        bool fresh = reference.emplace(key, i).second;
+        agreed = agreed && expectEqual(added.second, fresh) && expectEqual(added.first->first, key);
+    }
+    report("Insert", agreed && matches(map, reference), numTestsPassed, numTestsFailed);
+
+    bool churned = true;
+    for (int i = 0; i < size; i++) {
+        int key = scrambled(i * 7 + 3);
+        if (i % 3 == 0) {
+            churned = churned && expectEqual(map.erase(key), reference.erase(key) == 1);
+        } else {
+            map.insertOrAssign(key, -i);
+            reference[key] = -i;
+        }
+    }
+    report("Erase/InsertOrAssign", churned && matches(map, reference), numTestsPassed, numTestsFailed);
+
+    for (int i = 0; i < size; i++) {
+        map[scrambled(i)] += 1;
+        reference[scrambled(i)] += 1;
+    }
+    report("Subscript", matches(map, reference), numTestsPassed, numTestsFailed);
+
+    // every key lands in one of three probe sequences
+    HashMap<int, int, collidingHash> crowded;
+    std::unordered_map<int, int> crowdedReference;
+    bool survived = true;
+    for (int i = 0; i < size % 2000 + 100; i++) {
+        int key = scrambled(i) % 300;
+        if (i % 4 == 3) {
+            survived = survived && expectEqual(crowded.erase(key), crowdedReference.erase(key) == 1);
+        } else {
+            crowded.insertOrAssign(key, i);
+            crowdedReference[key] = i;
+        }
+    }
+    report("Erase (colliding hash)", survived && matches(crowded, crowdedReference), numTestsPassed, numTestsFailed);
+
+    size_t before = map.size();
+    size_t removed = 0;
+    for (HashMap<int, int>::iterator it = map.begin(); it != map.end();) {
+        if (it->second % 2 == 0) {
+            reference.erase(it->first);
+            it = map.erase(it);
+            removed++;
+        } else {
+            ++it;
+        }
+    }
+    report("Erase (iterator)", expectEqual(map.size(), before - removed) && matches(map, reference),
+           numTestsPassed, numTestsFailed);
+
+    HashMap<int, int> reserved;
+    reserved.maxLoadFactor(0.5);
+    reserved.reserve(size);
+    size_t capacity = reserved.capacity();
+    Vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < size; i++) {
+        pairs.addBack(std::pair<int, int>(i, i));
+    }
+    reserved.insertAll(pairs);
+    report("Reserve/InsertAll", expectEqual(reserved.capacity(), capacity) && expectEqual(reserved.size(), size)
+           && reserved.loadFactor() <= 0.5, numTestsPassed, numTestsFailed);
+
+    // reserving fewer keys than a table holds after its load factor was lowered
+    HashMap<int, int> lowered;
+    for (int i = 0; i < size; i++) {
+        lowered.insert(i, i);
+    }
+    lowered.maxLoadFactor(0.25);
+    lowered.reserve(size / 3);
+    for (int i = size; i < size + 100; i++) {
+        lowered.insert(i, i);
+    }
+    bool kept = true;
+    for (int i = 0; i < size + 100; i += 7) {
+        kept = kept && lowered.contains(i);
+    }
+    report("Reserve (lowered load factor)", kept && expectEqual(lowered.size(), size + 100)
+           && lowered.loadFactor() <= 0.25, numTestsPassed, numTestsFailed);
+
+    map.clear();
+    report("Clear", map.empty() && map.begin() == map.end() && !map.contains(scrambled(1)) && map.capacity() > 0,
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing HashMap Element Viewing methods
+ */
+void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
+    // at least three keys for the assignment test
+    const int count = size < 3 ? 3 : size;
+    HashMap<int, int> map;
+    for (int i = 0; i < count; i++) {
+        map.insert(i, i * 2);
+    }
+    bool found = true;
+    for (int i = 0; i < count; i++) {
+        found = found && expectEqual(map.at(i), i * 2) && map.contains(i) && expectEqual(map.find(i)->second, i * 2);
+    }
+    report("At/Find/Contains", found, numTestsPassed, numTestsFailed);
+
+    bool threw = false;
+    try {
+        map.at(-1);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    const HashMap<int, int>& constant = map;
+    report("TryAt (missing)", threw && map.tryAt(-1) == nullptr && constant.tryAt(count) == nullptr
+           && map.find(-1) == map.end() && constant.find(-1) == constant.end(), numTestsPassed, numTestsFailed);
+
+    *map.tryAt(0) = 7;
+    map.at(1) = 8;
+    map.find(2)->second = 9;
+    report("TryAt/At (assign)", expectEqual(constant.at(0), 7) && expectEqual(*constant.tryAt(1), 8)
+           && expectEqual(constant.find(2)->second, 9), numTestsPassed, numTestsFailed);
+
+    // string keys looked up without building a std::string
+    HashMap<std::string, int> words;
+    for (int i = 0; i < size % 1000 + 10; i++) {
+        words.insert("word" + std::to_string(i), i);
+    }
+    std::string_view view = "word7";
+    report("Find (heterogeneous)", words.contains(view) && expectEqual(words.find(view)->second, 7)
+           && words.contains("word3") && !words.contains(std::string_view("word")), numTestsPassed, numTestsFailed);
+
+    size_t visited = 0;
+    long long sum = 0;
+    for (const std::pair<const int, int>& entry : constant) {
+        visited++;
+        sum += entry.first;
+    }
+    // keys are const through a mutable iterator too, so they cannot be changed in place
+    bool constKeys = std::is_const<decltype(map.begin()->first)>::value;
+    report("Iterators", constKeys && expectEqual(visited, count) && expectEqual(sum, (long long)count * (count - 1) / 2),
+           numTestsPassed, numTestsFailed);
+
+    HashMap<int, int> grown;
+    size_t growths = 0;
+    size_t capacity = 0;
+    for (int i = 0; i < size; i++) {
+        grown.insert(i, i);
+        if (grown.capacity() != capacity) {
+            capacity = grown.capacity();
+            growths++;
+        }
+    }
+    report("Capacity/LoadFactor", grown.loadFactor() <= grown.maxLoadFactor() && (capacity & (capacity - 1)) == 0
+           && growths <= 64, numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing HashSet methods
+ */
+void testD(const int size, int& numTestsPassed, int& numTestsFailed) {
+    HashSet<int> set;
+    std::unordered_set<int> reference;
+    bool agreed = true;
+    for (int i = 0; i < size; i++) {
+        int key = scrambled(i);
+        agreed = agreed && expectEqual(set.insert(key).second, reference.insert(key).second);
+    }
+    report("Insert", agreed && expectEqual(set.size(), reference.size()), numTestsPassed, numTestsFailed);
+
+    bool erased = true;
+    for (int i = 0; i < size; i += 2) {
+        int key = scrambled(i);
+        erased = erased && expectEqual(set.erase(key), reference.erase(key) == 1);
+    }
+    bool present = expectEqual(set.size(), reference.size());
+    for (int key : set) {
+        present = present && reference.count(key) == 1;
+    }
+    report("Erase/Contains", erased && present, numTestsPassed, numTestsFailed);
+
+    Vector<int> keys;
+    for (int i = 0; i < size; i++) {
+        keys.addBack(i % 100);
+    }
+    HashSet<int> small(keys);
+    report("Vector Constructor/InsertAll", expectEqual(small.size(), size < 100 ? size : 100)
+           && small.contains(0), numTestsPassed, numTestsFailed);
+
+    HashSet<int> copy(small);
+    copy.erase(0);
+    copy.insert(0);
+    report("Equality", copy == small && (copy.insert(-5), copy != small), numTestsPassed, numTestsFailed);
+
+    HashSet<std::string> names;
+    names.insert(std::string("alpha"));
+    names.insert("beta");
+    names.insert("alpha");
+    report("Find (heterogeneous)", expectEqual(names.size(), 2) && names.contains(std::string_view("beta"))
+           && names.find("gamma") == names.end(), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Given the desired section and the appropriate information,
+ * performs the tests of that section
+ */
+void doTest(const char section, const bool option, const int size, int& numTestsPassed, int& numTestsFailed, void (*test)(const int, int&, int&)) {
+    cout << BOLD << "–––– Section " << section << " Tests ––––" << RESET << endl;
+    cout << endl;
+    if (option) {
+        (*test)(size, numTestsPassed, numTestsFailed);
+        cout << endl;
+    } else {
+        cout << "SKIP" << endl;
+        cout << endl;
+    }
+}
+
+int main() {
+    cout << BOLD << "Beginning HashMap Tests..." << RESET << endl;
+    cout << endl;
+
+    cout << BOLD << "Section Key" << RESET << endl;
+    cout << "Section A : Constructors/Destructor" << endl;
+    cout << "Section B : Modifiers" << endl;
+    cout << "Section C : Element Viewing" << endl;
+    cout << "Section D : Hash Set" << endl;
+    cout << endl;
+
+    // get testSize
+    int testSize = 0;
+    std::string response;
+    cout << "What is the desired test size (enter/return for default test size): ";
+    std::getline(std::cin, response);
+    if (response.empty()) {
+        testSize = 1000000;
+    } else {
+        testSize = stoi(response);
+    }
+    cout << endl;
+
+    // for use in testing
+    int numTestsFailed = 0;
+    int numTestsPassed = 0;
+
+    doTest('A', section_A, testSize, numTestsPassed, numTestsFailed, testA);
+    doTest('B', section_B, testSize, numTestsPassed, numTestsFailed, testB);
+    doTest('C', section_C, testSize, numTestsPassed, numTestsFailed, testC);
+    doTest('D', section_D, testSize, numTestsPassed, numTestsFailed, testD);
+
+    // Inform user as to which tests passed
+    if (!numTestsFailed) {
+        cout << BOLD << "Passed all " << numTestsPassed << " tests!" << RESET << endl;
+    } else {
+        cout << "Passed " << BOLD << numTestsPassed << RESET << " out of " << BOLD << numTestsPassed + numTestsFailed << RESET << " tests." << endl;
+    }
+
+    return 0;
+}
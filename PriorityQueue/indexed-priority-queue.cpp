@@ -0,0 +1,215 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the indexed-priority-queue.h class
+ */
+#pragma once
+#include "indexed-priority-queue.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::place(size_t index, heapEntry&& entry) {
+    heapEntry& slot = _heap.begin()[index];
+    slot = move(entry);
+    _positions.begin()[slot.id] = index;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::siftUp(size_t index) {
+    heapEntry* heap = _heap.begin();
+    heapEntry entry = move(heap[index]);
+    while (index > 0) {
+        size_t parent = (index - 1) / Arity;
+        if (!_compare(heap[parent].element, entry.element)) {
+            break;
+        }
+        place(index, move(heap[parent]));
+        index = parent;
+    }
+    place(index, move(entry));
+}
+
+template <typename T, typename Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::siftDown(size_t index) {
+    heapEntry* heap = _heap.begin();
+    const size_t count = _heap.size();
+    heapEntry entry = move(heap[index]);
+    while (true) {
+        size_t first = Arity * index + 1;
+        if (first >= count) {
+            break;
+        }
+        size_t last = count - first > Arity ? first + Arity : count;
+        size_t greatest = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (_compare(heap[greatest].element, heap[child].element)) {
+                greatest = child;
+            }
+        }
+        if (!_compare(entry.element, heap[greatest].element)) {
+            break;
+        }
+        place(index, move(heap[greatest]));
+        index = greatest;
+    }
+    place(index, move(entry));
+}
+
+template <typename T, typename Compare, size_t Arity>
+size_t IndexedPriorityQueue<T, Compare, Arity>::locate(handle id, const char* caller) const {
+    if (!contains(id)) {
+        cout << caller << " failed\n";
+        BII_THROW(std::out_of_range("Trying to access a handle not in the queue"));
+    }
+    return _positions.begin()[id];
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::handle IndexedPriorityQueue<T, Compare, Arity>::insert(T&& element) {
+    handle id = 0;
+    if (_freeHandles.empty()) {
+        id = _positions.size();
+        _positions.addBack(none);
+    } else {
+        id = _freeHandles.removeBack();
+    }
+    _heap.addBack(heapEntry{move(element), id});
+    _positions.begin()[id] = _heap.size() - 1;
+    siftUp(_heap.size() - 1);
+    return id;
+}
+
+template <typename T, typename Compare, size_t Arity>
+T IndexedPriorityQueue<T, Compare, Arity>::removeAt(size_t index) {
+    heapEntry* heap = _heap.begin();
+    T element = move(heap[index].element);
+    _positions.begin()[heap[index].id] = none;
+    _freeHandles.addBack(heap[index].id);
+    heapEntry last = _heap.removeBack();
+    if (index < _heap.size()) {
+        // the last entry fills the hole and may belong above or below it
+        place(index, move(last));
+        heap = _heap.begin();
+        if (index > 0 && _compare(heap[(index - 1) / Arity].element, heap[index].element)) {
+            siftUp(index);
+        } else {
+            siftDown(index);
+        }
+    }
+    return element;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+IndexedPriorityQueue<T, Compare, Arity>::IndexedPriorityQueue(const Compare& compare) :
+    _heap(), _positions(), _freeHandles(), _compare(compare) { }
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+inline size_t IndexedPriorityQueue<T, Compare, Arity>::size() const {
+    return _heap.size();
+}
+
+template <typename T, typename Compare, size_t Arity>
+inline bool IndexedPriorityQueue<T, Compare, Arity>::empty() const {
+    return _heap.empty();
+}
+
+template <typename T, typename Compare, size_t Arity>
+inline bool IndexedPriorityQueue<T, Compare, Arity>::contains(handle id) const {
+    return id < _positions.size() && _positions.begin()[id] != none;
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::handle IndexedPriorityQueue<T, Compare, Arity>::push(const T& element) {
+    return insert(T(element));
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::handle IndexedPriorityQueue<T, Compare, Arity>::push(T&& element) {
+    return insert(move(element));
+}
+
+template <typename T, typename Compare, size_t Arity>
+T IndexedPriorityQueue<T, Compare, Arity>::pop() {
+    if (empty()) {
+        cout << "pop failed\n";
+        BII_THROW(empty_queue());
+    }
+    return removeAt(0);
+}
+
+template <typename T, typename Compare, size_t Arity>
+std::optional<T> IndexedPriorityQueue<T, Compare, Arity>::tryPop() {
+    if (empty()) {
+        return std::nullopt;
+    }
+    return removeAt(0);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::decreaseKey(handle id, T element) {
+    size_t index = locate(id, "decreaseKey");
+    heapEntry& entry = _heap.begin()[index];
+    if (_compare(element, entry.element)) {
+        cout << "decreaseKey failed\n";
+        BII_THROW(std::invalid_argument("New element would move away from the top"));
+    }
+    entry.element = move(element);
+    siftUp(index);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::update(handle id, T element) {
+    size_t index = locate(id, "update");
+    heapEntry& entry = _heap.begin()[index];
+    bool rising = _compare(entry.element, element);
+    entry.element = move(element);
+    if (rising) {
+        siftUp(index);
+    } else {
+        siftDown(index);
+    }
+}
+
+template <typename T, typename Compare, size_t Arity>
+T IndexedPriorityQueue<T, Compare, Arity>::erase(handle id) {
+    return removeAt(locate(id, "erase"));
+}
+
+template <typename T, typename Compare, size_t Arity>
+IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::clear() {
+    _heap.clear();
+    _positions.clear();
+    _freeHandles.clear();
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+const T& IndexedPriorityQueue<T, Compare, Arity>::top() const {
+    if (empty()) {
+        cout << "top failed\n";
+        BII_THROW(empty_queue());
+    }
+    return _heap.begin()->element;
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::handle IndexedPriorityQueue<T, Compare, Arity>::topHandle() const {
+    if (empty()) {
+        cout << "topHandle failed\n";
+        BII_THROW(empty_queue());
+    }
+    return _heap.begin()->id;
+}
+
+template <typename T, typename Compare, size_t Arity>
+const T& IndexedPriorityQueue<T, Compare, Arity>::value(handle id) const {
+    return _heap.begin()[locate(id, "value")].element;
+}
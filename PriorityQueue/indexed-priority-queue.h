@@ -0,0 +1,196 @@
+/**
+ * Created on October 19, 2026. IndexedPriorityQueue<T, Compare,
+ * Arity> is a PriorityQueue whose elements can be found again
+ * after they are pushed, for use in projects by BII.
+ *
+ * push returns a handle, and the queue keeps the heap position
+ * of every handle up to date as elements move. With it an element
+ * can be re-prioritized (decreaseKey, update) or taken out (erase)
+ * in O(log N), which is what Dijkstra's algorithm and timer wheels
+ * need. A handle stays valid until its element is popped or erased;
+ * after that it may be handed out again.
+ *
+ * The heap is laid out as in PriorityQueue: Arity children per node,
+ * top is the greatest element by Compare.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added IndexedPriorityQueue with size, empty, contains, push, pop,
+ * tryPop, decreaseKey, update, erase, clear, top, topHandle, and value.
+ */
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Vector/vector.h"
+
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class IndexedPriorityQueue {
+    static_assert(Arity >= 2, "each heap node needs at least two children");
+
+public:
+    /** Identifies an element for as long as it is queued */
+    using handle = size_t;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty queue ordered by the given comparison
+     */
+    explicit IndexedPriorityQueue(const Compare& compare = Compare());
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the queue
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns true if the given handle names a queued element
+     * O(1) asymptotic complexity
+     */
+    inline bool contains(handle id) const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element and returns its handle
+     * O(log N) asymptotic complexity
+     */
+    handle push(const T& element);
+
+    /**
+     * Adds an r-value element and returns its handle
+     * O(log N) asymptotic complexity
+     */
+    handle push(T&& element);
+
+    /**
+     * Removes and returns the greatest element
+     * Throws an error if the queue is empty
+     * O(log N) asymptotic complexity
+     */
+    T pop();
+
+    /**
+     * Removes and returns the greatest element,
+     * or returns nothing if the queue is empty
+     * O(log N) asymptotic complexity
+     */
+    std::optional<T> tryPop();
+
+    /**
+     * Replaces an element with one no less than it, moving it
+     * toward the top (with std::greater, a smaller key)
+     * Throws an error for unknown handles or a lesser element
+     * O(log N) asymptotic complexity
+     */
+    void decreaseKey(handle id, T element);
+
+    /**
+     * Replaces an element with any other, moving it up or down
+     * Throws an error for unknown handles
+     * O(log N) asymptotic complexity
+     */
+    void update(handle id, T element);
+
+    /**
+     * Removes and returns the element with the given handle
+     * Throws an error for unknown handles
+     * O(log N) asymptotic complexity
+     */
+    T erase(handle id);
+
+    /**
+     * Removes every element, keeping the capacity
+     * O(N) asymptotic complexity
+     */
+    IndexedPriorityQueue<T, Compare, Arity>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the greatest element
+     * Throws an error if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    const T& top() const;
+
+    /**
+     * Returns the handle of the greatest element
+     * Throws an error if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    handle topHandle() const;
+
+    /**
+     * Views the element with the given handle
+     * Throws an error for unknown handles
+     * O(1) asymptotic complexity
+     */
+    const T& value(handle id) const;
+
+private:
+    /** A queued element and its handle */
+    struct heapEntry {
+        T element;
+        handle id;
+    };
+
+    /** Marks a handle with no element */
+    static constexpr size_t none = static_cast<size_t>(-1);
+
+    /** The heap, root first */
+    Vector<heapEntry> _heap;
+
+    /** The heap index of each handle, or none */
+    Vector<size_t> _positions;
+
+    /** Handles whose elements have left the queue */
+    Vector<handle> _freeHandles;
+
+    /** The ordering; top is never less than any other element */
+    Compare _compare;
+
+    /**
+     * Stores the entry at the given index and records where it went
+     */
+    void place(size_t index, heapEntry&& entry);
+
+    /**
+     * Moves the entry at the given index up
+     * until its parent is not less than it
+     */
+    void siftUp(size_t index);
+
+    /**
+     * Moves the entry at the given index down
+     * until none of its children is greater
+     */
+    void siftDown(size_t index);
+
+    /**
+     * Returns the heap index of a handle, throwing
+     * an error if it names no queued element
+     */
+    size_t locate(handle id, const char* caller) const;
+
+    /**
+     * Adds an entry for the element and returns its handle
+     */
+    handle insert(T&& element);
+
+    /**
+     * Removes the entry at the given heap index and returns its element
+     */
+    T removeAt(size_t index);
+};
+
+#include "indexed-priority-queue.cpp"
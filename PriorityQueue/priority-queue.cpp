@@ -0,0 +1,192 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the priority-queue.h class
+ */
+#pragma once
+#include "priority-queue.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftUp(size_t index) {
+    // move the element out and shift parents into the hole
+    T* heap = _heap.begin();
+    T element = move(heap[index]);
+    while (index > 0) {
+        size_t parent = (index - 1) / Arity;
+        if (!_compare(heap[parent], element)) {
+            break;
+        }
+        heap[index] = move(heap[parent]);
+        index = parent;
+    }
+    heap[index] = move(element);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftDown(size_t index) {
+    T* heap = _heap.begin();
+    const size_t count = _heap.size();
+    T element = move(heap[index]);
+    while (true) {
+        size_t first = Arity * index + 1;
+        if (first >= count) {
+            break;
+        }
+        size_t last = count - first > Arity ? first + Arity : count;
+        size_t greatest = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (_compare(heap[greatest], heap[child])) {
+                greatest = child;
+            }
+        }
+        if (!_compare(element, heap[greatest])) {
+            break;
+        }
+        heap[index] = move(heap[greatest]);
+        index = greatest;
+    }
+    heap[index] = move(element);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::heapify() {
+    if (_heap.size() < 2) {
+        return;
+    }
+    // every index past the last parent is already a heap of one
+    for (size_t index = (_heap.size() - 2) / Arity + 1; index > 0; index--) {
+        siftDown(index - 1);
+    }
+}
+
+template <typename T, typename Compare, size_t Arity>
+T PriorityQueue<T, Compare, Arity>::takeTop() {
+    T top = move(*_heap.begin());
+    T last = _heap.removeBack();
+    const size_t count = _heap.size();
+    if (count == 0) {
+        return top;
+    }
+    // the last element almost always belongs near the bottom, so walk
+    // the hole down to a leaf without comparing against it, then let
+    // it climb back up the few levels it needs
+    T* heap = _heap.begin();
+    size_t index = 0;
+    while (true) {
+        size_t first = Arity * index + 1;
+        if (first >= count) {
+            break;
+        }
+        size_t end = count - first > Arity ? first + Arity : count;
+        size_t greatest = first;
+        for (size_t child = first + 1; child < end; child++) {
+            if (_compare(heap[greatest], heap[child])) {
+                greatest = child;
+            }
+        }
+        heap[index] = move(heap[greatest]);
+        index = greatest;
+    }
+    while (index > 0) {
+        size_t parent = (index - 1) / Arity;
+        if (!_compare(heap[parent], last)) {
+            break;
+        }
+        heap[index] = move(heap[parent]);
+        index = parent;
+    }
+    heap[index] = move(last);
+    return top;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(const Compare& compare) :
+    _heap(), _compare(compare) { }
+
+template <typename T, typename Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(const Vector<T>& elements, const Compare& compare) :
+    _heap(elements), _compare(compare) {
+    heapify();
+}
+
+template <typename T, typename Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(Vector<T>&& elements, const Compare& compare) :
+    _heap(move(elements)), _compare(compare) {
+    heapify();
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+inline size_t PriorityQueue<T, Compare, Arity>::size() const {
+    return _heap.size();
+}
+
+template <typename T, typename Compare, size_t Arity>
+inline bool PriorityQueue<T, Compare, Arity>::empty() const {
+    return _heap.empty();
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>& PriorityQueue<T, Compare, Arity>::push(const T& element) {
+    _heap.addBack(element);
+    siftUp(_heap.size() - 1);
+    return *this;
+}
+
+template <typename T, typename Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>& PriorityQueue<T, Compare, Arity>::push(T&& element) {
+    _heap.addBack(move(element));
+    siftUp(_heap.size() - 1);
+    return *this;
+}
+
+template <typename T, typename Compare, size_t Arity>
+template <typename... Args>
+PriorityQueue<T, Compare, Arity>& PriorityQueue<T, Compare, Arity>::emplace(Args&&... args) {
+    return push(T(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Compare, size_t Arity>
+T PriorityQueue<T, Compare, Arity>::pop() {
+    if (empty()) {
+        cout << "pop failed\n";
+        BII_THROW(empty_queue());
+    }
+    return takeTop();
+}
+
+template <typename T, typename Compare, size_t Arity>
+std::optional<T> PriorityQueue<T, Compare, Arity>::tryPop() {
+    if (empty()) {
+        return std::nullopt;
+    }
+    return takeTop();
+}
+
+template <typename T, typename Compare, size_t Arity>
+PriorityQueue<T, Compare, Arity>& PriorityQueue<T, Compare, Arity>::clear() {
+    _heap.clear();
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Compare, size_t Arity>
+const T& PriorityQueue<T, Compare, Arity>::top() const {
+    if (empty()) {
+        cout << "top failed\n";
+        BII_THROW(empty_queue());
+    }
+    return *_heap.begin();
+}
+
+template <typename T, typename Compare, size_t Arity>
+const T* PriorityQueue<T, Compare, Arity>::tryTop() const {
+    return _heap.tryFront();
+}
@@ -0,0 +1,152 @@
+/**
+ * Created on October 19, 2026. PriorityQueue<T, Compare, Arity>
+ * is a heap over Vector<T> storage, for use in projects by BII.
+ *
+ * The heap is implicit: the children of index i sit at
+ * Arity * i + 1 through Arity * i + Arity. With four children
+ * per node (the default) the tree is half as deep as a binary
+ * heap, and each node's children share one or two cache lines,
+ * so a pop does fewer dependent loads for a few more compares.
+ *
+ * As with std::priority_queue, top is the greatest element by
+ * Compare; use std::greater<T> for a min-heap.
+ * For changing the priority of an element already queued, see
+ * IndexedPriorityQueue (indexed-priority-queue.h).
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added PriorityQueue with size, empty, push, emplace, pop,
+ * tryPop, clear, top, tryTop, and construction from a Vector.
+ */
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Vector/vector.h"
+
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class PriorityQueue {
+    static_assert(Arity >= 2, "each heap node needs at least two children");
+
+public:
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty queue ordered by the given comparison
+     */
+    explicit PriorityQueue(const Compare& compare = Compare());
+
+    /**
+     * Creates a queue holding copies of the given elements
+     * O(N) asymptotic complexity
+     */
+    explicit PriorityQueue(const Vector<T>& elements, const Compare& compare = Compare());
+
+    /**
+     * Creates a queue from the given elements, taking their storage
+     * O(N) asymptotic complexity
+     */
+    explicit PriorityQueue(Vector<T>&& elements, const Compare& compare = Compare());
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the queue
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the queue
+     * O(log N) asymptotic complexity
+     */
+    PriorityQueue<T, Compare, Arity>& push(const T& element);
+
+    /**
+     * Adds an r-value element to the queue
+     * O(log N) asymptotic complexity
+     */
+    PriorityQueue<T, Compare, Arity>& push(T&& element);
+
+    /**
+     * Constructs an element from the given arguments and adds it
+     * O(log N) asymptotic complexity
+     */
+    template <typename... Args>
+    PriorityQueue<T, Compare, Arity>& emplace(Args&&... args);
+
+    /**
+     * Removes and returns the greatest element
+     * Throws an error if the queue is empty
+     * O(log N) asymptotic complexity
+     */
+    T pop();
+
+    /**
+     * Removes and returns the greatest element,
+     * or returns nothing if the queue is empty
+     * O(log N) asymptotic complexity
+     */
+    std::optional<T> tryPop();
+
+    /**
+     * Removes every element, keeping the capacity
+     * O(N) asymptotic complexity
+     */
+    PriorityQueue<T, Compare, Arity>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the greatest element
+     * Throws an error if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    const T& top() const;
+
+    /**
+     * Returns a pointer to the greatest element,
+     * or nullptr if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    const T* tryTop() const;
+
+private:
+    /** The heap, root first */
+    Vector<T> _heap;
+
+    /** The ordering; top is never less than any other element */
+    Compare _compare;
+
+    /**
+     * Moves the element at the given index up
+     * until its parent is not less than it
+     */
+    void siftUp(size_t index);
+
+    /**
+     * Moves the element at the given index down
+     * until none of its children is greater
+     */
+    void siftDown(size_t index);
+
+    /**
+     * Orders the whole array into a heap, bottom up
+     * O(N) asymptotic complexity
+     */
+    void heapify();
+
+    /**
+     * Removes and returns the root; the queue must not be empty
+     */
+    T takeTop();
+};
+
+#include "priority-queue.cpp"
@@ -0,0 +1,310 @@
+/**
+ * Created on October 19, 2026. Testing harness for the
+ * PriorityQueue<T> and IndexedPriorityQueue<T> classes.
+ */
+#include "priority-queue.h"
+#include "indexed-priority-queue.h"
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Test Settings
+const bool section_A = true; // Constructors/Destructor (3 Methods)
+const bool section_B = true; // Modifiers (6 Methods)
+const bool section_C = true; // Element Viewing (2 Methods)
+const bool section_D = true; // Indexed Priority Queue (8 Methods)
+
+/**
+ * Given two values, returns true if they are equal
+ * as the type of the first
+ */
+template <typename T, typename S>
+bool expectEqual(T first, S second) {
+    return first == static_cast<T>(second);
+}
+
+/**
+ * Prints and counts the outcome of a single test
+ */
+void report(const char* name, bool passed, int& numTestsPassed, int& numTestsFailed) {
+    if (passed) {
+        cout << name << " : PASSED" << endl;
+        numTestsPassed++;
+    } else {
+        cout << name << " : FAILED" << endl;
+        numTestsFailed++;
+    }
+}
+
+/**
+ * Returns the i-th value of a scrambled sequence with repeats
+ */
+int scrambled(int i) {
+    return static_cast<int>((i * 2654435761u) % 10007);
+}
+
+/**
+ * Pops every element and returns true if they
+ * came out in order (greatest first by Compare)
+ */
+template <typename T, typename Compare, size_t Arity>
+bool drainsInOrder(PriorityQueue<T, Compare, Arity>& queue, std::vector<T> expected, Compare compare = Compare()) {
+    std::sort(expected.begin(), expected.end(), [&](const T& left, const T& right) { return compare(right, left); });
+    bool ordered = expectEqual(queue.size(), expected.size());
+    for (const T& value : expected) {
+        ordered = ordered && expectEqual(queue.pop(), value);
+    }
+    return ordered && queue.empty();
+}
+
+/**
+ * Macro for testing PriorityQueue Constructor/Destructor methods
+ */
+void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
+    PriorityQueue<int> empty;
+    report("Default Constructor", empty.empty() && expectEqual(empty.size(), 0),
+           numTestsPassed, numTestsFailed);
+
+    Vector<int> values;
+    std::vector<int> expected;
+    for (int i = 0; i < size; i++) {
+        values.addBack(scrambled(i));
+        expected.push_back(scrambled(i));
+    }
+    PriorityQueue<int> copied(values);
+    report("Heapify (copy)", drainsInOrder(copied, expected) && expectEqual(values.size(), size),
+           numTestsPassed, numTestsFailed);
+
+    PriorityQueue<int, std::greater<int>, 3> moved(move(values), std::greater<int>());
+    report("Heapify (move)", drainsInOrder(moved, expected) && values.empty(),
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing PriorityQueue Modifier methods
+ */
+void testB(const int size, int& numTestsPassed, int& numTestsFailed) {
+    std::vector<int> expected;
+    PriorityQueue<int, std::less<int>, 2> binary;
+    PriorityQueue<int> quaternary;
+    PriorityQueue<int, std::less<int>, 8> octonary;
+    for (int i = 0; i < size; i++) {
+        expected.push_back(scrambled(i));
+        binary.push(scrambled(i));
+        quaternary.push(scrambled(i));
+        octonary.push(scrambled(i));
+    }
+    report("Push/Pop (arity 2)", drainsInOrder(binary, expected), numTestsPassed, numTestsFailed);
+    report("Push/Pop (arity 4)", drainsInOrder(quaternary, expected), numTestsPassed, numTestsFailed);
+    report("Push/Pop (arity 8)", drainsInOrder(octonary, expected), numTestsPassed, numTestsFailed);
+
+    // interleave pushes and pops of strings in a min-heap
+    PriorityQueue<std::string, std::greater<std::string>> words;
+    std::multiset<std::string> reference;
+    bool interleaved = true;
+    for (int i = 0; i < size; i++) {
+        std::string word = std::to_string(scrambled(i));
+        if (i % 2) {
+            words.push(word);
+        } else {
+            words.emplace(word.begin(), word.end());
+        }
+        reference.insert(word);
+        if (i % 3 == 2) {
+            interleaved = interleaved && expectEqual(words.pop(), *reference.begin());
+            reference.erase(reference.begin());
+        }
+    }
+    report("Push/Emplace/Pop (interleaved)", interleaved && expectEqual(words.size(), reference.size()),
+           numTestsPassed, numTestsFailed);
+
+    words.clear();
+    bool threw = false;
+    try {
+        words.pop();
+    } catch (const empty_queue&) {
+        threw = true;
+    }
+    report("TryPop/Clear", threw && words.empty() && !words.tryPop(), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing PriorityQueue Element Viewing methods
+ */
+void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
+    PriorityQueue<int> queue;
+    int greatest = 0;
+    bool tracked = true;
+    for (int i = 0; i < size; i++) {
+        queue.push(scrambled(i));
+        greatest = std::max(greatest, scrambled(i));
+        tracked = tracked && expectEqual(queue.top(), greatest) && expectEqual(*queue.tryTop(), greatest);
+    }
+    report("Top", tracked, numTestsPassed, numTestsFailed);
+
+    queue.clear();
+    bool threw = false;
+    try {
+        queue.top();
+    } catch (const empty_container&) {
+        threw = true;
+    }
+    report("TryTop (empty)", threw && queue.tryTop() == nullptr, numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing IndexedPriorityQueue methods
+ */
+void testD(const int size, int& numTestsPassed, int& numTestsFailed) {
+    // a min-heap checked against an ordered set of (key, handle)
+    IndexedPriorityQueue<int, std::greater<int>> queue;
+    std::set<std::pair<int, size_t>> reference;
+    std::vector<size_t> live;
+    std::vector<size_t> slotOf;
+    size_t handles = 0;
+    auto forget = [&](size_t id) {
+        size_t slot = slotOf[id];
+        live[slot] = live.back();
+        slotOf[live[slot]] = slot;
+        live.pop_back();
+    };
+    bool matched = true;
+    for (int i = 0; i < size && matched; i++) {
+        int key = scrambled(i);
+        if (i % 5 < 2) {
+            size_t id = queue.push(key);
+            reference.insert({key, id});
+            if (id >= slotOf.size()) slotOf.resize(id + 1);
+            slotOf[id] = live.size();
+            live.push_back(id);
+            handles = std::max(handles, id + 1);
+        } else if (!live.empty()) {
+            size_t id = live[key % live.size()];
+            int held = queue.value(id);
+            reference.erase({held, id});
+            if (i % 5 == 2) {
+                int lower = held - key % 50 - 1;
+                queue.decreaseKey(id, lower);
+                reference.insert({lower, id});
+            } else if (i % 5 == 3) {
+                queue.update(id, key);
+                reference.insert({key, id});
+            } else if (i % 2) {
+                matched = matched && expectEqual(queue.erase(id), held);
+                forget(id);
+                matched = matched && !queue.contains(id);
+            } else {
+                reference.insert({held, id});
+                // equal keys may leave in either order, so compare keys
+                size_t least = queue.topHandle();
+                int popped = queue.pop();
+                matched = matched && expectEqual(popped, reference.begin()->first);
+                reference.erase({popped, least});
+                forget(least);
+                matched = matched && !queue.contains(least);
+            }
+        }
+        matched = matched && expectEqual(queue.size(), reference.size());
+        if (!reference.empty()) {
+            matched = matched && expectEqual(queue.top(), reference.begin()->first);
+        }
+    }
+    report("Push/Pop/Erase/DecreaseKey/Update", matched, numTestsPassed, numTestsFailed);
+
+    // drain in order, then reuse a freed handle
+    bool drained = true;
+    for (const std::pair<int, size_t>& entry : reference) {
+        drained = drained && expectEqual(queue.pop(), entry.first);
+    }
+    drained = drained && queue.empty();
+    size_t reused = queue.push(7);
+    std::optional<int> seven = queue.tryPop();
+    drained = drained && (handles == 0 || reused < handles) && seven && expectEqual(*seven, 7);
+    report("Drain/Handle Reuse", drained && queue.empty(), numTestsPassed, numTestsFailed);
+
+    // decreaseKey refuses to move an element away from the top
+    size_t id = queue.push(10);
+    bool refused = false;
+    try {
+        queue.decreaseKey(id, 11);
+    } catch (const std::invalid_argument&) {
+        refused = true;
+    }
+    queue.erase(id);
+    bool unknown = false;
+    try {
+        queue.value(id);
+    } catch (const std::out_of_range&) {
+        unknown = true;
+    }
+    report("DecreaseKey/Value (invalid)", refused && unknown && queue.empty(), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Given the desired section and the appropriate information,
+ * performs the tests of that section
+ */
+void doTest(const char section, const bool option, const int size, int& numTestsPassed, int& numTestsFailed, void (*test)(const int, int&, int&)) {
+    cout << BOLD << "–––– Section " << section << " Tests ––––" << RESET << endl;
+    cout << endl;
+    if (option) {
+        (*test)(size, numTestsPassed, numTestsFailed);
+        cout << endl;
+    } else {
+        cout << "SKIP" << endl;
+        cout << endl;
+    }
+}
+
+int main() {
+    cout << BOLD << "Beginning PriorityQueue Tests..." << RESET << endl;
+    cout << endl;
+
+    cout << BOLD << "Section Key" << RESET << endl;
+    cout << "Section A : Constructors/Destructor" << endl;
+    cout << "Section B : Modifiers" << endl;
+    cout << "Section C : Element Viewing" << endl;
+    cout << "Section D : Indexed Priority Queue" << endl;
+    cout << endl;
+
+    // get testSize
+    int testSize = 0;
+    std::string response;
+    cout << "What is the desired test size (enter/return for default test size): ";
+    std::getline(std::cin, response);
+    if (response.empty()) {
+        testSize = 1000000;
+    } else {
+        testSize = stoi(response);
+    }
+    cout << endl;
+
+    // for use in testing
+    int numTestsFailed = 0;
+    int numTestsPassed = 0;
+
+    doTest('A', section_A, testSize, numTestsPassed, numTestsFailed, testA);
+    doTest('B', section_B, testSize, numTestsPassed, numTestsFailed, testB);
+    doTest('C', section_C, testSize, numTestsPassed, numTestsFailed, testC);
+    doTest('D', section_D, testSize, numTestsPassed, numTestsFailed, testD);
+
+    // Inform user as to which tests passed
+    if (!numTestsFailed) {
+        cout << BOLD << "Passed all " << numTestsPassed << " tests!" << RESET << endl;
+    } else {
+        cout << "Passed " << BOLD << numTestsPassed << RESET << " out of " << BOLD << numTestsPassed + numTestsFailed << RESET << " tests." << endl;
+    }
+
+    return 0;
+}
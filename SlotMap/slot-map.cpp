@@ -0,0 +1,242 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the slot-map.h class
+ */
+#pragma once
+#include "slot-map.h"
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+SlotMap<T>::SlotMap() : _values(0), _owners(0), _slots(0), _freeHead(none) { }
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t SlotMap<T>::size() const {
+    return _values.size();
+}
+
+template <typename T>
+inline bool SlotMap<T>::empty() const {
+    return _values.empty();
+}
+
+template <typename T>
+void SlotMap<T>::reserve(size_t count) {
+    size_t room = _values.capacity() - _values.size();
+    if (count > room) {
+        _values.reserve(count - room);
+        _owners.reserve(count - room);
+    }
+    // slots on the free list need no new entries
+    size_t free = _slots.size() - _values.size();
+    room = _slots.capacity() - _slots.size() + free;
+    if (count > room) {
+        _slots.reserve(count - room);
+    }
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+slotHandle SlotMap<T>::insert(const T& value) {
+    _values.addBack(value);
+    return claim();
+}
+
+template <typename T>
+slotHandle SlotMap<T>::insert(T&& value) {
+    _values.addBack(std::move(value));
+    return claim();
+}
+
+template <typename T>
+template <typename... Args>
+slotHandle SlotMap<T>::emplace(Args&&... args) {
+    _values.addBack(T(std::forward<Args>(args)...));
+    return claim();
+}
+
+template <typename T>
+bool SlotMap<T>::erase(slotHandle handle) {
+    uint32_t position = positionOf(handle);
+    if (position == none) {
+        return false;
+    }
+    T* values = _values.begin();
+    uint32_t* owners = _owners.begin();
+    slotEntry* slots = _slots.begin();
+    uint32_t last = static_cast<uint32_t>(_values.size() - 1);
+    if (position != last) {
+        values[position] = std::move(values[last]);
+        owners[position] = owners[last];
+        slots[owners[position]].position = position;
+    }
+    _values.removeBack();
+    _owners.removeBack();
+    slotEntry& slot = slots[handle.index];
+    slot.generation++;
+    // a slot whose generation wrapped to 0 is retired
+    if (slot.generation != 0) {
+        slot.position = _freeHead;
+        _freeHead = handle.index;
+    }
+    return true;
+}
+
+template <typename T>
+void SlotMap<T>::clear() {
+    slotEntry* slots = _slots.begin();
+    for (uint32_t owner : _owners) {
+        slotEntry& slot = slots[owner];
+        slot.generation++;
+        if (slot.generation != 0) {
+            slot.position = _freeHead;
+            _freeHead = owner;
+        }
+    }
+    _values.clear();
+    _owners.clear();
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+bool SlotMap<T>::contains(slotHandle handle) const {
+    return positionOf(handle) != none;
+}
+
+template <typename T>
+T& SlotMap<T>::at(slotHandle handle) {
+    return const_cast<T&>(static_cast<const SlotMap<T>&>(*this).at(handle));
+}
+
+template <typename T>
+const T& SlotMap<T>::at(slotHandle handle) const {
+    const T* value = tryAt(handle);
+    if (value == nullptr) {
+        cout << "at failed\n";
+        BII_THROW(std::out_of_range("stale slot handle"));
+    }
+    return *value;
+}
+
+template <typename T>
+T* SlotMap<T>::tryAt(slotHandle handle) {
+    return const_cast<T*>(static_cast<const SlotMap<T>&>(*this).tryAt(handle));
+}
+
+template <typename T>
+const T* SlotMap<T>::tryAt(slotHandle handle) const {
+    uint32_t position = positionOf(handle);
+    return position == none ? nullptr : _values.begin() + position;
+}
+
+template <typename T>
+slotHandle SlotMap<T>::handleAt(size_t position) const {
+    if (position >= _owners.size()) {
+        cout << "handleAt failed\n";
+        BII_THROW(std::out_of_range("Trying to access position outside of slot map"));
+    }
+    uint32_t owner = _owners.begin()[position];
+    return slotHandle{owner, _slots.begin()[owner].generation};
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+T& SlotMap<T>::operator[](slotHandle handle) {
+    return at(handle);
+}
+
+template <typename T>
+const T& SlotMap<T>::operator[](slotHandle handle) const {
+    return at(handle);
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename SlotMap<T>::iterator SlotMap<T>::begin() {
+    return _values.begin();
+}
+
+template <typename T>
+typename SlotMap<T>::iterator SlotMap<T>::end() {
+    return _values.begin() + _values.size();
+}
+
+template <typename T>
+typename SlotMap<T>::const_iterator SlotMap<T>::begin() const {
+    return _values.begin();
+}
+
+template <typename T>
+typename SlotMap<T>::const_iterator SlotMap<T>::end() const {
+    return _values.begin() + _values.size();
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T_>
+bool operator==(const SlotMap<T_>& first, const SlotMap<T_>& second) {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    const T_* values = first.begin();
+    for (size_t i = 0; i < first.size(); i++) {
+        const T_* other = second.tryAt(first.handleAt(i));
+        if (other == nullptr || !(*other == values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T_>
+bool operator!=(const SlotMap<T_>& first, const SlotMap<T_>& second) {
+    return !(first == second);
+}
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+uint32_t SlotMap<T>::positionOf(slotHandle handle) const {
+    if (handle.index >= _slots.size()) {
+        return none;
+    }
+    const slotEntry& slot = _slots.begin()[handle.index];
+    return slot.generation == handle.generation ? slot.position : none;
+}
+
+template <typename T>
+slotHandle SlotMap<T>::claim() {
+    uint32_t position = static_cast<uint32_t>(_values.size() - 1);
+    uint32_t index = _freeHead;
+    BII_TRY {
+        if (index == none && _slots.size() >= none) {
+            cout << "insert failed\n";
+            BII_THROW(std::length_error("SlotMap holds at most 2^32 - 1 slots"));
+        }
+        _owners.addBack(index == none ? static_cast<uint32_t>(_slots.size()) : index);
+        if (index == none) {
+            BII_TRY {
+                // free slots have even generations, so new ones start at 1
+                _slots.addBack(slotEntry{position, 1});
+            } BII_CATCH_ALL {
+                _owners.removeBack();
+                BII_RETHROW;
+            }
+            return slotHandle{static_cast<uint32_t>(_slots.size() - 1), 1};
+        }
+    } BII_CATCH_ALL {
+        _values.removeBack();
+        BII_RETHROW;
+    }
+    slotEntry& slot = _slots.begin()[index];
+    _freeHead = slot.position;
+    slot.position = position;
+    slot.generation++;
+    return slotHandle{index, slot.generation};
+}
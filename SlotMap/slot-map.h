@@ -0,0 +1,231 @@
+/**
+ * Created on October 19, 2026. SlotMap<T> stores values under
+ * handles that never go stale silently, for use in projects by BII.
+ *
+ * insert returns a slotHandle: the index of a slot plus the slot's
+ * generation, packed into 64 bits. Erasing a value bumps its slot's
+ * generation, so every handle to it stops matching, and the slot
+ * goes on a free list for the next insert to reuse. A lookup is one
+ * bounds check and one generation compare; a stale handle fails
+ * there, with no hashing and no probing.
+ *
+ * The values themselves are kept densely in a Vector<T> and walked
+ * by the iterators in that order; erase moves the last value into
+ * the hole, so the order is not insertion order. Each slot records
+ * where its value sits, and each value which slot owns it.
+ *
+ * Generations are odd while a slot is occupied and even while it is
+ * free, so a free slot can never match a handle. A slot whose
+ * generation would wrap around is retired instead of reused.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added SlotMap with insert, emplace, erase, clear, reserve, contains,
+ * at, [], tryAt, handleAt, iterators, ==, and !=.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Vector/vector.h"
+
+/**
+ * A slot index and the generation it had when the handle was
+ * made, in 64 bits
+ */
+struct slotHandle {
+    uint32_t index;
+    uint32_t generation;
+
+    /** Returns the handle packed into one integer */
+    uint64_t raw() const { return (uint64_t(generation) << 32) | index; }
+
+    /** Unpacks a handle made by raw */
+    static slotHandle fromRaw(uint64_t bits) {
+        return slotHandle{static_cast<uint32_t>(bits), static_cast<uint32_t>(bits >> 32)};
+    }
+
+    friend bool operator==(const slotHandle& left, const slotHandle& right) {
+        return left.index == right.index && left.generation == right.generation;
+    }
+
+    friend bool operator!=(const slotHandle& left, const slotHandle& right) {
+        return !(left == right);
+    }
+};
+
+template <typename T>
+class SlotMap {
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty map without allocating
+     */
+    SlotMap();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of values
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if there are no values
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Makes room for the given number of further inserts
+     */
+    void reserve(size_t count);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Stores a copy of the given value and returns its handle
+     * O(1) amortized asymptotic complexity
+     */
+    slotHandle insert(const T& value);
+
+    /**
+     * Stores the given r-value and returns its handle
+     * O(1) amortized asymptotic complexity
+     */
+    slotHandle insert(T&& value);
+
+    /**
+     * Stores a value constructed from the given arguments
+     * and returns its handle
+     * O(1) amortized asymptotic complexity
+     */
+    template <typename... Args>
+    slotHandle emplace(Args&&... args);
+
+    /**
+     * Removes the value under the given handle; returns
+     * false if the handle is stale
+     * O(1) asymptotic complexity
+     */
+    bool erase(slotHandle handle);
+
+    /**
+     * Removes every value, making every handle stale
+     * and keeping the capacity
+     */
+    void clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns true if the handle still names a value
+     * O(1) asymptotic complexity
+     */
+    bool contains(slotHandle handle) const;
+
+    /**
+     * Returns the value under the given handle
+     * Throws an error if the handle is stale
+     */
+    T& at(slotHandle handle);
+    const T& at(slotHandle handle) const;
+
+    /**
+     * Returns a pointer to the value under the given handle,
+     * or nullptr if the handle is stale
+     */
+    T* tryAt(slotHandle handle);
+    const T* tryAt(slotHandle handle) const;
+
+    /**
+     * Returns the handle of the value at the given position
+     * of the dense array (the order of the iterators)
+     * Throws an error for invalid positions
+     */
+    slotHandle handleAt(size_t position) const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the value under the given handle
+     * Throws an error if the handle is stale
+     */
+    T& operator[](slotHandle handle);
+    const T& operator[](slotHandle handle) const;
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator to the first value of the dense array
+     */
+    iterator begin();
+
+    /**
+     * Iterator past the last value of the dense array
+     */
+    iterator end();
+
+    /**
+     * Const iterator to the first value of the dense array
+     */
+    const_iterator begin() const;
+
+    /**
+     * Const iterator past the last value of the dense array
+     */
+    const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two maps, returns true if the same handles name
+     * equal values in both
+     */
+    template <typename T_>
+    friend bool operator==(const SlotMap<T_>& first, const SlotMap<T_>& second);
+
+    /**
+     * Given two maps, returns true if some handle names
+     * different values, or a value in only one of them
+     */
+    template <typename T_>
+    friend bool operator!=(const SlotMap<T_>& first, const SlotMap<T_>& second);
+
+private:
+    /** Marks the end of the free list */
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    /** One slot: where its value sits, or the next free slot */
+    struct slotEntry {
+        uint32_t position;
+        uint32_t generation;
+    };
+
+    /* the values, densely */
+    Vector<T> _values;
+
+    /* the slot that owns each value */
+    Vector<uint32_t> _owners;
+
+    /* every slot ever handed out */
+    Vector<slotEntry> _slots;
+
+    /* the most recently freed slot, or none */
+    uint32_t _freeHead;
+
+    /**
+     * Returns the position of the handle's value, or none if stale
+     */
+    uint32_t positionOf(slotHandle handle) const;
+
+    /**
+     * Takes a slot for a value about to be added at the back
+     * of the dense array and returns its handle
+     */
+    slotHandle claim();
+};
+
+#include "slot-map.cpp"
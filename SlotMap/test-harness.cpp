@@ -0,0 +1,257 @@
+/**
+ * Created on October 19, 2026. Testing harness for the
+ * SlotMap<T> class.
+ */
+#include "slot-map.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+using std::cout;
+using std::endl;
+
+// Color definitions
+#define BOLD "\033[1m"
+#define RESET "\033[0m"
+
+// Test Settings
+const bool section_A = true; // Constructors/Destructor (3 Methods)
+const bool section_B = true; // Modifiers (5 Methods)
+const bool section_C = true; // Element Viewing (5 Methods)
+
+/**
+ * Given two values, returns true if they are equal
+ * as the type of the first
+ */
+template <typename T, typename S>
+bool expectEqual(T first, S second) {
+    return first == static_cast<T>(second);
+}
+
+/**
+ * Prints and counts the outcome of a single test
+ */
+void report(const char* name, bool passed, int& numTestsPassed, int& numTestsFailed) {
+    if (passed) {
+        cout << name << " : PASSED" << endl;
+        numTestsPassed++;
+    } else {
+        cout << name << " : FAILED" << endl;
+        numTestsFailed++;
+    }
+}
+
+/**
+ * Given a map and a reference from raw handles to values, returns
+ * true if they hold the same values under the same handles
+ */
+template <typename T>
+bool matches(const SlotMap<T>& map, const std::unordered_map<uint64_t, T>& reference) {
+    if (map.size() != reference.size()) {
+        return false;
+    }
+    for (const std::pair<const uint64_t, T>& entry : reference) {
+        const T* value = map.tryAt(slotHandle::fromRaw(entry.first));
+        if (value == nullptr || !(*value == entry.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Macro for testing SlotMap Constructors/Destructor
+ */
+void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
+    SlotMap<int> empty;
+    report("Default Constructor", empty.empty() && expectEqual(empty.size(), 0) && empty.begin() == empty.end()
+           && !empty.contains(slotHandle{0, 1}), numTestsPassed, numTestsFailed);
+
+    SlotMap<std::string> map;
+    Vector<slotHandle> handles;
+    for (int i = 0; i < size; i++) {
+        handles.addBack(map.insert(std::to_string(i)));
+    }
+    SlotMap<std::string> copied(map);
+    bool same = copied == map;
+    copied.erase(handles[0]);
+    report("Copy Constructor", same && copied != map && map.contains(handles[0]) && expectEqual(map[handles[0]], "0"),
+           numTestsPassed, numTestsFailed);
+
+    SlotMap<std::string> moved(std::move(copied));
+    SlotMap<std::string> assigned;
+    assigned = moved;
+    report("Move Constructor/Assignment", expectEqual(moved.size(), size - 1) && assigned == moved
+           && (size < 2 || expectEqual(assigned[handles[1]], "1")), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing SlotMap Modifiers
+ */
+void testB(const int size, int& numTestsPassed, int& numTestsFailed) {
+    SlotMap<int> map;
+    std::unordered_map<uint64_t, int> reference;
+    Vector<slotHandle> handles;
+    bool unique = true;
+    for (int i = 0; i < size; i++) {
+        slotHandle handle = map.insert(i);
+        unique = unique && reference.emplace(handle.raw(), i).second;
+        handles.addBack(handle);
+    }
+    report("Insert", unique && matches(map, reference), numTestsPassed, numTestsFailed);
+
+    // erase every third value; the rest keep their handles
+    bool erased = true;
+    for (int i = 0; i < size; i += 3) {
+        erased = erased && map.erase(handles[i]) && !map.erase(handles[i]);
+        reference.erase(handles[i].raw());
+    }
+    bool stale = true;
+    for (int i = 0; i < size; i += 3) {
+        stale = stale && !map.contains(handles[i]) && map.tryAt(handles[i]) == nullptr;
+    }
+    report("Erase", erased && stale && matches(map, reference), numTestsPassed, numTestsFailed);
+
+    // reused slots come back under new generations
+    bool reused = true;
+    for (int i = 0; i < size; i += 3) {
+        slotHandle handle = map.insert(-i);
+        reused = reused && handle != handles[i] && !map.contains(handles[i]) && reference.emplace(handle.raw(), -i).second;
+    }
+    report("Insert (reused slots)", reused && matches(map, reference), numTestsPassed, numTestsFailed);
+
+    SlotMap<std::pair<int, std::string>> pairs;
+    slotHandle first = pairs.emplace(1, "one");
+    slotHandle second = pairs.emplace(2, std::string(40, 'x'));
+    std::string text = "moved";
+    slotHandle third = pairs.insert(std::make_pair(3, std::move(text)));
+    report("Emplace/Insert (r-value)", expectEqual(pairs[first].second, "one") && expectEqual(pairs[second].second.size(), 40)
+           && expectEqual(pairs[third].first, 3) && expectEqual(pairs[third].second, "moved"), numTestsPassed, numTestsFailed);
+
+    map.reserve(size);
+    size_t before = map.size();
+    map.clear();
+    bool cleared = map.empty() && map.begin() == map.end();
+    for (int i = 1; i < size; i += 3) {
+        cleared = cleared && !map.contains(handles[i]);
+    }
+    slotHandle fresh = map.insert(5);
+    report("Clear/Reserve", cleared && before > 0 && expectEqual(map[fresh], 5) && expectEqual(map.size(), 1),
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing SlotMap Element Viewing methods
+ */
+void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
+    SlotMap<int> map;
+    Vector<slotHandle> handles;
+    for (int i = 0; i < size; i++) {
+        handles.addBack(map.insert(i * 2));
+    }
+    bool found = true;
+    for (int i = 0; i < size; i++) {
+        found = found && expectEqual(map.at(handles[i]), i * 2) && expectEqual(map[handles[i]], i * 2)
+                && expectEqual(*map.tryAt(handles[i]), i * 2);
+    }
+    report("At/[]/TryAt", found, numTestsPassed, numTestsFailed);
+
+    bool threw = false;
+    map.erase(handles[0]);
+    try {
+        map.at(handles[0]);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    const SlotMap<int>& constant = map;
+    slotHandle forged{handles[size - 1].index + 1000, 1};
+    slotHandle wrongGeneration{handles[size - 1].index, handles[size - 1].generation + 2};
+    report("At (stale handles)", threw && constant.tryAt(handles[0]) == nullptr && constant.tryAt(forged) == nullptr
+           && !constant.contains(wrongGeneration) && !map.erase(forged), numTestsPassed, numTestsFailed);
+
+    bool paired = true;
+    long long sum = 0;
+    size_t position = 0;
+    for (const int& value : constant) {
+        slotHandle handle = constant.handleAt(position++);
+        paired = paired && &constant[handle] == &value;
+        sum += value;
+    }
+    report("Iterators/HandleAt", paired && expectEqual(position, map.size())
+           && expectEqual(sum, (long long)size * (size - 1)), numTestsPassed, numTestsFailed);
+
+    bool outside = false;
+    try {
+        map.handleAt(map.size());
+    } catch (const std::out_of_range&) {
+        outside = true;
+    }
+    report("HandleAt (invalid position)", outside, numTestsPassed, numTestsFailed);
+
+    slotHandle handle = handles[size / 2];
+    uint64_t raw = handle.raw();
+    report("Handle Raw/FromRaw", sizeof(slotHandle) == 8 && slotHandle::fromRaw(raw) == handle
+           && expectEqual(raw >> 32, handle.generation) && expectEqual(raw & 0xffffffffu, handle.index),
+           numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Given the desired section and the appropriate information,
+ * performs the tests of that section
+ */
+void doTest(const char section, const bool option, const int size, int& numTestsPassed, int& numTestsFailed, void (*test)(const int, int&, int&)) {
+    cout << BOLD << "–––– Section " << section << " Tests ––––" << RESET << endl;
+    cout << endl;
+    if (option) {
+        (*test)(size, numTestsPassed, numTestsFailed);
+        cout << endl;
+    } else {
+        cout << "SKIP" << endl;
+        cout << endl;
+    }
+}
+
+int main() {
+    cout << BOLD << "Beginning SlotMap Tests..." << RESET << endl;
+    cout << endl;
+
+    cout << BOLD << "Section Key" << RESET << endl;
+    cout << "Section A : Constructors/Destructor" << endl;
+    cout << "Section B : Modifiers" << endl;
+    cout << "Section C : Element Viewing" << endl;
+    cout << endl;
+
+    // get testSize
+    int testSize = 0;
+    std::string response;
+    cout << "What is the desired test size (enter/return for default test size): ";
+    std::getline(std::cin, response);
+    if (response.empty()) {
+        testSize = 1000000;
+    } else {
+        testSize = stoi(response);
+    }
+    if (testSize < 1) {
+        testSize = 1;
+    }
+    cout << endl;
+
+    // for use in testing
+    int numTestsFailed = 0;
+    int numTestsPassed = 0;
+
+    doTest('A', section_A, testSize, numTestsPassed, numTestsFailed, testA);
+    doTest('B', section_B, testSize, numTestsPassed, numTestsFailed, testB);
+    doTest('C', section_C, testSize, numTestsPassed, numTestsFailed, testC);
+
+    // Inform user as to which tests passed
+    if (!numTestsFailed) {
+        cout << BOLD << "Passed all " << numTestsPassed << " tests!" << RESET << endl;
+    } else {
+        cout << "Passed " << BOLD << numTestsPassed << RESET << " out of " << BOLD << numTestsPassed + numTestsFailed << RESET << " tests." << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * Created on October 19, 2026. Span<T> is a
+ * non-owning view of a contiguous run of elements,
+ * handed out by BII containers for bulk processing.
+ *
+ * A span never allocates or frees; it is only valid
+ * while the container it came from is left unchanged.
+ */
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include "../Exceptions/exception.h"
+
+template <typename T>
+class Span {
+public:
+
+    using iterator = T*;
+    using value_type = T;
+
+    /**
+     * Default Constructor
+     * Creates an empty span
+     */
+    constexpr Span() : _data(nullptr), _size(0) { }
+
+    /**
+     * Creates a span over size elements starting at data
+     */
+    constexpr Span(T* data, size_t size) : _data(data), _size(size) { }
+
+    /**
+     * Returns the number of elements in the span
+     * O(1) asymptotic complexity
+     */
+    constexpr size_t size() const { return _size; }
+
+    /**
+     * Returns true if the span is empty
+     * O(1) asymptotic complexity
+     */
+    constexpr bool empty() const { return _size == 0; }
+
+    /**
+     * Returns a pointer to the first element
+     */
+    constexpr T* data() const { return _data; }
+
+    /**
+     * Returns the element at a given index without
+     * checking it
+     */
+    constexpr T& operator[](const size_t index) const { return _data[index]; }
+
+    /**
+     * Returns the element at a given index
+     * Throws an error for invalid indexes
+     */
+    constexpr T& check(const size_t index) const {
+        if (index >= _size) {
+            std::cout << "Check failed\n";
+            BII_THROW(std::out_of_range("Trying to access index outside of span"));
+        }
+        return _data[index];
+    }
+
+    /**
+     * Iterator with initial position at front of the span
+     */
+    constexpr T* begin() const { return _data; }
+
+    /**
+     * Iterator with initial position at back of the span
+     */
+    constexpr T* end() const { return _data + _size; }
+
+private:
+    /* the first element viewed */
+    T* _data;
+
+    /* the number of elements viewed */
+    size_t _size;
+};
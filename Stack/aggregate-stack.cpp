@@ -0,0 +1,160 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the aggregate-stack.h classes
+ */
+#pragma once
+#include "aggregate-stack.h"
+
+// AggregateStack ––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Monoid>
+AggregateStack<T, Monoid>::AggregateStack(const Monoid& monoid) :
+    _entries(), _monoid(monoid) { }
+
+template <typename T, typename Monoid>
+inline size_t AggregateStack<T, Monoid>::size() const {
+    return _entries.size();
+}
+
+template <typename T, typename Monoid>
+inline bool AggregateStack<T, Monoid>::empty() const {
+    return _entries.empty();
+}
+
+template <typename T, typename Monoid>
+AggregateStack<T, Monoid>& AggregateStack<T, Monoid>::push(const T& element) {
+    return push(T(element));
+}
+
+template <typename T, typename Monoid>
+AggregateStack<T, Monoid>& AggregateStack<T, Monoid>::push(T&& element) {
+    value_type lifted = _monoid.lift(element);
+    if (!empty()) {
+        lifted = _monoid.combine(_entries.back().aggregate, lifted);
+    }
+    _entries.addBack(aggregateEntry{move(element), move(lifted)});
+    return *this;
+}
+
+template <typename T, typename Monoid>
+T AggregateStack<T, Monoid>::pull() {
+    if (empty()) {
+        cout << "pull failed\n";
+        BII_THROW(empty_stack());
+    }
+    return move(_entries.removeBack().element);
+}
+
+template <typename T, typename Monoid>
+AggregateStack<T, Monoid>& AggregateStack<T, Monoid>::clear() {
+    _entries.clear();
+    return *this;
+}
+
+template <typename T, typename Monoid>
+const T& AggregateStack<T, Monoid>::top() const {
+    if (empty()) {
+        cout << "top failed\n";
+        BII_THROW(empty_stack());
+    }
+    return _entries.back().element;
+}
+
+template <typename T, typename Monoid>
+const typename AggregateStack<T, Monoid>::value_type& AggregateStack<T, Monoid>::aggregate() const {
+    if (empty()) {
+        cout << "aggregate failed\n";
+        BII_THROW(empty_stack());
+    }
+    return _entries.back().aggregate;
+}
+
+// AggregateQueue ––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Monoid>
+AggregateQueue<T, Monoid>::AggregateQueue(const Monoid& monoid) :
+    _front(), _back(), _monoid(monoid) { }
+
+template <typename T, typename Monoid>
+void AggregateQueue<T, Monoid>::pour() {
+    while (!_back.empty()) {
+        aggregateEntry entry = _back.removeBack();
+        // everything already in front is behind this element
+        entry.aggregate = _monoid.lift(entry.element);
+        if (!_front.empty()) {
+            entry.aggregate = _monoid.combine(entry.aggregate, _front.back().aggregate);
+        }
+        _front.addBack(move(entry));
+    }
+}
+
+template <typename T, typename Monoid>
+inline size_t AggregateQueue<T, Monoid>::size() const {
+    return _front.size() + _back.size();
+}
+
+template <typename T, typename Monoid>
+inline bool AggregateQueue<T, Monoid>::empty() const {
+    return _front.empty() && _back.empty();
+}
+
+template <typename T, typename Monoid>
+AggregateQueue<T, Monoid>& AggregateQueue<T, Monoid>::push(const T& element) {
+    return push(T(element));
+}
+
+template <typename T, typename Monoid>
+AggregateQueue<T, Monoid>& AggregateQueue<T, Monoid>::push(T&& element) {
+    value_type lifted = _monoid.lift(element);
+    if (!_back.empty()) {
+        lifted = _monoid.combine(_back.back().aggregate, lifted);
+    }
+    _back.addBack(aggregateEntry{move(element), move(lifted)});
+    return *this;
+}
+
+template <typename T, typename Monoid>
+T AggregateQueue<T, Monoid>::pull() {
+    if (empty()) {
+        cout << "pull failed\n";
+        BII_THROW(empty_queue());
+    }
+    if (_front.empty()) {
+        pour();
+    }
+    return move(_front.removeBack().element);
+}
+
+template <typename T, typename Monoid>
+AggregateQueue<T, Monoid>& AggregateQueue<T, Monoid>::clear() {
+    _front.clear();
+    _back.clear();
+    return *this;
+}
+
+template <typename T, typename Monoid>
+const T& AggregateQueue<T, Monoid>::front() {
+    if (empty()) {
+        cout << "front failed\n";
+        BII_THROW(empty_queue());
+    }
+    if (_front.empty()) {
+        pour();
+    }
+    return _front.back().element;
+}
+
+template <typename T, typename Monoid>
+typename AggregateQueue<T, Monoid>::value_type AggregateQueue<T, Monoid>::aggregate() const {
+    if (empty()) {
+        cout << "aggregate failed\n";
+        BII_THROW(empty_queue());
+    }
+    if (_back.empty()) {
+        return _front.back().aggregate;
+    }
+    if (_front.empty()) {
+        return _back.back().aggregate;
+    }
+    return _monoid.combine(_front.back().aggregate, _back.back().aggregate);
+}
@@ -0,0 +1,271 @@
+/**
+ * Created on October 19, 2026. AggregateStack<T, Monoid>
+ * is a stack that keeps a running aggregate (min, max, sum,
+ * or any associative operation) of its elements, and
+ * AggregateQueue<T, Monoid> is a queue built from two of them
+ * for sliding-window aggregates, for use in projects by BII.
+ *
+ * Every element is stored next to the aggregate of itself and
+ * everything below it, so reading the aggregate is O(1) and a
+ * pull simply uncovers the aggregate from before the push.
+ *
+ * The queue pushes onto a back stack and pulls from a front
+ * stack. When the front runs dry the back is poured into it,
+ * recomputing aggregates in the other direction, so each element
+ * is moved once and every operation is amortized O(1).
+ *
+ * A Monoid names the aggregate type as value_type and provides
+ *     value_type lift(const T& element) const;
+ *     value_type combine(const value_type& left, const value_type& right) const;
+ * where combine is associative. It need not be commutative: the
+ * aggregate combines elements from the bottom of the stack up and
+ * from the front of the queue back. minOf, maxOf, sumOf, and
+ * minMaxOf are provided.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added AggregateStack, MinMaxStack, AggregateQueue, and the
+ * minOf, maxOf, sumOf, and minMaxOf monoids.
+ */
+#pragma once
+#include <iostream>
+#include <utility>
+#include "../Vector/vector.h"
+#include "stack.h"
+
+// Monoids –––––––––––––––––––––––––––––––––––––––––––––––
+
+/** The smaller of two elements */
+template <typename T>
+struct minOf {
+    using value_type = T;
+    T lift(const T& element) const { return element; }
+    T combine(const T& left, const T& right) const { return right < left ? right : left; }
+};
+
+/** The larger of two elements */
+template <typename T>
+struct maxOf {
+    using value_type = T;
+    T lift(const T& element) const { return element; }
+    T combine(const T& left, const T& right) const { return left < right ? right : left; }
+};
+
+/** The sum of the elements */
+template <typename T>
+struct sumOf {
+    using value_type = T;
+    T lift(const T& element) const { return element; }
+    T combine(const T& left, const T& right) const { return left + right; }
+};
+
+/** The smallest and largest elements, as a pair */
+template <typename T>
+struct minMaxOf {
+    using value_type = std::pair<T, T>;
+    value_type lift(const T& element) const { return value_type(element, element); }
+    value_type combine(const value_type& left, const value_type& right) const {
+        return value_type(right.first < left.first ? right.first : left.first,
+                          left.second < right.second ? right.second : left.second);
+    }
+};
+
+// AggregateStack ––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Monoid = minOf<T>>
+class AggregateStack {
+public:
+    using value_type = typename Monoid::value_type;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty stack aggregating with the given monoid
+     */
+    explicit AggregateStack(const Monoid& monoid = Monoid());
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the stack
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the top of the stack
+     * O(1) amortized asymptotic complexity
+     */
+    AggregateStack<T, Monoid>& push(const T& element);
+
+    /**
+     * Adds an r-value element to the top of the stack
+     * O(1) amortized asymptotic complexity
+     */
+    AggregateStack<T, Monoid>& push(T&& element);
+
+    /**
+     * Removes and returns the element on the top of the stack
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    T pull();
+
+    /**
+     * Removes every element, keeping the capacity
+     * O(N) asymptotic complexity
+     */
+    AggregateStack<T, Monoid>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element on the top of the stack
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    const T& top() const;
+
+    /**
+     * Returns the aggregate of every element, bottom to top
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    const value_type& aggregate() const;
+
+protected:
+    /** An element and the aggregate of it and everything below */
+    struct aggregateEntry {
+        T element;
+        value_type aggregate;
+    };
+
+    /** The entries, bottom of the stack first */
+    Vector<aggregateEntry> _entries;
+
+    /** The aggregating operation */
+    Monoid _monoid;
+};
+
+/**
+ * A stack that tracks its smallest and largest elements
+ */
+template <typename T>
+class MinMaxStack : public AggregateStack<T, minMaxOf<T>> {
+public:
+
+    /**
+     * Returns the smallest element
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    const T& min() const { return this->aggregate().first; }
+
+    /**
+     * Returns the largest element
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    const T& max() const { return this->aggregate().second; }
+};
+
+// AggregateQueue ––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, typename Monoid = minOf<T>>
+class AggregateQueue {
+public:
+    using value_type = typename Monoid::value_type;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Creates an empty queue aggregating with the given monoid
+     */
+    explicit AggregateQueue(const Monoid& monoid = Monoid());
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the queue
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the back of the queue
+     * O(1) amortized asymptotic complexity
+     */
+    AggregateQueue<T, Monoid>& push(const T& element);
+
+    /**
+     * Adds an r-value element to the back of the queue
+     * O(1) amortized asymptotic complexity
+     */
+    AggregateQueue<T, Monoid>& push(T&& element);
+
+    /**
+     * Removes and returns the element at the front of the queue
+     * Throws an error if the queue is empty
+     * O(1) amortized asymptotic complexity
+     */
+    T pull();
+
+    /**
+     * Removes every element, keeping the capacity
+     * O(N) asymptotic complexity
+     */
+    AggregateQueue<T, Monoid>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element at the front of the queue
+     * Throws an error if the queue is empty
+     * O(1) amortized asymptotic complexity
+     */
+    const T& front();
+
+    /**
+     * Returns the aggregate of every element, front to back
+     * Throws an error if the queue is empty
+     * O(1) asymptotic complexity
+     */
+    value_type aggregate() const;
+
+private:
+    /** An element and the aggregate of part of the queue */
+    struct aggregateEntry {
+        T element;
+        value_type aggregate;
+    };
+
+    /**
+     * Elements to pull, front of the queue last; each aggregate
+     * covers the entry and everything behind it in this stack
+     */
+    Vector<aggregateEntry> _front;
+
+    /**
+     * Elements most recently pushed, back of the queue last; each
+     * aggregate covers the entry and everything before it here
+     */
+    Vector<aggregateEntry> _back;
+
+    /** The aggregating operation */
+    Monoid _monoid;
+
+    /**
+     * Moves every element of the back stack onto the front stack
+     * O(N) asymptotic complexity, O(1) amortized per element
+     */
+    void pour();
+};
+
+#include "aggregate-stack.cpp"
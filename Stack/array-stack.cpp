@@ -0,0 +1,113 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the array-stack.h class
+ */
+#pragma once
+#include "array-stack.h"
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+ArrayStack<T>::ArrayStack() :
+    _elements() { }
+
+template <typename T>
+ArrayStack<T>::ArrayStack(const int givenCapacity) :
+    _elements(givenCapacity) { }
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t ArrayStack<T>::size() const {
+    return _elements.size();
+}
+
+template <typename T>
+inline bool ArrayStack<T>::empty() const {
+    return _elements.empty();
+}
+
+template <typename T>
+inline size_t ArrayStack<T>::capacity() const {
+    return _elements.capacity();
+}
+
+template <typename T>
+void ArrayStack<T>::reserve(const size_t length) {
+    _elements.reserve(length);
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+ArrayStack<T>& ArrayStack<T>::push(const T& element) {
+    _elements.addBack(element);
+    return *this;
+}
+
+template <typename T>
+ArrayStack<T>& ArrayStack<T>::push(T&& element) {
+    _elements.addBack(move(element));
+    return *this;
+}
+
+template <typename T>
+T ArrayStack<T>::pull() {
+    if (empty()) {
+        cout << "pull failed\n";
+        BII_THROW(empty_stack());
+    }
+    return _elements.removeBack();
+}
+
+template <typename T>
+ArrayStack<T>& ArrayStack<T>::clear() {
+    _elements.clear();
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+T& ArrayStack<T>::top() {
+    return const_cast<T&>(static_cast<const ArrayStack<T>*>(this)->top());
+}
+
+template <typename T>
+const T& ArrayStack<T>::top() const {
+    if (empty()) {
+        cout << "top failed\n";
+        BII_THROW(empty_stack());
+    }
+    return _elements.back();
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+ArrayStack<T>& ArrayStack<T>::operator+=(const T& element) {
+    return push(element);
+}
+
+template <typename T>
+ArrayStack<T>& ArrayStack<T>::operator+=(T&& element) {
+    return push(move(element));
+}
+
+template <typename T>
+ArrayStack<T>& ArrayStack<T>::operator+=(const ArrayStack<T>& other) {
+    _elements.merge(other._elements);
+    return *this;
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+bool operator==(const ArrayStack<T>& left, const ArrayStack<T>& right) {
+    return left._elements == right._elements;
+}
+
+template <typename T>
+bool operator!=(const ArrayStack<T>& left, const ArrayStack<T>& right) {
+    return !(left == right);
+}
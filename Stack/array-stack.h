@@ -0,0 +1,146 @@
+/**
+ * Created on October 19, 2026. ArrayStack<T> is a
+ * stack kept in contiguous storage, for use in projects
+ * by BII.
+ *
+ * It offers the Stack<T> interface on top of a Vector<T>,
+ * so pushes grow by amortized doubling instead of allocating
+ * a node per element, and neighbouring elements share cache
+ * lines. Prefer it to Stack<T> unless elements need stable
+ * addresses across pushes and pulls.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added ArrayStack with size, empty, capacity, reserve,
+ * push, pull, top, clear, +=, ==, and !=.
+ */
+#pragma once
+#include <iostream>
+#include "../Vector/vector.h"
+#include "stack.h"
+
+template <typename T>
+class ArrayStack {
+public:
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty stack with room for initialCapacity
+     * elements
+     */
+    ArrayStack();
+
+    /**
+     * Creates an empty stack with room for the given number
+     * of elements before it first grows
+     */
+    explicit ArrayStack(const int givenCapacity);
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the stack
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns the number of elements the stack can hold
+     * before it grows
+     * O(1) asymptotic complexity
+     */
+    inline size_t capacity() const;
+
+    /**
+     * Enlarges the capacity by the given length
+     * Throws an error if the length is 0
+     */
+    void reserve(const size_t length);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the top of the stack
+     * O(1) amortized asymptotic complexity
+     */
+    ArrayStack<T>& push(const T& element);
+
+    /**
+     * Adds an r-value element to the top of the stack
+     * O(1) amortized asymptotic complexity
+     */
+    ArrayStack<T>& push(T&& element);
+
+    /**
+     * Removes and returns the element on the top of the stack
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    T pull();
+
+    /**
+     * Removes every element, keeping the capacity
+     * O(N) asymptotic complexity
+     */
+    ArrayStack<T>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element on the top of the stack
+     * without removing it (non-const)
+     * O(1) asymptotic complexity
+     */
+    T& top();
+
+    /**
+     * Views the element on the top of the stack
+     * without removing it (const)
+     * O(1) asymptotic complexity
+     */
+    const T& top() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds the given element to the top of the stack
+     * O(1) amortized asymptotic complexity
+     */
+    ArrayStack<T>& operator+=(const T& element);
+
+    /**
+     * Adds the given element to the top of the stack
+     * O(1) amortized asymptotic complexity
+     */
+    ArrayStack<T>& operator+=(T&& element);
+
+    /**
+     * Adds the given stack to the top of the stack, keeping
+     * its order (its top becomes the new top)
+     * O(N) asymptotic complexity
+     */
+    ArrayStack<T>& operator+=(const ArrayStack<T>& other);
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two stacks, returns true if they have
+     * the same elements in the same order
+     */
+    template <typename T_>
+    friend bool operator==(const ArrayStack<T_>& left, const ArrayStack<T_>& right);
+
+    /**
+     * Given two stacks, returns true if they
+     * don't have the same elements in the same order
+     */
+    template <typename T_>
+    friend bool operator!=(const ArrayStack<T_>& left, const ArrayStack<T_>& right);
+
+private:
+    /** The elements, bottom of the stack first */
+    Vector<T> _elements;
+};
+
+#include "array-stack.cpp"
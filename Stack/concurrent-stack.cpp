@@ -0,0 +1,231 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the concurrent-stack.h class
+ */
+#pragma once
+#include "concurrent-stack.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename ConcurrentStack<T>::concurrentNode& ConcurrentStack<T>::node(uint32_t index) const {
+    // chunk k starts at index firstChunkNodes * (2^k - 1)
+    uint64_t shifted = uint64_t(index) + firstChunkNodes;
+    int chunk = 63 - __builtin_clzll(shifted) - 6;
+    uint64_t offset = shifted - (uint64_t(firstChunkNodes) << chunk);
+    return _chunks[chunk].load(std::memory_order_acquire)[offset];
+}
+
+template <typename T>
+uint32_t ConcurrentStack<T>::acquireNode() {
+    uint64_t head = _free.load();
+    while (indexOf(head) != none) {
+        uint32_t next = node(indexOf(head)).next.load();
+        if (_free.compare_exchange_weak(head, pack(next, head))) {
+            return indexOf(head);
+        }
+    }
+
+    uint32_t index = _fresh.fetch_add(1);
+    if (index == none) {
+        BII_THROW(std::bad_alloc());
+    }
+    uint64_t shifted = uint64_t(index) + firstChunkNodes;
+    int chunk = 63 - __builtin_clzll(shifted) - 6;
+    if (_chunks[chunk].load() == nullptr) {
+        concurrentNode* fresh = new concurrentNode[size_t(firstChunkNodes) << chunk];
+        concurrentNode* expected = nullptr;
+        if (!_chunks[chunk].compare_exchange_strong(expected, fresh)) {
+            delete [] fresh;
+        }
+    }
+    return index;
+}
+
+template <typename T>
+void ConcurrentStack<T>::link(std::atomic<uint64_t>& list, uint32_t index) {
+    uint64_t head = list.load();
+    do {
+        node(index).next.store(indexOf(head));
+    } while (!list.compare_exchange_weak(head, pack(index, head)));
+}
+
+template <typename T>
+void ConcurrentStack<T>::releaseNode(uint32_t index) {
+    link(_free, index);
+}
+
+template <typename T>
+void ConcurrentStack<T>::publish(uint32_t index) {
+    _size.fetch_add(1);
+    link(_head, index);
+}
+
+template <typename T>
+bool ConcurrentStack<T>::hazardous(uint32_t index) const {
+    // a reader that arrives after this check publishes its hazard after
+    // the node was unlinked, so its check of the head fails
+    if (_readers.load() == 0) {
+        return false;
+    }
+    for (int i = 0; i < hazardSlots; i++) {
+        if (_hazards[i].load() == index + 1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+void ConcurrentStack<T>::reclaim() {
+    uint32_t index = _retired.exchange(none);
+    while (index != none) {
+        uint32_t next = node(index).next.load();
+        if (hazardous(index)) {
+            uint32_t head = _retired.load();
+            do {
+                node(index).next.store(head);
+            } while (!_retired.compare_exchange_weak(head, index));
+        } else {
+            _retiredCount.fetch_sub(1);
+            node(index).element()->~T();
+            releaseNode(index);
+        }
+        index = next;
+    }
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+ConcurrentStack<T>::ConcurrentStack() :
+    _head(none),
+    _free(none),
+    _retired(none),
+    _retiredCount(0),
+    _fresh(0),
+    _size(0),
+    _readers(0) {
+    for (int i = 0; i < maxChunks; i++) {
+        _chunks[i].store(nullptr);
+    }
+    for (int i = 0; i < hazardSlots; i++) {
+        _hazards[i].store(0);
+    }
+}
+
+template <typename T>
+ConcurrentStack<T>::~ConcurrentStack() {
+    for (uint32_t index = indexOf(_head.load()); index != none; index = node(index).next.load()) {
+        node(index).element()->~T();
+    }
+    for (uint32_t index = _retired.load(); index != none; index = node(index).next.load()) {
+        node(index).element()->~T();
+    }
+    for (int i = 0; i < maxChunks; i++) {
+        delete [] _chunks[i].load();
+    }
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+bool ConcurrentStack<T>::empty() const {
+    return indexOf(_head.load()) == none;
+}
+
+template <typename T>
+size_t ConcurrentStack<T>::size() const {
+    return _size.load(std::memory_order_relaxed);
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+void ConcurrentStack<T>::push(const T& element) {
+    emplace(element);
+}
+
+template <typename T>
+void ConcurrentStack<T>::push(T&& element) {
+    emplace(std::move(element));
+}
+
+template <typename T>
+template <typename... Args>
+void ConcurrentStack<T>::emplace(Args&&... args) {
+    uint32_t index = acquireNode();
+    BII_TRY {
+        ::new (node(index).storage) T(std::forward<Args>(args)...);
+    } BII_CATCH_ALL {
+        releaseNode(index);
+        BII_RETHROW;
+    }
+    publish(index);
+}
+
+template <typename T>
+std::optional<T> ConcurrentStack<T>::pull() {
+    uint64_t head = _head.load();
+    do {
+        if (indexOf(head) == none) {
+            return std::nullopt;
+        }
+        // the node may be pulled and reused meanwhile; the tag makes
+        // the exchange fail if so, and chunks are never freed early
+    } while (!_head.compare_exchange_weak(head, pack(node(indexOf(head)).next.load(), head)));
+    _size.fetch_sub(1);
+
+    uint32_t index = indexOf(head);
+    T* element = node(index).element();
+    std::optional<T> result;
+    if constexpr (std::is_copy_constructible<T>::value) {
+        if (hazardous(index)) {
+            // a thread in top may still be copying the element
+            result.emplace(static_cast<const T&>(*element));
+            uint32_t retired = _retired.load();
+            do {
+                node(index).next.store(retired);
+            } while (!_retired.compare_exchange_weak(retired, index));
+            _retiredCount.fetch_add(1);
+        }
+    }
+    if (!result) {
+        result.emplace(std::move(*element));
+        element->~T();
+        releaseNode(index);
+    }
+    if (_retiredCount.load(std::memory_order_relaxed) > 0) {
+        reclaim();
+    }
+    return result;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+std::optional<T> ConcurrentStack<T>::top() const {
+    static_assert(std::is_copy_constructible<T>::value, "top copies the element");
+    _readers.fetch_add(1);
+    int slot = 0;
+    for (uint32_t expected = 0; !_hazards[slot].compare_exchange_weak(expected, none); expected = 0) {
+        slot = (slot + 1) % hazardSlots;
+    }
+
+    std::optional<T> result;
+    uint64_t head = _head.load();
+    while (indexOf(head) != none) {
+        _hazards[slot].store(indexOf(head) + 1);
+        // once the head is seen unchanged after publishing the hazard,
+        // any pull of this node will find the hazard and retire it
+        uint64_t check = _head.load();
+        if (check == head) {
+            result.emplace(*node(indexOf(head)).element());
+            break;
+        }
+        head = check;
+    }
+    _hazards[slot].store(0);
+    _readers.fetch_sub(1);
+    return result;
+}
@@ -0,0 +1,211 @@
+/**
+ * Created on October 19, 2026. ConcurrentStack<T> is a
+ * lock-free stack that many threads may push to and pull
+ * from at once, for use in projects by BII.
+ *
+ * Push and pull are a single compare-and-swap on the head
+ * (a Treiber stack). The head and the free list hold a 32-bit
+ * node index packed with a 32-bit tag that changes on every
+ * update, so a node that is pulled and pushed again between a
+ * thread's read and its compare-and-swap cannot be mistaken for
+ * the old head (the ABA problem).
+ *
+ * Nodes live in chunks that are only freed by the destructor,
+ * so reading a node that another thread just pulled is always
+ * safe. Elements are what need protecting: top publishes the
+ * node it is copying in a hazard slot, and a pull that finds its
+ * node in a hazard slot retires the node instead of destroying
+ * the element, leaving it to a later pull or the destructor.
+ *
+ * Because the stack may change between any two calls, pull and
+ * top return std::optional rather than throwing on an empty stack,
+ * and size is only a snapshot.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added ConcurrentStack with push, emplace, pull, top, empty,
+ * and size.
+ */
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "../Exceptions/exception.h"
+
+template <typename T>
+class ConcurrentStack {
+public:
+
+    /** The number of threads that may call top at the same time */
+    static const int hazardSlots = 64;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty stack holding no nodes
+     */
+    ConcurrentStack();
+
+    /**
+     * Destroys the remaining elements and frees every chunk.
+     * No other thread may be using the stack.
+     * O(N) asymptotic complexity
+     */
+    ~ConcurrentStack();
+
+    ConcurrentStack(const ConcurrentStack<T>&) = delete;
+    ConcurrentStack<T>& operator=(const ConcurrentStack<T>&) = delete;
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns true if the stack was empty when checked
+     * O(1) asymptotic complexity
+     */
+    bool empty() const;
+
+    /**
+     * Returns the number of elements when checked. Pushes and
+     * pulls in progress may or may not be counted.
+     * O(1) asymptotic complexity
+     */
+    size_t size() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the top of the stack
+     * O(1) asymptotic complexity (lock-free)
+     */
+    void push(const T& element);
+
+    /**
+     * Adds an r-value element to the top of the stack
+     * O(1) asymptotic complexity (lock-free)
+     */
+    void push(T&& element);
+
+    /**
+     * Constructs an element in place on the top of the stack
+     * O(1) asymptotic complexity (lock-free)
+     */
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * Removes and returns the element on the top of the stack,
+     * or nothing if the stack is empty
+     * O(1) asymptotic complexity (lock-free)
+     */
+    std::optional<T> pull();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a copy of the element on the top of the stack,
+     * or nothing if the stack is empty
+     * O(1) asymptotic complexity (lock-free while fewer than
+     * hazardSlots threads call it at once)
+     */
+    std::optional<T> top() const;
+
+private:
+    /** A node index that refers to no node */
+    static const uint32_t none = 0xFFFFFFFF;
+
+    /** The number of nodes in the first chunk; each chunk doubles */
+    static const uint32_t firstChunkNodes = 64;
+
+    /** Enough chunks to address every 32-bit index */
+    static const int maxChunks = 27;
+
+    /** Individual nodes on the stack */
+    struct concurrentNode {
+        /** Index of the node below this one */
+        std::atomic<uint32_t> next;
+        /** Storage for the element, constructed on push */
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* element() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    /** Tagged index of the top node */
+    std::atomic<uint64_t> _head;
+
+    /** Tagged index of the top of the free list */
+    std::atomic<uint64_t> _free;
+
+    /** Index of the top of the retired list (untagged, only ever swapped out whole) */
+    std::atomic<uint32_t> _retired;
+
+    /** The number of retired nodes */
+    std::atomic<size_t> _retiredCount;
+
+    /** The next never-used node index */
+    std::atomic<uint32_t> _fresh;
+
+    /** The number of elements */
+    std::atomic<size_t> _size;
+
+    /** Chunks of nodes, chunk k holding firstChunkNodes << k nodes */
+    std::atomic<concurrentNode*> _chunks[maxChunks];
+
+    /** Indices (plus one) of nodes whose elements top is copying */
+    mutable std::atomic<uint32_t> _hazards[hazardSlots];
+
+    /** The number of threads inside top, so pulls can skip the hazard scan */
+    mutable std::atomic<int> _readers;
+
+    /**
+     * Packs an index with a tag one past the given word's tag
+     */
+    static uint64_t pack(uint32_t index, uint64_t previous) {
+        return ((previous >> 32) + 1) << 32 | index;
+    }
+
+    /**
+     * Returns the index held in a tagged word
+     */
+    static uint32_t indexOf(uint64_t word) {
+        return static_cast<uint32_t>(word);
+    }
+
+    /**
+     * Returns the node with the given index
+     */
+    concurrentNode& node(uint32_t index) const;
+
+    /**
+     * Returns a node from the free list, or a fresh one
+     */
+    uint32_t acquireNode();
+
+    /**
+     * Puts a node whose element is destroyed on the free list
+     */
+    void releaseNode(uint32_t index);
+
+    /**
+     * Pushes an index onto a tagged list
+     */
+    void link(std::atomic<uint64_t>& list, uint32_t index);
+
+    /**
+     * Links a node whose element is constructed onto the stack
+     */
+    void publish(uint32_t index);
+
+    /**
+     * Returns true if a hazard slot holds the given index
+     */
+    bool hazardous(uint32_t index) const;
+
+    /**
+     * Destroys the elements of retired nodes no longer in a
+     * hazard slot and frees the nodes
+     */
+    void reclaim();
+};
+
+#include "concurrent-stack.cpp"
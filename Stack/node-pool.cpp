@@ -0,0 +1,186 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the node-pool.h class
+ */
+#pragma once
+#include "node-pool.h"
+#include <utility>
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename Node>
+void NodePool<Node>::addSlab() {
+    size_t count = _slabs == nullptr ? firstSlabNodes : _slabs->count * 2;
+    if (count > maxSlabNodes) {
+        count = maxSlabNodes;
+    }
+    size_t bytes = nodesOffset() + count * sizeof(Node);
+    slab* fresh = static_cast<slab*>(::operator new(bytes));
+    fresh->next = _slabs;
+    fresh->count = count;
+    if (_slabs == nullptr) {
+        _oldest = fresh;
+    }
+    _slabs = fresh;
+    _cursor = reinterpret_cast<unsigned char*>(fresh) + nodesOffset();
+    _remaining = count;
+    _slabCount++;
+    _bytes += bytes;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename Node>
+NodePool<Node>::NodePool() :
+    _slabs(nullptr),
+    _oldest(nullptr),
+    _free(nullptr),
+    _freeTail(nullptr),
+    _cursor(nullptr),
+    _remaining(0),
+    _slabCount(0),
+    _bytes(0) { }
+
+template <typename Node>
+NodePool<Node>::NodePool(NodePool<Node>&& other) :
+    _slabs(other._slabs),
+    _oldest(other._oldest),
+    _free(other._free),
+    _freeTail(other._freeTail),
+    _cursor(other._cursor),
+    _remaining(other._remaining),
+    _slabCount(other._slabCount),
+    _bytes(other._bytes) {
+    other._slabs = nullptr;
+    other._oldest = nullptr;
+    other._free = nullptr;
+    other._freeTail = nullptr;
+    other._cursor = nullptr;
+    other._remaining = 0;
+    other._slabCount = 0;
+    other._bytes = 0;
+}
+
+template <typename Node>
+NodePool<Node>::~NodePool() {
+    while (_slabs != nullptr) {
+        slab* next = _slabs->next;
+        ::operator delete(_slabs);
+        _slabs = next;
+    }
+}
+
+template <typename Node>
+NodePool<Node>& NodePool<Node>::operator=(NodePool<Node>&& other) {
+    if (&other == this) return *this;
+    while (_slabs != nullptr) {
+        slab* next = _slabs->next;
+        ::operator delete(_slabs);
+        _slabs = next;
+    }
+    _slabs = other._slabs;
+    _oldest = other._oldest;
+    _free = other._free;
+    _freeTail = other._freeTail;
+    _cursor = other._cursor;
+    _remaining = other._remaining;
+    _slabCount = other._slabCount;
+    _bytes = other._bytes;
+    other._slabs = nullptr;
+    other._oldest = nullptr;
+    other._free = nullptr;
+    other._freeTail = nullptr;
+    other._cursor = nullptr;
+    other._remaining = 0;
+    other._slabCount = 0;
+    other._bytes = 0;
+    return *this;
+}
+
+// Allocation ––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Node>
+inline void* NodePool<Node>::allocate() {
+    if (_free != nullptr) {
+        freeNode* node = _free;
+        _free = node->next;
+        if (_free == nullptr) {
+            _freeTail = nullptr;
+        }
+        return node;
+    }
+    if (_remaining == 0) {
+        addSlab();
+    }
+    void* node = _cursor;
+    _cursor += sizeof(Node);
+    _remaining--;
+    return node;
+}
+
+template <typename Node>
+inline void NodePool<Node>::deallocate(void* node) {
+    freeNode* freed = ::new (node) freeNode;
+    freed->next = _free;
+    if (_free == nullptr) {
+        _freeTail = freed;
+    }
+    _free = freed;
+}
+
+template <typename Node>
+void NodePool<Node>::adopt(NodePool<Node>&& other) {
+    if (&other == this || other._slabs == nullptr) return;
+
+    // the newest slab must stay at the front to be carved, so the
+    // slabs of the pool with less room left go to the back
+    if (other._remaining > _remaining) {
+        std::swap(_slabs, other._slabs);
+        std::swap(_oldest, other._oldest);
+        std::swap(_cursor, other._cursor);
+        std::swap(_remaining, other._remaining);
+    }
+    if (_slabs == nullptr) {
+        _slabs = other._slabs;
+    } else {
+        _oldest->next = other._slabs;
+    }
+    if (other._oldest != nullptr) {
+        _oldest = other._oldest;
+    }
+
+    if (_free == nullptr) {
+        _free = other._free;
+    } else {
+        _freeTail->next = other._free;
+    }
+    if (other._freeTail != nullptr) {
+        _freeTail = other._freeTail;
+    }
+
+    _slabCount += other._slabCount;
+    _bytes += other._bytes;
+    other._slabs = nullptr;
+    other._oldest = nullptr;
+    other._free = nullptr;
+    other._freeTail = nullptr;
+    other._cursor = nullptr;
+    other._remaining = 0;
+    other._slabCount = 0;
+    other._bytes = 0;
+}
+
+template <typename Node>
+inline bool NodePool<Node>::hasFree() const {
+    return _free != nullptr;
+}
+
+template <typename Node>
+inline size_t NodePool<Node>::slabCount() const {
+    return _slabCount;
+}
+
+template <typename Node>
+inline size_t NodePool<Node>::bytesReserved() const {
+    return _bytes;
+}
@@ -0,0 +1,154 @@
+/**
+ * Created on October 19, 2026. NodePool<Node> is a
+ * slab allocator for fixed-size nodes, for use by the
+ * linked containers of BII.
+ *
+ * Nodes are carved out of slabs that double in size (up
+ * to maxSlabNodes) and returned to an intrusive free list,
+ * so a container that pushes and pops repeatedly reuses the
+ * same memory instead of calling new and delete per element.
+ * Slabs are only released when the pool is destroyed,
+ * or handed whole to another pool by adopt.
+ *
+ * A pool hands out uninitialized memory: callers construct
+ * nodes in it with placement new and destroy them before
+ * giving them back. A pool is not thread-safe; each container
+ * owns its own.
+ */
+#pragma once
+#include <cstddef>
+#include <new>
+
+template <typename Node>
+class NodePool {
+public:
+
+    /** The number of nodes in the first slab */
+    static const size_t firstSlabNodes = 16;
+
+    /** The largest number of nodes in a single slab */
+    static const size_t maxSlabNodes = 4096;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates a pool holding no slabs
+     */
+    NodePool();
+
+    /**
+     * Move Constructor
+     * Takes over the slabs and free list of the given pool
+     */
+    NodePool(NodePool<Node>&& other);
+
+    /**
+     * Frees every slab. Every node handed out must already
+     * have been destroyed.
+     */
+    ~NodePool();
+
+    /**
+     * Move Assignment
+     * Frees this pool's slabs and takes over those of the given
+     * pool. Every node handed out by this pool must already have
+     * been destroyed.
+     */
+    NodePool<Node>& operator=(NodePool<Node>&& other);
+
+    NodePool(const NodePool<Node>&) = delete;
+    NodePool<Node>& operator=(const NodePool<Node>&) = delete;
+
+    // Allocation ––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns uninitialized memory for one node, reusing a
+     * freed node when there is one
+     * O(1) asymptotic complexity (amortized over slab growth)
+     */
+    inline void* allocate();
+
+    /**
+     * Puts the memory of a destroyed node back on the free list
+     * O(1) asymptotic complexity
+     */
+    inline void deallocate(void* node);
+
+    /**
+     * Takes over every slab and free node of the given pool, so
+     * nodes carved from it may be given back to this one. Of the
+     * two partly used newest slabs, only the roomier one's unused
+     * tail stays available; the other's is kept but never carved.
+     * O(1) asymptotic complexity
+     */
+    void adopt(NodePool<Node>&& other);
+
+    /**
+     * Returns true if the next allocate will reuse a node
+     * rather than carve a new one
+     */
+    inline bool hasFree() const;
+
+    /**
+     * Returns the number of slabs the pool has allocated
+     */
+    inline size_t slabCount() const;
+
+    /**
+     * Returns the total bytes held in slabs
+     */
+    inline size_t bytesReserved() const;
+
+private:
+    /** Header at the start of every slab */
+    struct slab {
+        /** The previously allocated slab */
+        slab* next;
+        /** The number of nodes in this slab */
+        size_t count;
+    };
+
+    /** A freed node, reused as a link in the free list */
+    struct freeNode {
+        freeNode* next;
+    };
+
+    static_assert(sizeof(Node) >= sizeof(freeNode), "nodes must be able to hold a free-list link");
+
+    /** The most recently allocated slab */
+    slab* _slabs;
+
+    /** The first slab allocated, the end of the slab list */
+    slab* _oldest;
+
+    /** The top of the free list */
+    freeNode* _free;
+
+    /** The bottom of the free list */
+    freeNode* _freeTail;
+
+    /** The next never-used node in the newest slab */
+    unsigned char* _cursor;
+
+    /** The number of never-used nodes left in the newest slab */
+    size_t _remaining;
+
+    /** The number of slabs allocated */
+    size_t _slabCount;
+
+    /** The total bytes held in slabs */
+    size_t _bytes;
+
+    /**
+     * Allocates a new slab twice the size of the last one
+     */
+    void addSlab();
+
+    /**
+     * Returns the offset of the first node in a slab
+     */
+    static constexpr size_t nodesOffset() {
+        return (sizeof(slab) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+    }
+};
+
+#include "node-pool.cpp"
@@ -0,0 +1,170 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the persistent-stack.h class
+ */
+#pragma once
+#include "persistent-stack.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename PersistentStack<T>::persistentNode* PersistentStack<T>::retain(persistentNode* node) {
+    if (node != nullptr) {
+        node->references.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+template <typename T>
+void PersistentStack<T>::release(persistentNode* node) {
+    // a loop rather than recursion through the nodes' destructors
+    while (node != nullptr && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        persistentNode* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+PersistentStack<T>::PersistentStack() :
+    _head(nullptr), _size(0) { }
+
+template <typename T>
+PersistentStack<T>::PersistentStack(persistentNode* head, size_t size) :
+    _head(head), _size(size) { }
+
+template <typename T>
+PersistentStack<T>::PersistentStack(const PersistentStack<T>& other) :
+    _head(retain(other._head)), _size(other._size) { }
+
+template <typename T>
+PersistentStack<T>::PersistentStack(PersistentStack<T>&& other) :
+    _head(other._head), _size(other._size) {
+    other._head = nullptr;
+    other._size = 0;
+}
+
+template <typename T>
+PersistentStack<T>::~PersistentStack() {
+    release(_head);
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t PersistentStack<T>::size() const {
+    return _size;
+}
+
+template <typename T>
+inline bool PersistentStack<T>::empty() const {
+    return _size == 0;
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+PersistentStack<T> PersistentStack<T>::push(const T& element) const {
+    return emplace(element);
+}
+
+template <typename T>
+PersistentStack<T> PersistentStack<T>::push(T&& element) const {
+    return emplace(move(element));
+}
+
+template <typename T>
+template <typename... Args>
+PersistentStack<T> PersistentStack<T>::emplace(Args&&... args) const {
+    retain(_head);
+    persistentNode* node = nullptr;
+    BII_TRY {
+        node = new persistentNode(_head, std::forward<Args>(args)...);
+    } BII_CATCH_ALL {
+        release(_head);
+        BII_RETHROW;
+    }
+    return PersistentStack<T>(node, _size + 1);
+}
+
+template <typename T>
+PersistentStack<T> PersistentStack<T>::pop() const {
+    if (empty()) {
+        cout << "pop failed\n";
+        BII_THROW(empty_stack());
+    }
+    return PersistentStack<T>(retain(_head->next), _size - 1);
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+const T& PersistentStack<T>::top() const {
+    if (empty()) {
+        cout << "top failed\n";
+        BII_THROW(empty_stack());
+    }
+    return _head->element;
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+PersistentStack<T>& PersistentStack<T>::operator=(const PersistentStack<T>& assign) {
+    // retain first, in case assign shares this version's nodes
+    persistentNode* head = retain(assign._head);
+    release(_head);
+    _head = head;
+    _size = assign._size;
+    return *this;
+}
+
+template <typename T>
+PersistentStack<T>& PersistentStack<T>::operator=(PersistentStack<T>&& assign) {
+    if (&assign == this) return *this;
+    release(_head);
+    _head = assign._head;
+    _size = assign._size;
+    assign._head = nullptr;
+    assign._size = 0;
+    return *this;
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename PersistentStack<T>::const_iterator PersistentStack<T>::begin() const {
+    return const_iterator(_head);
+}
+
+template <typename T>
+typename PersistentStack<T>::const_iterator PersistentStack<T>::end() const {
+    return const_iterator(nullptr);
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+bool operator==(const PersistentStack<T>& left, const PersistentStack<T>& right) {
+    if (left._size != right._size) {
+        return false;
+    }
+    auto leftNode = left._head;
+    auto rightNode = right._head;
+    // equal sizes mean a shared node is at the same depth in both
+    while (leftNode != rightNode) {
+        if (leftNode->element != rightNode->element) {
+            return false;
+        }
+        leftNode = leftNode->next;
+        rightNode = rightNode->next;
+    }
+    return true;
+}
+
+template <typename T>
+bool operator!=(const PersistentStack<T>& left, const PersistentStack<T>& right) {
+    return !(left == right);
+}
@@ -0,0 +1,220 @@
+/**
+ * Created on October 19, 2026. PersistentStack<T> is an
+ * immutable stack whose versions share structure, for use
+ * in projects by BII.
+ *
+ * Nodes are never changed after they are built. Pushing onto
+ * a version makes one new node that points at the old top, and
+ * popping returns the version below, so every version shares
+ * its tail with the ones it came from. Copying a version only
+ * bumps a reference count, which makes snapshots (for undo or
+ * backtracking) O(1).
+ *
+ * Reference counts are atomic, so versions that share nodes may
+ * be copied, read, and destroyed on different threads; a single
+ * PersistentStack object must not be assigned to while another
+ * thread reads it. Releasing a long chain is iterative, so
+ * dropping the last reference to a deep stack cannot overflow
+ * the call stack.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added PersistentStack with size, empty, push, emplace, pop,
+ * top, iterators, ==, and !=.
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "stack.h"
+
+template <typename T>
+class PersistentStack {
+    /** An immutable node shared by every version that contains it */
+    struct persistentNode {
+        /** The number of versions and nodes pointing at this node */
+        mutable std::atomic<size_t> references;
+        /** The element */
+        const T element;
+        /** The node below this one */
+        persistentNode* const next;
+
+        template <typename... Args>
+        persistentNode(persistentNode* next, Args&&... args) :
+            references(1), element(std::forward<Args>(args)...), next(next) { }
+    };
+
+public:
+
+    /** Forward iterator from the top of a version to its bottom */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : _node(nullptr) { }
+        explicit const_iterator(const persistentNode* node) : _node(node) { }
+
+        reference operator*() const { return _node->element; }
+        pointer operator->() const { return &_node->element; }
+        const_iterator& operator++() { _node = _node->next; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+
+        friend bool operator==(const const_iterator& left, const const_iterator& right) {
+            return left._node == right._node;
+        }
+
+        friend bool operator!=(const const_iterator& left, const const_iterator& right) {
+            return left._node != right._node;
+        }
+
+    private:
+        const persistentNode* _node;
+    };
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty stack
+     */
+    PersistentStack();
+
+    /**
+     * Copy Constructor
+     * Shares every node of the given version
+     * O(1) asymptotic complexity
+     */
+    PersistentStack(const PersistentStack<T>& other);
+
+    /**
+     * Move Constructor
+     * O(1) asymptotic complexity
+     */
+    PersistentStack(PersistentStack<T>&& other);
+
+    /**
+     * Destructor
+     * Frees the nodes no other version shares
+     * O(K) asymptotic complexity (K is the number freed)
+     */
+    ~PersistentStack();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in this version
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if this version is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a new version with the given element on top,
+     * leaving this one unchanged
+     * O(1) asymptotic complexity
+     */
+    PersistentStack<T> push(const T& element) const;
+
+    /**
+     * Returns a new version with the given r-value element on
+     * top, leaving this one unchanged
+     * O(1) asymptotic complexity
+     */
+    PersistentStack<T> push(T&& element) const;
+
+    /**
+     * Returns a new version with an element constructed from the
+     * given arguments on top, leaving this one unchanged
+     * O(1) asymptotic complexity
+     */
+    template <typename... Args>
+    PersistentStack<T> emplace(Args&&... args) const;
+
+    /**
+     * Returns the version below the top, leaving this one unchanged
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    PersistentStack<T> pop() const;
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element on the top of this version
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    const T& top() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Copy Assignment
+     * O(1) asymptotic complexity, plus the nodes freed
+     */
+    PersistentStack<T>& operator=(const PersistentStack<T>& assign);
+
+    /**
+     * Move Assignment
+     * O(1) asymptotic complexity, plus the nodes freed
+     */
+    PersistentStack<T>& operator=(PersistentStack<T>&& assign);
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns an iterator to the top element
+     */
+    const_iterator begin() const;
+
+    /**
+     * Returns an iterator past the bottom element
+     */
+    const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two versions, returns true if they have the same
+     * elements in the same order. Stops early at a shared tail.
+     */
+    template <typename T_>
+    friend bool operator==(const PersistentStack<T_>& left, const PersistentStack<T_>& right);
+
+    /**
+     * Given two versions, returns true if they
+     * don't have the same elements in the same order
+     */
+    template <typename T_>
+    friend bool operator!=(const PersistentStack<T_>& left, const PersistentStack<T_>& right);
+
+private:
+    /** The top node of this version */
+    persistentNode* _head;
+
+    /** The number of elements in this version */
+    size_t _size;
+
+    /**
+     * Makes a version from a node it already holds a reference to
+     */
+    PersistentStack(persistentNode* head, size_t size);
+
+    /**
+     * Adds a reference to the given node, if any
+     */
+    static persistentNode* retain(persistentNode* node);
+
+    /**
+     * Drops a reference to the given node, freeing it and every
+     * node below it that no one else references
+     */
+    static void release(persistentNode* node);
+};
+
+#include "persistent-stack.cpp"
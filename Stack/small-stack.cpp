@@ -0,0 +1,220 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the small-stack.h class
+ */
+#pragma once
+#include "small-stack.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+void SmallStack<T, N>::locate(size_t index, int& chunk, size_t& offset) {
+    // chunk k starts firstChunk * (2^k - 1) elements past N
+    size_t scaled = (index - N) / firstChunk + 1;
+    chunk = 63 - __builtin_clzll(scaled);
+    offset = index - N - firstChunk * ((size_t(1) << chunk) - 1);
+}
+
+template <typename T, size_t N>
+T* SmallStack<T, N>::slot(size_t index, bool allocate) {
+    if (index < N) {
+        return std::launder(reinterpret_cast<T*>(_inline)) + index;
+    }
+    int chunk = 0;
+    size_t offset = 0;
+    locate(index, chunk, offset);
+    if (chunk == _chunkCount && allocate) {
+        _chunks[chunk] = Storage<T>::allocate(firstChunk << chunk);
+        _chunkCount++;
+    }
+    return _chunks[chunk] + offset;
+}
+
+template <typename T, size_t N>
+const T* SmallStack<T, N>::slot(size_t index) const {
+    return const_cast<SmallStack<T, N>*>(this)->slot(index);
+}
+
+template <typename T, size_t N>
+void SmallStack<T, N>::release() {
+    for (size_t i = _size; i > 0; i--) {
+        slot(i - 1)->~T();
+    }
+    for (int k = 0; k < _chunkCount; k++) {
+        Storage<T>::deallocate(_chunks[k], firstChunk << k);
+    }
+    _chunkCount = 0;
+    _size = 0;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+SmallStack<T, N>::SmallStack() :
+    _chunkCount(0),
+    _size(0) { }
+
+template <typename T, size_t N>
+SmallStack<T, N>::SmallStack(const SmallStack<T, N>& other) :
+    _chunkCount(0),
+    _size(0) {
+    for (size_t i = 0; i < other._size; i++) {
+        push(*other.slot(i));
+    }
+}
+
+template <typename T, size_t N>
+SmallStack<T, N>::SmallStack(SmallStack<T, N>&& other) :
+    _chunkCount(0),
+    _size(0) {
+    size_t inlined = other._size < N ? other._size : N;
+    for (size_t i = 0; i < inlined; i++) {
+        Storage<T>::construct(slot(i), move(*other.slot(i)));
+        other.slot(i)->~T();
+    }
+    for (int k = 0; k < other._chunkCount; k++) {
+        _chunks[k] = other._chunks[k];
+    }
+    _chunkCount = other._chunkCount;
+    _size = other._size;
+    other._chunkCount = 0;
+    other._size = 0;
+}
+
+template <typename T, size_t N>
+SmallStack<T, N>::~SmallStack() {
+    release();
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+inline size_t SmallStack<T, N>::size() const {
+    return _size;
+}
+
+template <typename T, size_t N>
+inline bool SmallStack<T, N>::empty() const {
+    return _size == 0;
+}
+
+template <typename T, size_t N>
+inline bool SmallStack<T, N>::isInline() const {
+    return _size <= N;
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+SmallStack<T, N>& SmallStack<T, N>::push(const T& element) {
+    return emplace(element);
+}
+
+template <typename T, size_t N>
+SmallStack<T, N>& SmallStack<T, N>::push(T&& element) {
+    return emplace(move(element));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+SmallStack<T, N>& SmallStack<T, N>::emplace(Args&&... args) {
+    Storage<T>::construct(slot(_size, true), std::forward<Args>(args)...);
+    _size++;
+    return *this;
+}
+
+template <typename T, size_t N>
+T SmallStack<T, N>::pull() {
+    if (empty()) {
+        cout << "pull failed\n";
+        BII_THROW(empty_stack());
+    }
+    _size--;
+    T* top = slot(_size);
+    T element = move(*top);
+    top->~T();
+    if (_size >= N) {
+        // the chunk is now empty: keep it, but free the one above
+        int chunk = 0;
+        size_t offset = 0;
+        locate(_size, chunk, offset);
+        if (offset == 0 && chunk + 1 < _chunkCount) {
+            Storage<T>::deallocate(_chunks[chunk + 1], firstChunk << (chunk + 1));
+            _chunkCount = chunk + 1;
+        }
+    }
+    return element;
+}
+
+template <typename T, size_t N>
+SmallStack<T, N>& SmallStack<T, N>::clear() {
+    release();
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+T& SmallStack<T, N>::top() {
+    return const_cast<T&>(static_cast<const SmallStack<T, N>*>(this)->top());
+}
+
+template <typename T, size_t N>
+const T& SmallStack<T, N>::top() const {
+    if (empty()) {
+        cout << "top failed\n";
+        BII_THROW(empty_stack());
+    }
+    return *slot(_size - 1);
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+SmallStack<T, N>& SmallStack<T, N>::operator=(const SmallStack<T, N>& assign) {
+    if (&assign == this) return *this;
+    release();
+    for (size_t i = 0; i < assign._size; i++) {
+        push(*assign.slot(i));
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+SmallStack<T, N>& SmallStack<T, N>::operator=(SmallStack<T, N>&& assign) {
+    if (&assign == this) return *this;
+    release();
+    size_t inlined = assign._size < N ? assign._size : N;
+    for (size_t i = 0; i < inlined; i++) {
+        Storage<T>::construct(slot(i), move(*assign.slot(i)));
+        assign.slot(i)->~T();
+    }
+    for (int k = 0; k < assign._chunkCount; k++) {
+        _chunks[k] = assign._chunks[k];
+    }
+    _chunkCount = assign._chunkCount;
+    _size = assign._size;
+    assign._chunkCount = 0;
+    assign._size = 0;
+    return *this;
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+bool operator==(const SmallStack<T, N>& left, const SmallStack<T, N>& right) {
+    if (left._size != right._size) {
+        return false;
+    }
+    for (size_t i = 0; i < left._size; i++) {
+        if (*left.slot(i) != *right.slot(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, size_t N>
+bool operator!=(const SmallStack<T, N>& left, const SmallStack<T, N>& right) {
+    return !(left == right);
+}
@@ -0,0 +1,190 @@
+/**
+ * Created on October 19, 2026. SmallStack<T, N> is a
+ * stack that keeps its first N elements inside the object,
+ * for use in projects by BII.
+ *
+ * Shallow stacks (expression evaluation, searches on small
+ * graphs) never touch the heap. Past N, elements spill into
+ * heap chunks that double in size and never move, so pushes
+ * stay O(1) without the copying of a growing array. When a
+ * chunk empties it is kept until the one before it empties
+ * too, so a stack that hovers around a chunk boundary does not
+ * allocate on every push.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added SmallStack with size, empty, push, emplace, pull, top,
+ * clear, ==, and !=.
+ */
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <utility>
+#include "../Vector/storage.h"
+#include "stack.h"
+
+template <typename T, size_t N>
+class SmallStack {
+public:
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty stack without allocating
+     */
+    SmallStack();
+
+    /**
+     * Copy Constructor
+     * O(N) asymptotic complexity
+     */
+    SmallStack(const SmallStack<T, N>& other);
+
+    /**
+     * Move Constructor
+     * Moves the inline elements one by one and takes the chunks
+     * O(N) asymptotic complexity (N is the inline capacity)
+     */
+    SmallStack(SmallStack<T, N>&& other);
+
+    /**
+     * Destructor
+     * O(N) asymptotic complexity
+     */
+    ~SmallStack();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in the stack
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns true if every element is held inline
+     * O(1) asymptotic complexity
+     */
+    inline bool isInline() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the top of the stack
+     * O(1) asymptotic complexity
+     */
+    SmallStack<T, N>& push(const T& element);
+
+    /**
+     * Adds an r-value element to the top of the stack
+     * O(1) asymptotic complexity
+     */
+    SmallStack<T, N>& push(T&& element);
+
+    /**
+     * Constructs an element in place on the top of the stack
+     * O(1) asymptotic complexity
+     */
+    template <typename... Args>
+    SmallStack<T, N>& emplace(Args&&... args);
+
+    /**
+     * Removes and returns the element on the top of the stack
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    T pull();
+
+    /**
+     * Removes every element and frees the chunks
+     * O(N) asymptotic complexity
+     */
+    SmallStack<T, N>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element on the top of the stack
+     * without removing it (non-const)
+     * O(1) asymptotic complexity
+     */
+    T& top();
+
+    /**
+     * Views the element on the top of the stack
+     * without removing it (const)
+     * O(1) asymptotic complexity
+     */
+    const T& top() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Copy Assignment
+     */
+    SmallStack<T, N>& operator=(const SmallStack<T, N>& assign);
+
+    /**
+     * Move Assignment
+     */
+    SmallStack<T, N>& operator=(SmallStack<T, N>&& assign);
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two stacks, returns true if they have
+     * the same elements in the same order
+     */
+    template <typename T_, size_t N_>
+    friend bool operator==(const SmallStack<T_, N_>& left, const SmallStack<T_, N_>& right);
+
+    /**
+     * Given two stacks, returns true if they
+     * don't have the same elements in the same order
+     */
+    template <typename T_, size_t N_>
+    friend bool operator!=(const SmallStack<T_, N_>& left, const SmallStack<T_, N_>& right);
+
+private:
+    /** The number of elements in the first chunk; each chunk doubles */
+    static const size_t firstChunk = N ? N : 1;
+
+    /** Enough chunks for any stack that fits in memory */
+    static const int maxChunks = 48;
+
+    /** The first N elements */
+    alignas(T) unsigned char _inline[N ? sizeof(T) * N : 1];
+
+    /** Chunks holding the elements past N, chunk k holding firstChunk << k */
+    T* _chunks[maxChunks];
+
+    /** The number of chunks allocated, always the first ones */
+    int _chunkCount;
+
+    /** The number of elements */
+    size_t _size;
+
+    /**
+     * Returns the slot of the element at the given depth from the
+     * bottom, allocating its chunk if asked to
+     */
+    T* slot(size_t index, bool allocate = false);
+
+    /**
+     * Returns the slot of the element at the given depth from the
+     * bottom (const)
+     */
+    const T* slot(size_t index) const;
+
+    /**
+     * Returns the chunk and offset of an element past N
+     */
+    static void locate(size_t index, int& chunk, size_t& offset);
+
+    /**
+     * Destroys every element and frees every chunk
+     */
+    void release();
+};
+
+#include "small-stack.cpp"
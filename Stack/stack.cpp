@@ -7,31 +7,73 @@
 
 #include "stack.h"
 #include <exception>
+#include <type_traits>
 
-// Constructors/Destructor –––––––––––––––––––––––––––––––
+// Private Functions –––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-Stack<T>::Stack() :
-    _head(nullptr), _size(0) { }
+void Stack<T>::releaseNode(stackNode* node) {
+    node->~stackNode();
+    _pool.deallocate(node);
+}
 
 template <typename T>
-Stack<T>::Stack(Stack<T>& other) :
-    _head(nullptr), _size(other._size) { 
-    stackNode* temp = _head;
-    for (int i = 0; i < other._size; i++) {
-        // something about either temp
-        // needing to be pushed down the 
-        // list or maybe head is and then
-        // we bring it back up to temp
-        // at the end
+template <typename... Args>
+void Stack<T>::linkNode(Args&&... args) {
+    BII_STATS_ONLY(bool reused = _pool.hasFree();)
+    void* memory = _pool.allocate();
+    stackNode* temp = nullptr;
+    BII_TRY {
+        temp = new (memory) stackNode(nullptr, _head, std::forward<Args>(args)...);
+    } BII_CATCH_ALL {
+        _pool.deallocate(memory);
+        BII_RETHROW;
+    }
+    if (_head != nullptr) {
+        _head->previous = temp;
+    } else {
+        _tail = temp;
+    }
+    _head = temp;
+    _size++;
+    BII_STATS_ONLY(if (!reused) _stats.node(sizeof(stackNode), _size);)
+}
 
+template <typename T>
+T Stack<T>::unlinkTop() {
+    stackNode* temp = _head;
+    _head = _head->next;
+    if (_head != nullptr) {
+        _head->previous = nullptr;
+    } else {
+        _tail = nullptr;
     }
+    _size--;
+    T element = move(temp->element);
+    releaseNode(temp);
+    return element;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+Stack<T>::Stack() :
+    _head(nullptr), _tail(nullptr), _pulled(nullptr), _size(0) { }
+
+template <typename T>
+Stack<T>::Stack(const Stack<T>& other) :
+    _head(nullptr), _tail(nullptr), _pulled(nullptr), _size(0) { 
+    *this += other;
 }
 
 template <typename T>
 Stack<T>::Stack(Stack<T>&& other) :
-    _head(move(other._head)), _size(move(other._size)) { 
+    _head(move(other._head)), _tail(move(other._tail)), _pulled(move(other._pulled)), _size(move(other._size)),
+    _pool(move(other._pool)) { 
     other._head = nullptr;
+    other._tail = nullptr;
+    other._pulled = nullptr;
+    other._size = 0;
 }
 
 
@@ -55,11 +97,16 @@ Stack<T>::Stack(Stack<T>&& other) :
 
 template <typename T>
 Stack<T>::~Stack() {
+    // the pool frees the slabs, so only the elements need destroying
+    if (std::is_trivially_destructible<T>::value) return;
     stackNode* temp = nullptr;
     while (_head != nullptr) {
         temp = _head;
         _head = _head->next;
-        delete temp;
+        temp->~stackNode();
+    }
+    if (_pulled != nullptr) {
+        _pulled->~stackNode();
     }
 }
 
@@ -79,14 +126,22 @@ inline bool Stack<T>::empty() const {
 
 template <typename T>
 Stack<T>& Stack<T>::push(const T& element) {
-    if (_head == nullptr) {
-        _head = new stackNode(element, nullptr, nullptr);
-    } else {
-        stackNode* temp = new stackNode(element, _head, nullptr);
-        _head->previous = temp;
-        _head = temp;
-    }
-    _size++;
+    linkNode(element);
+    BII_STATS_ONLY(_stats.copied(1);)
+    return *this;
+}
+
+template <typename T>
+Stack<T>& Stack<T>::push(T&& element) {
+    linkNode(move(element));
+    BII_STATS_ONLY(_stats.moved(1);)
+    return *this;
+}
+
+template <typename T>
+template <typename... Args>
+Stack<T>& Stack<T>::emplace(Args&&... args) {
+    linkNode(std::forward<Args>(args)...);
     return *this;
 }
 
@@ -94,15 +149,97 @@ template <typename T>
 T& Stack<T>::pull() {
     if (empty()) {
         cout << "pull failed\n";
-        throw empty_stack();
+        BII_THROW(empty_stack());
     }
-    stackNode* temp = _head;
+    // the previously pulled node is no longer referenced
+    if (_pulled != nullptr) {
+        releaseNode(_pulled);
+    }
+    _pulled = _head;
     _head = _head->next;
-	
-	// _head -><- node -><- node -><- node -> nullptr
-	// 
-    temp->next = nullptr;
-    return temp->element;
+    if (_head != nullptr) {
+        _head->previous = nullptr;
+    } else {
+        _tail = nullptr;
+    }
+    _pulled->next = nullptr;
+    _size--;
+    return _pulled->element;
+}
+
+template <typename T>
+T Stack<T>::pop() {
+    if (empty()) {
+        cout << "pop failed\n";
+        BII_THROW(empty_stack());
+    }
+    return unlinkTop();
+}
+
+template <typename T>
+std::optional<T> Stack<T>::tryPop() {
+    if (empty()) {
+        return std::nullopt;
+    }
+    return unlinkTop();
+}
+
+template <typename T>
+Stack<T>& Stack<T>::splice(Stack<T>&& other) {
+    if (&other == this) return *this;
+    // other's pulled node is about to belong to this stack's pool
+    if (other._pulled != nullptr) {
+        other.releaseNode(other._pulled);
+        other._pulled = nullptr;
+    }
+    if (other._head != nullptr) {
+        other._tail->next = _head;
+        if (_head != nullptr) {
+            _head->previous = other._tail;
+        } else {
+            _tail = other._tail;
+        }
+        _head = other._head;
+        _size += other._size;
+    }
+    _pool.adopt(move(other._pool));
+    other._head = nullptr;
+    other._tail = nullptr;
+    other._size = 0;
+    return *this;
+}
+
+template <typename T>
+template <typename InputIt>
+Stack<T>& Stack<T>::pushRange(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+        linkNode(*first);
+    }
+    return *this;
+}
+
+template <typename T>
+template <typename OutputIt>
+OutputIt Stack<T>::popN(size_t count, OutputIt out) {
+    if (count > size()) {
+        cout << "popN failed\n";
+        BII_THROW(empty_stack());
+    }
+    for (; count > 0; count--) {
+        // write before unlinking, so a throwing write leaves the element on the stack
+        *out = move(_head->element);
+        ++out;
+        stackNode* temp = _head;
+        _head = _head->next;
+        if (_head != nullptr) {
+            _head->previous = nullptr;
+        } else {
+            _tail = nullptr;
+        }
+        _size--;
+        releaseNode(temp);
+    }
+    return out;
 }
 
 // Element Viewing –––––––––––––––––––––––––––––––––––––––
@@ -111,7 +248,7 @@ template <typename T>
 T& Stack<T>::top() {
     if (empty()) {
         cout << "top failed\n";
-        throw empty_stack();
+        BII_THROW(empty_stack());
     }
     return _head->element;
 }
@@ -120,11 +257,21 @@ template <typename T>
 const T& Stack<T>::top() const {
     if (empty()) {
         cout << "top failed\n";
-        throw empty_stack();
+        BII_THROW(empty_stack());
     }
     return _head->element;
 }
 
+template <typename T>
+T* Stack<T>::tryTop() {
+    return const_cast<T*>(static_cast<const Stack<T>*>(this)->tryTop());
+}
+
+template <typename T>
+const T* Stack<T>::tryTop() const {
+    return empty() ? nullptr : &_head->element;
+}
+
 // Operators –––––––––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
@@ -133,14 +280,18 @@ Stack<T>& Stack<T>::operator+=(const T& element) {
     return *this;
 }
 
+template <typename T>
+Stack<T>& Stack<T>::operator+=(T&& element) {
+    push(move(element));
+    return *this;
+}
+
 template <typename T>
 Stack<T>& Stack<T>::operator+=(const Stack<T>& other) {
-    stackNode* temp = other._head;
-    // this can be done more efficiently. Maybe add a back pointer?
-    while (temp != nullptr) {
-        temp = temp->next;
-    }
-    while (temp != nullptr) {
+    // copy bottom to top so other's top ends up on top; the
+    // tail is read up front in case other is this stack
+    stackNode* temp = other._tail;
+    for (int i = other._size; i > 0; i--) {
         push(temp->element);
         temp = temp->previous;
     }
@@ -162,11 +313,71 @@ Stack<T>& Stack<T>::operator+=(const Stack<T>& other) {
 template <typename T>
 Stack<T>& Stack<T>::operator=(const Stack<T>& assign) {
     if (&assign == this) return *this;
-    _size = assign._size;
-    for (int i = 0; i < _size; i++) {
-        // Something like adding things to the end etc.
+    while (_head != nullptr) {
+        stackNode* temp = _head;
+        _head = _head->next;
+        releaseNode(temp);
+    }
+    _tail = nullptr;
+    _size = 0;
+    *this += assign;
+    return *this;
+}
+
+template <typename T>
+Stack<T>& Stack<T>::operator=(Stack<T>&& assign) {
+    if (&assign == this) return *this;
+    // the old pool goes away below, so the nodes only need destroying
+    if (!std::is_trivially_destructible<T>::value) {
+        while (_head != nullptr) {
+            stackNode* temp = _head;
+            _head = _head->next;
+            temp->~stackNode();
+        }
+        if (_pulled != nullptr) {
+            _pulled->~stackNode();
+        }
     }
+    _pool = move(assign._pool);
+    _head = assign._head;
+    _tail = assign._tail;
+    _pulled = assign._pulled;
+    _size = assign._size;
+    assign._head = nullptr;
+    assign._tail = nullptr;
+    assign._pulled = nullptr;
+    assign._size = 0;
+    return *this;
+}
+
+// Instrumentation –––––––––––––––––––––––––––––––––––––––
+
+#ifdef BII_STATS
+template <typename T>
+const container_stats& Stack<T>::stats() const {
+    return _stats.local();
+}
+
+template <typename T>
+void Stack<T>::dumpStats(std::ostream& out) const {
+    _stats.local().dump(out, "Stack");
+}
+
+template <typename T>
+container_stats Stack<T>::globalStats() {
+    return stackGlobalStats().snapshot();
+}
+
+template <typename T>
+void Stack<T>::dumpGlobalStats(std::ostream& out) {
+    stackGlobalStats().dump(out, "Stack (global)");
+}
+
+template <typename T>
+void Stack<T>::resetGlobalStats() {
+    stackGlobalStats().reset();
 }
+#endif
 
 // Friends –––––––––––––––––––––––––––––––––––––––––––––––
 template <typename T>
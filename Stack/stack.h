@@ -20,17 +20,72 @@
  * adding +=, some work on +, some work on =, and
  * == and !=.
  * 
+ * @version 1.0.3: October 19, 2026
+ * Added optional allocation instrumentation (see Stats/stats.h).
+ * Compiling with BII_STATS adds stats, dumpStats, globalStats,
+ * dumpGlobalStats, and resetGlobalStats; without it the hooks
+ * compile away entirely.
+ * 
+ * @version 1.0.4: October 19, 2026
+ * Fixed push, which linked new nodes through previous instead of
+ * next, and pull, which never decremented the size and leaked the
+ * popped node. The pulled node is now kept until the next pull.
+ * 
+ * @version 1.0.5: October 19, 2026
+ * Nodes now come from a per-stack NodePool (see node-pool.h).
+ * Pulled nodes go back on the pool's free list for the next push
+ * to reuse, and the destructor frees whole slabs at once, skipping
+ * the walk entirely when T is trivially destructible.
+ * 
+ * @version 1.0.6: October 19, 2026
+ * Added the r-value push and +=, emplace, and pop, which moves
+ * the top element out and frees its node right away. Nodes now
+ * construct their element in place instead of copying it.
+ * 
+ * @version 1.0.7: October 19, 2026
+ * Added a tail pointer, splice (O(1), adopting the other stack's
+ * node slabs), pushRange, and popN. Fixed += for stacks, whose
+ * copying loop never ran.
+ * 
+ * @version 1.0.8: October 19, 2026
+ * Finished the copy constructor and copy assignment. For O(1)
+ * snapshots of a stack, see PersistentStack (persistent-stack.h).
+ * 
+ * @version 1.0.9: October 19, 2026
+ * Added tryPop and tryTop, which report an empty stack through
+ * their return value instead of printing and throwing. empty_stack
+ * moved to Exceptions/exception.h, and every throw goes through
+ * BII_THROW, so the stack also builds with -fno-exceptions.
+ * 
+ * @version 1.0.10: October 19, 2026
+ * Defined move assignment, which takes over the other stack's nodes
+ * and node pool. It was declared for a const r-value and never
+ * defined, so assigning from std::move failed to link.
  * 
  */
 #pragma once
 #include <iostream>
-// #include "../exceptions/exception.h"
+#include <optional>
+#include <utility>
+#include "../Stats/stats.h"
+#include "../Exceptions/exception.h"
+#include "node-pool.h"
 
 using std::cout;
 using std::endl;
 using std::move;
 using std::copy;
 
+#ifdef BII_STATS
+/**
+ * Aggregate instrumentation for every Stack in the process
+ */
+inline global_stats& stackGlobalStats() {
+    static global_stats stats;
+    return stats;
+}
+#endif
+
 template <typename T>
 class Stack {
 public:
@@ -43,8 +98,9 @@ public:
 
     /**
      * Copy Constructor
+     * O(N) asymptotic complexity (see PersistentStack for O(1) snapshots)
      */
-    Stack(Stack<T>& other);
+    Stack(const Stack<T>& other);
 
     /**
      * Move Constructor
@@ -53,7 +109,8 @@ public:
 
     /** 
      * Destructor
-     * O(N) asymptotic complexity (N is the size of the stack)
+     * O(N) asymptotic complexity (N is the size of the stack),
+     * O(number of slabs) when T is trivially destructible
      */
     ~Stack();
 
@@ -77,11 +134,65 @@ public:
      */
     Stack<T>& push(const T& element);
 
-    // rvalue version of push?
-    // Stack<T>& push(const T&& element);
+    /**
+     * Adds an r-value element to the top of the stack
+     * O(1) asymptotic complexity
+     */
+    Stack<T>& push(T&& element);
+
+    /**
+     * Constructs an element in place on the top of the stack
+     * O(1) asymptotic complexity
+     */
+    template <typename... Args>
+    Stack<T>& emplace(Args&&... args);
+
+    /**
+     * Removes the element on the top of the stack and returns it
+     * by value, moving it out of its node
+     * Throws an error if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    T pop();
+
+    /**
+     * Removes the element on the top of the stack and returns it
+     * by value, or returns nothing if the stack is empty
+     * O(1) asymptotic complexity
+     */
+    std::optional<T> tryPop();
+
+    /**
+     * Moves every node of the given stack onto the top of this
+     * one, keeping its order (its top becomes the new top), and
+     * leaves it empty. The reference from its last pull is
+     * invalidated.
+     * O(1) asymptotic complexity
+     */
+    Stack<T>& splice(Stack<T>&& other);
+
+    /**
+     * Pushes the elements in [first, last) in order, so the
+     * last one ends up on top. Pass move iterators to move
+     * the elements instead of copying them.
+     * O(N) asymptotic complexity (N is the length of the range)
+     */
+    template <typename InputIt>
+    Stack<T>& pushRange(InputIt first, InputIt last);
+
+    /**
+     * Pops the given number of elements, moving them to out
+     * from the top down, and returns the advanced iterator
+     * Throws an error, popping nothing, if the stack has fewer
+     * elements
+     * O(K) asymptotic complexity (K is the number popped)
+     */
+    template <typename OutputIt>
+    OutputIt popN(size_t count, OutputIt out);
 
     /**
      * Removes an element from the top of the stack
+     * The returned reference is valid until the next pull
      * O(1) asymptotic complexity
      */
     T& pull();
@@ -101,6 +212,20 @@ public:
      */
     const T& top() const;
 
+    /**
+     * Returns a pointer to the element on the top of the stack,
+     * or nullptr if the stack is empty (non-const)
+     * O(1) asymptotic complexity
+     */
+    T* tryTop();
+
+    /**
+     * Returns a pointer to the element on the top of the stack,
+     * or nullptr if the stack is empty (const)
+     * O(1) asymptotic complexity
+     */
+    const T* tryTop() const;
+
     // Operators –––––––––––––––––––––––––––––––––––––––––––––
     /**
      * Adds the given element to the top of the stack
@@ -108,26 +233,32 @@ public:
      */
     Stack<T>& operator+=(const T& element);
 
-    // rvalue version of +=?
-    // Stack<T>& operator+=(const T&& element);
-    // version where you add another stack to the top
-    // and an rvalue version of that
+    /**
+     * Adds the given r-value element to the top of the stack
+     * O(1) asymptotic complexity
+     */
+    Stack<T>& operator+=(T&& element);
 
     /**
-     * Adds the given stack to the top of the stack
+     * Adds copies of the given stack's elements to the top of
+     * the stack, keeping their order (see splice to move them)
      * O(N) asymptotic complexity
      */
     Stack<T>& operator+=(const Stack<T>& other);
 
     /**
      * Copy Assignment
+     * O(N + M) asymptotic complexity
      */
     Stack<T>& operator=(const Stack<T>& assign);
 
     /**
      * Move Assignment
+     * Takes over the nodes and node pool of the given stack,
+     * leaving it empty
+     * O(N) asymptotic complexity in the elements replaced
      */
-    Stack<T>& operator=(const Stack<T>&& assign);
+    Stack<T>& operator=(Stack<T>&& assign);
 
     // Friends –––––––––––––––––––––––––––––––––––––––––––––––
     /**
@@ -144,6 +275,34 @@ public:
     template <typename T_>
     friend bool operator!=(const Stack<T_>& left, const Stack<T_>& right);
 
+#ifdef BII_STATS
+    // Instrumentation –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the allocation counters of this stack
+     */
+    const container_stats& stats() const;
+
+    /**
+     * Prints the counters of this stack
+     */
+    void dumpStats(std::ostream& out) const;
+
+    /**
+     * Returns the counters aggregated over every stack
+     */
+    static container_stats globalStats();
+
+    /**
+     * Prints the counters aggregated over every stack
+     */
+    static void dumpGlobalStats(std::ostream& out);
+
+    /**
+     * Sets the aggregated counters back to zero
+     */
+    static void resetGlobalStats();
+#endif
+
     // Non-Members (Not Declared) ––––––––––––––––––––––––––––
     // Stack<T> operator+(const T& left, const Stack<T>& right);
     // Stack<T> operator+(const Stack<T>& left, const T& right);
@@ -159,9 +318,10 @@ private:
         stackNode* previous;
         /** Address of the next node */
         stackNode* next;
-        /** stackNode constructor */
-        stackNode(const T& element, stackNode* previous, stackNode* next) :
-            element(element), previous(previous), next(next) { }
+        /** stackNode constructor, building the element from the given arguments */
+        template <typename... Args>
+        stackNode(stackNode* previous, stackNode* next, Args&&... args) :
+            element(std::forward<Args>(args)...), previous(previous), next(next) { }
 
         /** 
          * Overloaded the << operator to be able to print out
@@ -176,21 +336,45 @@ private:
     /** Pointer to the top of the stack */
     stackNode* _head;
 
+    /** Pointer to the bottom of the stack */
+    stackNode* _tail;
+
+    /** 
+     * The most recently pulled node, kept alive so the reference
+     * returned by pull stays valid until the next pull
+     */
+    stackNode* _pulled;
+
     /** The number of nodes in the stack */
     int _size;
 
+    /** Slabs the nodes are carved from */
+    NodePool<stackNode> _pool;
+
+#ifdef BII_STATS
+    /** Allocation counters */
+    stats_recorder _stats = stats_recorder(stackGlobalStats());
+#endif
+
+    /**
+     * Destroys the given node and returns its memory to the pool
+     */
+    void releaseNode(stackNode* node);
+
+    /**
+     * Builds a node from the given arguments on top of the stack
+     */
+    template <typename... Args>
+    void linkNode(Args&&... args);
+
+    /**
+     * Moves the top element out, frees its node, and returns the
+     * element; the stack must not be empty
+     */
+    T unlinkTop();
+
     // maybe declare a temp pointer for use
     // throughout the class defs... kinda annoying to keep declaring... i dunno
 };
 
-/**
- * Exception handler for attempts to access
- * an empty stack
- */
-struct empty_stack : public std::exception {
-    const char * what () const throw () {
-        return "Trying to access an empty stack";
-    }
-};
-
 #include "stack.cpp"
@@ -1,5 +1,13 @@
 #include "stack.h"
+#include "array-stack.h"
+#include "concurrent-stack.h"
+#include "persistent-stack.h"
+#include "small-stack.h"
+#include "aggregate-stack.h"
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 using std::cout;
 using std::endl;
@@ -15,11 +23,18 @@ using std::endl;
 // Test Settings
 const bool section_A = true; // Constructors/Destructor (4 Methods)
 const bool section_B = true; // Capacity (2 Methods)
-const bool section_C = true; // Modifiers (2 Methods)
-const bool section_D = true; // Element Viewing (2 Methods)
-const bool section_E = true; // Operators (4 Methods)
+const bool section_C = true; // Modifiers (9 Methods)
+const bool section_D = true; // Element Viewing (4 Methods)
+const bool section_E = true; // Operators (5 Methods)
 const bool section_F = true; // Friends (2 Methods)
 const bool section_G = true; // Non-Members (3 Methods)
+const bool section_H = true; // Instrumentation (5 Methods, needs -DBII_STATS)
+const bool section_I = true; // Array Stack (6 Methods)
+const bool section_J = true; // Node Pool (3 Methods)
+const bool section_K = true; // Concurrent Stack (4 Methods, run under -fsanitize=thread)
+const bool section_L = true; // Persistent Stack (4 Methods)
+const bool section_M = true; // Small Stack (4 Methods)
+const bool section_N = true; // Aggregate Stack/Queue (4 Methods)
 
 /** 
  * Given two values, returns true if they are equal
@@ -33,7 +48,74 @@ bool expectEqual(T first, S second) {
  * Macro for testing Stack Constructor/Destructor methods
  */
 void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
-    cout << "Hello from testA!" << endl;
+    Stack<std::string> stk;
+    for (int i = 0; i < size; i++) {
+        stk.push(std::to_string(i));
+    }
+
+    // test copy constructor keeps the order and shares nothing
+    Stack<std::string> copy(stk);
+    copy.push("extra");
+    bool copied = expectEqual(copy.size(), size + 1) && expectEqual(stk.size(), size);
+    copy.pop();
+    for (int i = size - 1; i >= 0; i--) {
+        copied = copied && expectEqual(copy.pop(), std::to_string(i));
+    }
+    if (!copied) {
+        cout << "Copy Constructor : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Copy Constructor : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test copy assignment replaces the old contents
+    Stack<std::string> assigned;
+    assigned.push("old");
+    assigned = stk;
+    bool replaced = expectEqual(assigned.size(), size);
+    for (int i = size - 1; i >= 0; i--) {
+        replaced = replaced && expectEqual(assigned.pop(), std::to_string(i));
+    }
+    if (!replaced || !assigned.empty()) {
+        cout << "Copy Assignment : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Copy Assignment : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test move constructor leaves the source empty
+    Stack<std::string> moved(move(stk));
+    if (!expectEqual(moved.size(), size) || !stk.empty() || (size > 0 && !expectEqual(moved.top(), std::to_string(size - 1)))) {
+        cout << "Move Constructor : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Move Constructor : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test move assignment takes the nodes and leaves the source usable
+    Stack<std::string> target;
+    target.push("old");
+    target.push("older");
+    target.pull();
+    target = move(moved);
+    bool took = expectEqual(target.size(), size) && moved.empty();
+    moved.push("again");
+    target.push("top");
+    took = took && expectEqual(moved.pop(), "again") && expectEqual(target.pop(), "top");
+    for (int i = size - 1; i >= 0; i--) {
+        took = took && expectEqual(target.pop(), std::to_string(i));
+    }
+    target = move(target);
+    if (!took || !target.empty() || !moved.empty()) {
+        cout << "Move Assignment : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Move Assignment : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
@@ -95,6 +177,163 @@ void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
         numTestsPassed++;
     }
 
+    // test r-value push leaves the source moved from
+    bool movedFrom = true;
+    for (int i = 0; i < size; i++) {
+        std::string value(64, 'a' + i % 26);
+        stk.push(move(value));
+        movedFrom = movedFrom && value.empty();
+    }
+    if (!movedFrom || !expectEqual(stk.size(), size) || !expectEqual(stk.top(), std::string(64, 'a' + (size - 1) % 26))) {
+        cout << "Push (r-value) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Push (r-value) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test pop returns the elements by value in reverse order
+    bool ordered = true;
+    for (int i = size - 1; i >= 0; i--) {
+        ordered = ordered && expectEqual(stk.pop(), std::string(64, 'a' + i % 26));
+    }
+    bool threw = false;
+    try {
+        stk.pop();
+    } catch (const empty_stack&) {
+        threw = true;
+    }
+    if (!ordered || !stk.empty() || !threw) {
+        cout << "Pop : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Pop : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test tryPop returns the elements and then nothing
+    for (int i = 0; i < size; i++) {
+        stk.push(std::to_string(i));
+    }
+    bool tried = true;
+    for (int i = size - 1; i >= 0; i--) {
+        std::optional<std::string> popped = stk.tryPop();
+        tried = tried && popped && expectEqual(*popped, std::to_string(i));
+    }
+    if (!tried || stk.tryPop() || !stk.empty()) {
+        cout << "TryPop : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "TryPop : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test emplace builds the element from its constructor arguments
+    for (int i = 0; i < size; i++) {
+        stk.emplace(3, 'x');
+    }
+    if (!expectEqual(stk.size(), size) || !expectEqual(stk.top(), "xxx")) {
+        cout << "Emplace : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Emplace : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test pushRange and popN move elements in order
+    std::vector<std::string> values;
+    for (int i = 0; i < size; i++) {
+        values.push_back(std::to_string(i));
+    }
+    Stack<std::string> ranged;
+    ranged.pushRange(values.begin(), values.end());
+    std::vector<std::string> popped;
+    ranged.popN(size / 2, std::back_inserter(popped));
+    bool inOrder = expectEqual(ranged.size(), size - size / 2) && expectEqual(popped.size(), size / 2);
+    for (int i = 0; i < size / 2; i++) {
+        inOrder = inOrder && expectEqual(popped[i], std::to_string(size - 1 - i));
+    }
+    bool overdrawn = false;
+    try {
+        ranged.popN(ranged.size() + 1, std::back_inserter(popped));
+    } catch (const empty_stack&) {
+        overdrawn = true;
+    }
+    // a write that throws partway leaves the stack holding exactly the elements not yet written
+    struct limitedWriter {
+        std::vector<std::string>* sink;
+        size_t room;
+        limitedWriter& operator*() { return *this; }
+        limitedWriter& operator++() { return *this; }
+        limitedWriter& operator=(std::string&& value) {
+            if (sink->size() == room) {
+                throw std::length_error("writer full");
+            }
+            sink->push_back(std::move(value));
+            return *this;
+        }
+    };
+    size_t remaining = ranged.size();
+    bool interrupted = true;
+    if (remaining >= 3) {
+        std::vector<std::string> written;
+        interrupted = false;
+        try {
+            ranged.popN(3, limitedWriter{&written, 2});
+        } catch (const std::length_error&) {
+            interrupted = expectEqual(ranged.size(), remaining - 2) && expectEqual(ranged.top(), std::to_string(remaining - 3));
+        }
+        ranged.popN(ranged.size(), std::back_inserter(written));
+        ranged.push("again");
+        interrupted = interrupted && expectEqual(written.size(), remaining) && expectEqual(ranged.size(), 1)
+            && expectEqual(ranged.pop(), "again") && ranged.empty();
+        ranged.pushRange(values.begin(), values.begin() + remaining);
+    }
+    if (!inOrder || !overdrawn || !interrupted || !expectEqual(ranged.size(), size - size / 2)) {
+        cout << "PushRange/PopN : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "PushRange/PopN : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test splice relinks the other stack on top and empties it
+    Stack<std::string> bottom;
+    Stack<std::string> top;
+    bottom.pushRange(values.begin(), values.begin() + size / 2);
+    top.pushRange(values.begin() + size / 2, values.end());
+    top.pull();
+    top.push(values.back());
+    bottom.splice(move(top));
+    bool spliced = expectEqual(bottom.size(), size) && top.empty();
+    for (int i = size - 1; i >= 0; i--) {
+        spliced = spliced && expectEqual(bottom.pop(), values[i]);
+    }
+    if (!spliced || !bottom.empty()) {
+        cout << "Splice : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Splice : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that spliced stacks keep reusing and growing their pools
+    for (int round = 0; round < 4; round++) {
+        Stack<std::string> piece;
+        piece.pushRange(values.begin(), values.end());
+        bottom.splice(move(piece));
+        for (int i = 0; i < size / 2; i++) {
+            bottom.pop();
+        }
+    }
+    bottom.pushRange(values.begin(), values.end());
+    if (!expectEqual(bottom.size(), 4 * (size - size / 2) + size) || !expectEqual(bottom.top(), values.back())) {
+        cout << "Splice (repeated) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Splice (repeated) : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
@@ -118,13 +357,79 @@ void testD(const int size, int& numTestsPassed, int& numTestsFailed) {
         cout << "Top (non-const) : PASSED" << endl;
         numTestsPassed++;
     }
+
+    // test tryTop on a full and an empty stack
+    stk.push("Quantico");
+    const Stack<std::string>& viewed = stk;
+    bool found = stk.tryTop() == &stk.top() && viewed.tryTop() == &viewed.top();
+    stk.pop();
+    if (!found || stk.tryTop() != nullptr || viewed.tryTop() != nullptr) {
+        cout << "TryTop : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "TryTop : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that an empty stack can be caught as any empty container
+    bool caught = false;
+    try {
+        stk.top();
+    } catch (const empty_container& e) {
+        caught = expectEqual(std::string(e.what()), "Trying to access an empty stack");
+    }
+    if (!caught) {
+        cout << "Top (empty_container) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Top (empty_container) : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
  * Macro for testing Stack Operator methods
  */
 void testE(const int size, int& numTestsPassed, int& numTestsFailed) {
-    cout << "Hello from testE!" << endl;
+    Stack<std::string> stk;
+
+    // test += with an element
+    for (int i = 0; i < size; i++) {
+        stk += std::to_string(i);
+    }
+    if (!expectEqual(stk.size(), size) || !expectEqual(stk.top(), std::to_string(size - 1))) {
+        cout << "Operator+= (element) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Operator+= (element) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test += with a stack keeps both stacks' order
+    Stack<std::string> other;
+    other += stk;
+    other += stk;
+    bool ordered = expectEqual(other.size(), 2 * size) && expectEqual(stk.size(), size);
+    for (int i = 2 * size - 1; i >= 0; i--) {
+        ordered = ordered && expectEqual(other.pop(), std::to_string(i % size));
+    }
+    if (!ordered) {
+        cout << "Operator+= (stack) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Operator+= (stack) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test += with itself doubles the stack
+    stk += stk;
+    if (!expectEqual(stk.size(), 2 * size) || !expectEqual(stk.top(), std::to_string(size - 1))) {
+        cout << "Operator+= (itself) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Operator+= (itself) : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
@@ -141,6 +446,550 @@ void testG(const int size, int& numTestsPassed, int& numTestsFailed) {
     cout << "Hello from testG!" << endl;
 }
 
+/**
+ * Macro for testing Stack Instrumentation methods
+ */
+void testH(const int size, int& numTestsPassed, int& numTestsFailed) {
+#ifdef BII_STATS
+    Stack<int>::resetGlobalStats();
+    Stack<int> stk;
+    for (int i = 0; i < size; i++) {
+        stk.push(i);
+    }
+
+    // test node allocation counters
+    if (!expectEqual(stk.stats().nodeAllocations, size) || !expectEqual(Stack<int>::globalStats().nodeAllocations, size)) {
+        cout << "Stats : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Stats : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that pushes after pulls reuse pooled nodes
+    for (int i = 0; i < size; i++) {
+        stk.pull();
+    }
+    for (int i = 0; i < size / 2; i++) {
+        stk.push(i);
+    }
+    if (!expectEqual(stk.stats().nodeAllocations, size)) {
+        cout << "Stats (pooled nodes) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Stats (pooled nodes) : PASSED" << endl;
+        numTestsPassed++;
+    }
+    stk.dumpStats(cout);
+#else
+    cout << "SKIP (compile with -DBII_STATS)" << endl;
+#endif
+}
+
+/**
+ * Macro for testing ArrayStack methods
+ */
+void testI(const int size, int& numTestsPassed, int& numTestsFailed) {
+    ArrayStack<std::string> stk;
+
+    // test push
+    for (int i = 0; i < size; i++) {
+        stk.push(std::to_string(i));
+    }
+    if (!expectEqual(stk.size(), size) || !expectEqual(stk.top(), std::to_string(size - 1))) {
+        cout << "ArrayStack Push : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ArrayStack Push : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test += and ==
+    ArrayStack<std::string> other;
+    other += stk;
+    if (!(other == stk)) {
+        cout << "ArrayStack Operator+= (stack) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ArrayStack Operator+= (stack) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test pull returns elements in reverse order
+    bool ordered = true;
+    for (int i = size - 1; i >= 0; i--) {
+        ordered = ordered && expectEqual(stk.pull(), std::to_string(i));
+    }
+    if (!ordered || !stk.empty()) {
+        cout << "ArrayStack Pull : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ArrayStack Pull : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test pulling from an empty stack
+    bool threw = false;
+    try {
+        stk.pull();
+    } catch (const empty_stack&) {
+        threw = true;
+    }
+    if (!threw) {
+        cout << "ArrayStack Pull (empty) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ArrayStack Pull (empty) : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Macro for testing NodePool methods
+ */
+void testJ(const int size, int& numTestsPassed, int& numTestsFailed) {
+    NodePool<std::string> pool;
+
+    // test that a freed node is the next one handed out
+    void* first = pool.allocate();
+    pool.deallocate(first);
+    if (!pool.hasFree() || pool.allocate() != first || pool.hasFree()) {
+        cout << "NodePool Reuse : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "NodePool Reuse : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that slabs grow geometrically
+    for (int i = 1; i < size; i++) {
+        pool.allocate();
+    }
+    size_t slabs = 0;
+    for (size_t room = 0, count = NodePool<std::string>::firstSlabNodes; room < size_t(size); slabs++) {
+        room += count;
+        if (count < NodePool<std::string>::maxSlabNodes) count *= 2;
+    }
+    if (!expectEqual(pool.slabCount(), slabs)) {
+        cout << "NodePool Slabs : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "NodePool Slabs : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test a stack churning through pooled nodes
+    Stack<std::string> stk;
+    bool ordered = true;
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < size; i++) {
+            stk.push(std::to_string(i));
+        }
+        for (int i = size - 1; i >= size / 2; i--) {
+            ordered = ordered && expectEqual(stk.pull(), std::to_string(i));
+        }
+        for (int i = size / 2; i < size; i++) {
+            stk.push(std::to_string(i));
+        }
+        for (int i = size - 1; i >= 0; i--) {
+            ordered = ordered && expectEqual(stk.pull(), std::to_string(i));
+        }
+    }
+    if (!ordered || !stk.empty()) {
+        cout << "NodePool Stack Churn : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "NodePool Stack Churn : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Macro for testing ConcurrentStack methods
+ */
+void testK(const int size, int& numTestsPassed, int& numTestsFailed) {
+    const int threads = 4;
+    const int perThread = size / threads;
+
+    // test single-threaded push, top, and pull
+    ConcurrentStack<std::string> stk;
+    for (int i = 0; i < perThread; i++) {
+        stk.push(std::to_string(i));
+    }
+    bool ordered = stk.size() == size_t(perThread) && (perThread == 0 || *stk.top() == std::to_string(perThread - 1));
+    for (int i = perThread - 1; i >= 0; i--) {
+        std::optional<std::string> pulled = stk.pull();
+        ordered = ordered && pulled && *pulled == std::to_string(i);
+    }
+    if (!ordered || !stk.empty() || stk.pull() || stk.top()) {
+        cout << "ConcurrentStack Push/Pull : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ConcurrentStack Push/Pull : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that concurrent pushes lose nothing
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&stk, t, perThread] {
+            for (int i = 0; i < perThread; i++) {
+                stk.push(std::to_string(t * perThread + i));
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    workers.clear();
+    std::vector<int> seen(threads * perThread, 0);
+    while (std::optional<std::string> pulled = stk.pull()) {
+        seen[std::stoi(*pulled)]++;
+    }
+    bool exact = true;
+    for (int count : seen) exact = exact && count == 1;
+    if (!exact) {
+        cout << "ConcurrentStack Concurrent Push : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ConcurrentStack Concurrent Push : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that concurrent pushes and pulls hand out every element once
+    std::vector<std::vector<int>> pulledBy(threads);
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&stk, &pulledBy, t, perThread] {
+            for (int i = 0; i < perThread; i++) {
+                stk.push(std::to_string(t * perThread + i));
+                if (i % 2 == 1) {
+                    for (int j = 0; j < 2; j++) {
+                        if (std::optional<std::string> pulled = stk.pull()) {
+                            pulledBy[t].push_back(std::stoi(*pulled));
+                        }
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    workers.clear();
+    std::fill(seen.begin(), seen.end(), 0);
+    for (const std::vector<int>& pulled : pulledBy) {
+        for (int value : pulled) seen[value]++;
+    }
+    while (std::optional<std::string> pulled = stk.pull()) {
+        seen[std::stoi(*pulled)]++;
+    }
+    exact = true;
+    for (int count : seen) exact = exact && count == 1;
+    if (!exact) {
+        cout << "ConcurrentStack Concurrent Push/Pull : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ConcurrentStack Concurrent Push/Pull : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that top can copy elements while other threads pull them
+    for (int i = 0; i < threads * perThread; i++) {
+        stk.push(std::to_string(i));
+    }
+    bool readable = true;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&stk, &readable, t] {
+            bool valid = true;
+            while (!stk.empty()) {
+                std::optional<std::string> value = t % 2 ? stk.top() : stk.pull();
+                valid = valid && (!value || !value->empty());
+                if (t % 2 && value) {
+                    stk.pull();
+                }
+            }
+            if (!valid) readable = false;
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    if (!readable || !stk.empty()) {
+        cout << "ConcurrentStack Top (while pulling) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "ConcurrentStack Top (while pulling) : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Macro for testing PersistentStack methods
+ */
+void testL(const int size, int& numTestsPassed, int& numTestsFailed) {
+    // test that pushes leave older versions unchanged
+    std::vector<PersistentStack<std::string>> versions(1);
+    for (int i = 0; i < size; i++) {
+        versions.push_back(versions.back().push(std::to_string(i)));
+    }
+    bool unchanged = true;
+    for (int i = 0; i <= size; i++) {
+        unchanged = unchanged && expectEqual(versions[i].size(), i) &&
+                    (i == 0 || expectEqual(versions[i].top(), std::to_string(i - 1)));
+    }
+    if (!unchanged) {
+        cout << "PersistentStack Push : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "PersistentStack Push : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that popping returns the version below and branches share it
+    PersistentStack<std::string> snapshot = versions.back();
+    PersistentStack<std::string> below = snapshot.pop();
+    PersistentStack<std::string> branch = below.push("branch");
+    bool popped = below == versions[size - 1] && branch != snapshot &&
+                  expectEqual(branch.size(), snapshot.size()) && expectEqual(snapshot.top(), versions.back().top());
+    bool threw = false;
+    try {
+        versions[0].pop();
+    } catch (const empty_stack&) {
+        threw = true;
+    }
+    if (!popped || !threw) {
+        cout << "PersistentStack Pop : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "PersistentStack Pop : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test iteration from the top down
+    int expected = size - 1;
+    bool ordered = true;
+    for (const std::string& element : snapshot) {
+        ordered = ordered && expectEqual(element, std::to_string(expected--));
+    }
+    if (!ordered || expected != -1) {
+        cout << "PersistentStack Iterators : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "PersistentStack Iterators : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test versions sharing nodes across threads, dropping the only
+    // reference to a deep chain at the end
+    versions.clear();
+    std::vector<std::thread> workers;
+    std::vector<size_t> sizes(4);
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([snapshot, &sizes, t] {
+            PersistentStack<std::string> mine = snapshot;
+            for (int i = 0; i < 100; i++) {
+                PersistentStack<std::string> grown = mine.push(std::to_string(t));
+                mine = grown.pop();
+                if (!mine.empty()) mine = mine.pop();
+            }
+            sizes[t] = mine.size();
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    bool shared = true;
+    for (size_t count : sizes) shared = shared && expectEqual(count, size > 100 ? size - 100 : 0);
+    snapshot = PersistentStack<std::string>();
+    below = branch = snapshot;
+    if (!shared) {
+        cout << "PersistentStack Sharing : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "PersistentStack Sharing : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Macro for testing SmallStack methods
+ */
+void testM(const int size, int& numTestsPassed, int& numTestsFailed) {
+    SmallStack<std::string, 8> stk;
+
+    // test that shallow stacks stay inline
+    for (int i = 0; i < 8; i++) {
+        stk.push(std::to_string(i));
+    }
+    if (!stk.isInline() || !expectEqual(stk.top(), "7")) {
+        cout << "SmallStack Inline : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "SmallStack Inline : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test spilling into chunks and pulling back in order
+    for (int i = 8; i < size; i++) {
+        stk.emplace(std::to_string(i));
+    }
+    bool ordered = expectEqual(stk.size(), size < 8 ? 8 : size) && (size <= 8 || !stk.isInline());
+    for (int i = (size < 8 ? 8 : size) - 1; i >= 0; i--) {
+        ordered = ordered && expectEqual(stk.pull(), std::to_string(i));
+    }
+    if (!ordered || !stk.empty()) {
+        cout << "SmallStack Spill : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "SmallStack Spill : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test hovering around a chunk boundary
+    for (int i = 0; i < 8 + 8 + 16; i++) {
+        stk.push(std::to_string(i));
+    }
+    bool hovered = true;
+    for (int i = 0; i < size; i++) {
+        stk.push("extra");
+        hovered = hovered && expectEqual(stk.pull(), "extra");
+        hovered = hovered && expectEqual(stk.pull(), "31");
+        stk.push("31");
+    }
+    if (!hovered || !expectEqual(stk.size(), 32)) {
+        cout << "SmallStack Boundary : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "SmallStack Boundary : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test copies and moves
+    SmallStack<std::string, 8> copy(stk);
+    SmallStack<std::string, 8> moved(move(stk));
+    SmallStack<std::string, 8> assigned;
+    assigned = copy;
+    if (!(copy == moved) || !(assigned == moved) || !stk.empty() || copy != moved) {
+        cout << "SmallStack Copy/Move : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "SmallStack Copy/Move : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * A non-commutative monoid: the elements joined in order
+ */
+struct concatOf {
+    using value_type = std::string;
+    std::string lift(const std::string& element) const { return element; }
+    std::string combine(const std::string& left, const std::string& right) const { return left + right; }
+};
+
+/**
+ * Macro for testing AggregateStack, MinMaxStack, and AggregateQueue methods
+ */
+void testN(const int size, int& numTestsPassed, int& numTestsFailed) {
+    // test min and max against a zigzag of pushes and pulls
+    MinMaxStack<int> minMax;
+    std::vector<int> pushed;
+    // the min and max of pushed up to each position, kept as a reference
+    std::vector<int> lows;
+    std::vector<int> highs;
+    bool tracked = true;
+    for (int i = 0; i < size; i++) {
+        int value = static_cast<int>((i * 7919LL) % 1000) - 500;
+        minMax.push(value);
+        pushed.push_back(value);
+        lows.push_back(lows.empty() || value < lows.back() ? value : lows.back());
+        highs.push_back(highs.empty() || value > highs.back() ? value : highs.back());
+        if (i % 3 == 2) {
+            tracked = tracked && expectEqual(minMax.pull(), pushed.back());
+            pushed.pop_back();
+            lows.pop_back();
+            highs.pop_back();
+        }
+        if (!pushed.empty()) {
+            tracked = tracked && expectEqual(minMax.min(), lows.back()) && expectEqual(minMax.max(), highs.back());
+        }
+    }
+    if (!tracked || !expectEqual(minMax.size(), pushed.size())) {
+        cout << "MinMaxStack Min/Max : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "MinMaxStack Min/Max : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that an empty stack or queue throws
+    bool threw = false;
+    minMax.clear();
+    try {
+        minMax.min();
+    } catch (empty_stack& e) {
+        threw = true;
+    }
+    AggregateQueue<int> emptyQueue;
+    bool queueThrew = false;
+    try {
+        emptyQueue.pull();
+    } catch (empty_queue& e) {
+        queueThrew = true;
+    }
+    if (!threw || !queueThrew || !minMax.empty()) {
+        cout << "Aggregate Empty : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Aggregate Empty : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test a sliding-window minimum against a recomputed one
+    const int window = 16;
+    AggregateQueue<int, minOf<int>> sliding;
+    std::vector<int> values;
+    bool slid = true;
+    for (int i = 0; i < size; i++) {
+        values.push_back(static_cast<int>((i * 104729LL) % 10007));
+        sliding.push(values.back());
+        if (sliding.size() > window) {
+            slid = slid && expectEqual(sliding.pull(), values[i - window]);
+        }
+        int low = values[i];
+        for (int j = i; j >= 0 && j > i - window; j--) {
+            low = values[j] < low ? values[j] : low;
+        }
+        slid = slid && expectEqual(sliding.aggregate(), low);
+    }
+    if (!slid) {
+        cout << "AggregateQueue Sliding Min : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AggregateQueue Sliding Min : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that a non-commutative monoid keeps its order
+    AggregateQueue<std::string, concatOf> joined;
+    AggregateStack<std::string, concatOf> stacked;
+    std::string expected;
+    bool ordered = true;
+    for (int i = 0; i < 26 * 4; i++) {
+        std::string letter(1, char('a' + i % 26));
+        joined.push(letter);
+        stacked.push(letter);
+        expected += letter;
+        if (i % 5 == 4) {
+            ordered = ordered && expectEqual(joined.pull(), expected.substr(0, 1));
+            expected.erase(0, 1);
+        }
+        ordered = ordered && expectEqual(joined.aggregate(), expected);
+    }
+    ordered = ordered && expectEqual(stacked.aggregate().substr(0, 3), "abc");
+    stacked.pull();
+    ordered = ordered && expectEqual(stacked.aggregate().back(), 'y');
+    if (!ordered) {
+        cout << "Aggregate Order : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Aggregate Order : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
 /**
  * Given the desired section and the appropriate information, 
  * performs the tests of that section
@@ -191,6 +1040,13 @@ int main() {
     cout << "Section E : Operators" << endl;
     cout << "Section F : Friends" << endl;
     cout << "Section G : Non-Members" << endl;
+    cout << "Section H : Instrumentation" << endl;
+    cout << "Section I : Array Stack" << endl;
+    cout << "Section J : Node Pool" << endl;
+    cout << "Section K : Concurrent Stack" << endl;
+    cout << "Section L : Persistent Stack" << endl;
+    cout << "Section M : Small Stack" << endl;
+    cout << "Section N : Aggregate Stack/Queue" << endl;
     cout << endl;
 
     // get testSize
@@ -217,6 +1073,13 @@ int main() {
     doTest('E', section_E, testSize, numTestsPassed, numTestsFailed, testE);
     doTest('F', section_F, testSize, numTestsPassed, numTestsFailed, testF);
     doTest('G', section_G, testSize, numTestsPassed, numTestsFailed, testG);
+    doTest('H', section_H, testSize, numTestsPassed, numTestsFailed, testH);
+    doTest('I', section_I, testSize, numTestsPassed, numTestsFailed, testI);
+    doTest('J', section_J, testSize, numTestsPassed, numTestsFailed, testJ);
+    doTest('K', section_K, testSize, numTestsPassed, numTestsFailed, testK);
+    doTest('L', section_L, testSize, numTestsPassed, numTestsFailed, testL);
+    doTest('M', section_M, testSize, numTestsPassed, numTestsFailed, testM);
+    doTest('N', section_N, testSize, numTestsPassed, numTestsFailed, testN);
 
     // Inform user as to which tests passed
     if (!numTestsFailed) {
@@ -0,0 +1,280 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the BII StaticVector class
+ */
+#pragma once
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "static-vector.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::checkRoom(size_t count, const char* caller) const {
+    if (count > N - _size) {
+        cout << caller << " failed\n";
+        BII_THROW(full_vector());
+    }
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector() : base() { }
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(size_t times, const T& val) : base() {
+    checkRoom(times, "Fill constructor");
+    for (; _size < times; _size++) {
+        constructAt(_size, val);
+    }
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(std::initializer_list<T> given) : base() {
+    checkRoom(given.size(), "Initializer list constructor");
+    for (const T& value : given) {
+        constructAt(_size, value);
+        _size++;
+    }
+}
+
+template <typename T, size_t N>
+template <typename Iterator, typename>
+constexpr StaticVector<T, N>::StaticVector(Iterator first, Iterator last) : base() {
+    for (; first != last; ++first) {
+        addBack(*first);
+    }
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr size_t StaticVector<T, N>::size() const {
+    return _size;
+}
+
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::empty() const {
+    return _size == 0;
+}
+
+template <typename T, size_t N>
+constexpr size_t StaticVector<T, N>::capacity() const {
+    return N;
+}
+
+template <typename T, size_t N>
+constexpr size_t StaticVector<T, N>::open() const {
+    return N - _size;
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::addBack(const T& value) {
+    checkRoom(1, "addBack");
+    constructAt(_size, value);
+    _size++;
+    return *this;
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::addBack(T&& value) {
+    checkRoom(1, "addBack");
+    constructAt(_size, std::move(value));
+    _size++;
+    return *this;
+}
+
+template <typename T, size_t N>
+constexpr T StaticVector<T, N>::removeBack() {
+    if (empty()) {
+        cout << "removeBack failed\n";
+        BII_THROW(empty_vector());
+    }
+    T element(std::move(data()[_size - 1]));
+    _size--;
+    destroyAt(_size);
+    return element;
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::remove(const iterator index) {
+    if (index >= end() || index < begin()) {
+        cout << "remove failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    for (iterator iter = index; iter + 1 < end(); iter++) {
+        *iter = std::move(*(iter + 1));
+    }
+    _size--;
+    destroyAt(_size);
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::insert(const T& value, const iterator index) {
+    if (index < begin() || index >= end()) {
+        cout << "Insert failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    checkRoom(1, "Insert");
+    T element(value);
+    constructAt(_size, std::move(*(end() - 1)));
+    for (iterator iter = end() - 1; iter > index; iter--) {
+        *iter = std::move(*(iter - 1));
+    }
+    *index = std::move(element);
+    _size++;
+}
+
+template <typename T, size_t N>
+template <size_t M>
+constexpr StaticVector<T, N>& StaticVector<T, N>::merge(const StaticVector<T, M>& other) {
+    // other may be this vector, so fix the count first
+    const size_t count = other.size();
+    checkRoom(count, "merge");
+    for (size_t i = 0; i < count; i++) {
+        constructAt(_size, other[i]);
+        _size++;
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::swap(const iterator first, const iterator second) {
+    T element = std::move(*first);
+    *first = std::move(*second);
+    *second = std::move(element);
+    return *this;
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::clear() {
+    while (_size > 0) {
+        _size--;
+        destroyAt(_size);
+    }
+    return *this;
+}
+
+// Elements Viewing ––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr T& StaticVector<T, N>::check(const size_t index) {
+    return const_cast<T&>(static_cast<const StaticVector<T, N>*>(this)->check(index));
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticVector<T, N>::check(const size_t index) const {
+    if (index >= _size) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    return data()[index];
+}
+
+template <typename T, size_t N>
+constexpr T& StaticVector<T, N>::front() {
+    return const_cast<T&>(static_cast<const StaticVector<T, N>*>(this)->front());
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticVector<T, N>::front() const {
+    if (empty()) {
+        cout << "front failed\n";
+        BII_THROW(empty_vector());
+    }
+    return data()[0];
+}
+
+template <typename T, size_t N>
+constexpr T& StaticVector<T, N>::back() {
+    return const_cast<T&>(static_cast<const StaticVector<T, N>*>(this)->back());
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticVector<T, N>::back() const {
+    if (empty()) {
+        cout << "back failed\n";
+        BII_THROW(empty_vector());
+    }
+    return data()[_size - 1];
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr T& StaticVector<T, N>::operator[](const size_t index) {
+    return check(index);
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticVector<T, N>::operator[](const size_t index) const {
+    return check(index);
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::operator+=(const T& value) {
+    return addBack(value);
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::operator+=(T&& value) {
+    return addBack(std::move(value));
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N>
+constexpr T* StaticVector<T, N>::begin() {
+    return data();
+}
+
+template <typename T, size_t N>
+constexpr T* StaticVector<T, N>::end() {
+    return data() + _size;
+}
+
+template <typename T, size_t N>
+constexpr const T* StaticVector<T, N>::begin() const {
+    return data();
+}
+
+template <typename T, size_t N>
+constexpr const T* StaticVector<T, N>::end() const {
+    return data() + _size;
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T, size_t N, size_t M>
+constexpr bool operator==(const StaticVector<T, N>& first, const StaticVector<T, M>& second) {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < first.size(); i++) {
+        if (first[i] != second[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, size_t N, size_t M>
+constexpr bool operator!=(const StaticVector<T, N>& first, const StaticVector<T, M>& second) {
+    return !(first == second);
+}
+
+template <typename T, size_t N>
+std::ostream& operator<<(std::ostream& out, const StaticVector<T, N>& vec) {
+    out << '{';
+    for (const T* iter = vec.begin(); iter < vec.end(); iter++) {
+        out << *iter;
+        if (iter + 1 == vec.end()) break;
+        out << ", ";
+    }
+    out << '}' << endl;
+    return out;
+}
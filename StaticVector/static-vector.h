@@ -0,0 +1,381 @@
+/**
+ * Created on October 19, 2026. StaticVector<T, N> is a
+ * fixed-capacity vector that keeps its elements inside the
+ * object itself, for use in projects by BII.
+ *
+ * It mirrors the Vector<T> interface but never touches the
+ * heap: adding past N elements throws full_vector. For
+ * trivial element types (int, double, plain structs) every
+ * member function is constexpr, so lookup tables can be
+ * computed at compile time and embedded in the binary:
+ *
+ *     constexpr StaticVector<int, 4> squares = [] {
+ *         StaticVector<int, 4> table;
+ *         for (int i = 0; i < 4; i++) table.addBack(i * i);
+ *         return table;
+ *     }();
+ *
+ * Under C++20 the table can also be built with a Vector<T>
+ * first and copied into a StaticVector with the range
+ * constructor; the Vector's allocation never outlives the
+ * constant evaluation.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added StaticVector with the capacity, modifier, element
+ * viewing, operator, and iterator functions of Vector.
+ */
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../Vector/vector.h"
+
+/**
+ * Inline storage for StaticVector. Trivial element types are
+ * kept in a plain array so everything stays constexpr; other
+ * types live in raw bytes and are constructed on demand.
+ */
+template <typename T, size_t N, bool Trivial = std::is_trivial<T>::value>
+class staticStorage {
+protected:
+    constexpr staticStorage() : _slots{}, _size(0) { }
+
+    constexpr T* data() { return _slots; }
+    constexpr const T* data() const { return _slots; }
+
+    template <typename... Args>
+    constexpr void constructAt(size_t index, Args&&... args) {
+        _slots[index] = T(std::forward<Args>(args)...);
+    }
+
+    constexpr void destroyAt(size_t) { }
+
+    /* the elements; slots past _size hold stale values */
+    T _slots[N > 0 ? N : 1];
+
+    /* the current number of elements */
+    size_t _size;
+};
+
+template <typename T, size_t N>
+class staticStorage<T, N, false> {
+protected:
+    staticStorage() : _size(0) { }
+
+    staticStorage(const staticStorage& other) : _size(0) {
+        for (; _size < other._size; _size++) {
+            constructAt(_size, other.data()[_size]);
+        }
+    }
+
+    staticStorage(staticStorage&& other) : _size(0) {
+        for (; _size < other._size; _size++) {
+            constructAt(_size, std::move(other.data()[_size]));
+        }
+    }
+
+    staticStorage& operator=(const staticStorage& other) {
+        if (&other == this) return *this;
+        clearAll();
+        for (; _size < other._size; _size++) {
+            constructAt(_size, other.data()[_size]);
+        }
+        return *this;
+    }
+
+    staticStorage& operator=(staticStorage&& other) {
+        if (&other == this) return *this;
+        clearAll();
+        for (; _size < other._size; _size++) {
+            constructAt(_size, std::move(other.data()[_size]));
+        }
+        return *this;
+    }
+
+    ~staticStorage() {
+        clearAll();
+    }
+
+    T* data() { return std::launder(reinterpret_cast<T*>(_bytes)); }
+    const T* data() const { return std::launder(reinterpret_cast<const T*>(_bytes)); }
+
+    template <typename... Args>
+    void constructAt(size_t index, Args&&... args) {
+        ::new (static_cast<void*>(_bytes + index * sizeof(T))) T(std::forward<Args>(args)...);
+    }
+
+    void destroyAt(size_t index) {
+        data()[index].~T();
+    }
+
+    /**
+     * Destroys every element
+     */
+    void clearAll() {
+        while (_size > 0) {
+            _size--;
+            destroyAt(_size);
+        }
+    }
+
+    /* raw room for N elements */
+    alignas(T) unsigned char _bytes[(N > 0 ? N : 1) * sizeof(T)];
+
+    /* the current number of elements */
+    size_t _size;
+};
+
+template <typename T, size_t N>
+class StaticVector : private staticStorage<T, N> {
+public:
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty vector with room for N elements
+     */
+    constexpr StaticVector();
+
+    /**
+     * Fill Constructor
+     * Creates a new vector holding times copies of the given value
+     * Throws an error if times is greater than N
+     */
+    constexpr StaticVector(size_t times, const T& val);
+
+    /**
+     * Member Initializer List Constructor
+     * Creates a new vector with the given elements
+     * Throws an error if there are more than N of them
+     */
+    constexpr StaticVector(std::initializer_list<T> given);
+
+    /**
+     * Range Constructor
+     * Creates a new vector from the elements in [first, last)
+     * Throws an error if there are more than N of them
+     */
+    template <typename Iterator, typename = decltype(*std::declval<Iterator&>(), ++std::declval<Iterator&>())>
+    constexpr StaticVector(Iterator first, Iterator last);
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the size of the vector
+     * O(1) asymptotic complexity
+     */
+    constexpr size_t size() const;
+
+    /**
+     * Returns true if the vector is empty
+     * O(1) asymptotic complexity
+     */
+    constexpr bool empty() const;
+
+    /**
+     * Returns the fixed capacity of the vector, N
+     * O(1) asymptotic complexity
+     */
+    constexpr size_t capacity() const;
+
+    /**
+     * Returns the amount of open space left in the vector
+     * O(1) asymptotic complexity
+     */
+    constexpr size_t open() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Adds an l-value element to the back of the vector
+     * Throws an error if the vector is full
+     * O(1) asymptotic complexity
+     */
+    constexpr StaticVector<T, N>& addBack(const T& value);
+
+    /**
+     * Adds an r-value element to the back of the vector
+     * Throws an error if the vector is full
+     * O(1) asymptotic complexity
+     */
+    constexpr StaticVector<T, N>& addBack(T&& value);
+
+    /**
+     * Returns and removes the last element in the vector
+     * Throws an error if the vector is empty
+     * O(1) asymptotic complexity
+     */
+    constexpr T removeBack();
+
+    /**
+     * Removes the value in the vector at the given index
+     * Throws an error for invalid indexes
+     * O(N) asymptotic complexity
+     */
+    constexpr void remove(const iterator index);
+
+    /**
+     * Inserts a value at a certain index in the vector
+     * Throws an error for invalid indexes or if the vector is full
+     * O(n) runtime speed
+     */
+    constexpr void insert(const T& value, const iterator index);
+
+    /**
+     * Adds the elements of the other vector to the back of this one
+     * Throws an error if they do not fit
+     * O(n) runtime speed where n is the size of the other vector
+     */
+    template <size_t M>
+    constexpr StaticVector<T, N>& merge(const StaticVector<T, M>& other);
+
+    /**
+     * Given two indices, swaps the elements at the given
+     * indices
+     */
+    constexpr StaticVector<T, N>& swap(const iterator first, const iterator second);
+
+    /**
+     * Destroys every element
+     * O(n) asymptotic complexity
+     */
+    constexpr StaticVector<T, N>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a reference to the value at a given index
+     * Throws an error for invalid indexes
+     */
+    constexpr T& check(const size_t index);
+
+    /**
+     * Returns the value at a given index
+     * Throws an error for invalid indexes
+     */
+    constexpr const T& check(const size_t index) const;
+
+    /**
+     * Return a reference to the first element in the vector
+     * Throws an error if the vector is empty
+     * O(1) runtime speed
+     */
+    constexpr T& front();
+
+    /**
+     * Return the value of the first element in the vector
+     * Throws an error if the vector is empty
+     * O(1) runtime speed
+     */
+    constexpr const T& front() const;
+
+    /**
+     * Return a reference to the last element in the vector
+     * Throws an error if the vector is empty
+     * O(1) runtime speed
+     */
+    constexpr T& back();
+
+    /**
+     * Return the value of the last element in the vector
+     * Throws an error if the vector is empty
+     * O(1) runtime speed
+     */
+    constexpr const T& back() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a reference to the value at a given index
+     */
+    constexpr T& operator[](const size_t index);
+
+    /**
+     * Returns a the value at a given index
+     */
+    constexpr const T& operator[](const size_t index) const;
+
+    /**
+     * Adds an lvalue element to the back of the vector
+     * O(1) runtime speed
+     */
+    constexpr StaticVector<T, N>& operator+=(const T& value);
+
+    /**
+     * Adds an rvalue element to the back of the vector
+     * O(1) runtime speed
+     */
+    constexpr StaticVector<T, N>& operator+=(T&& value);
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator with initial position at front of the vector
+     */
+    constexpr iterator begin();
+
+    /**
+     * Iterator with initial position at back of the vector
+     */
+    constexpr iterator end();
+
+    /**
+     * Const iterator with initial position at front of the vector
+     */
+    constexpr const_iterator begin() const;
+
+    /**
+     * Const iterator with initial position at back of the vector
+     */
+    constexpr const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two vectors, returns true if they have the same elements
+     * in the same order
+     * O(n) runtime speed
+     */
+    template <typename T_, size_t N_, size_t M_>
+    friend constexpr bool operator==(const StaticVector<T_, N_>& first, const StaticVector<T_, M_>& second);
+
+    /**
+     * Given two vectors, returns true if they don't have the same elements
+     * in the same order
+     * O(n) runtime speed
+     */
+    template <typename T_, size_t N_, size_t M_>
+    friend constexpr bool operator!=(const StaticVector<T_, N_>& first, const StaticVector<T_, M_>& second);
+
+    /**
+     * Given an output stream and a vector, prints the elements of the vector
+     * to the console
+     * O(n) runtime speed
+     */
+    template <typename T_, size_t N_>
+    friend std::ostream& operator<<(std::ostream& out, const StaticVector<T_, N_>& vec);
+
+private:
+    using base = staticStorage<T, N>;
+    using base::_size;
+    using base::data;
+    using base::constructAt;
+    using base::destroyAt;
+
+    /**
+     * Throws full_vector if count more elements do not fit
+     */
+    constexpr void checkRoom(size_t count, const char* caller) const;
+};
+
+/**
+ * Exception handler for adding to a
+ * full fixed-capacity vector
+ */
+struct full_vector : public std::exception {
+    const char * what () const throw () {
+        return "Trying to add to a full vector";
+    }
+};
+
+#include "static-vector.cpp"
@@ -0,0 +1,255 @@
+/**
+ * Created on October 19, 2026. Testing harness
+ * for the StaticVector<T, N> class.
+ *
+ * Section E checks the compile-time tables with
+ * static_assert, so it only needs to compile; build
+ * with -std=c++20 to include the Vector-built table.
+ */
+#include "static-vector.h"
+#include <iostream>
+#include <string>
+
+using std::cout;
+using std::endl;
+
+// Color definitions
+#define BOLD "\033[1m"
+#define ITALIC "\033[3m"
+#define RESET "\033[0m"
+#define BOLDBLUE "\033[1m\033[34m"
+
+// Test Settings
+const bool section_A = true; // Constructors (4 Methods)
+const bool section_B = true; // Capacity (4 Methods)
+const bool section_C = true; // Modifiers (7 Methods)
+const bool section_D = true; // Element Viewing (4 Methods)
+const bool section_E = true; // Compile-Time Tables
+
+// Fixed capacity used throughout the tests
+const size_t capacity = 4096;
+
+/**
+ * Given two values, returns true if they are equal
+ * as the type of the first
+ */
+template <typename T, typename S>
+bool expectEqual(T first, S second) {
+    return first == static_cast<T>(second);
+}
+
+/**
+ * Prints and counts the outcome of a single test
+ */
+void report(const char* name, bool passed, int& numTestsPassed, int& numTestsFailed) {
+    if (passed) {
+        cout << name << " : PASSED" << endl;
+        numTestsPassed++;
+    } else {
+        cout << name << " : FAILED" << endl;
+        numTestsFailed++;
+    }
+}
+
+/**
+ * Macro for testing StaticVector Constructor methods
+ */
+void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
+    StaticVector<std::string, capacity> fill(size, "Eva");
+    report("Fill Constructor", expectEqual(fill.size(), size) && expectEqual(fill[size / 2], "Eva"),
+           numTestsPassed, numTestsFailed);
+
+    StaticVector<int, capacity> list{1, 2, 3};
+    report("Initializer List Constructor", expectEqual(list.size(), 3) && expectEqual(list.back(), 3),
+           numTestsPassed, numTestsFailed);
+
+    Vector<int> source;
+    for (int i = 0; i < size; i++) {
+        source.addBack(i);
+    }
+    StaticVector<int, capacity> range(source.begin(), source.end());
+    report("Range Constructor", expectEqual(range.size(), size) && expectEqual(range[size - 1], size - 1),
+           numTestsPassed, numTestsFailed);
+
+    StaticVector<std::string, capacity> copy(fill);
+    report("Copy Constructor", copy == fill, numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing StaticVector Capacity methods
+ */
+void testB(const int size, int& numTestsPassed, int& numTestsFailed) {
+    StaticVector<int, capacity> vec;
+    report("Empty", vec.empty(), numTestsPassed, numTestsFailed);
+    for (int i = 0; i < size; i++) {
+        vec.addBack(i);
+    }
+    report("Size", expectEqual(vec.size(), size), numTestsPassed, numTestsFailed);
+    report("Capacity", expectEqual(vec.capacity(), capacity), numTestsPassed, numTestsFailed);
+    report("Open", expectEqual(vec.open(), capacity - size), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing StaticVector Modifier methods
+ */
+void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
+    StaticVector<std::string, capacity> vec;
+    for (int i = 0; i < size; i++) {
+        vec.addBack(std::to_string(i));
+    }
+    report("AddBack", expectEqual(vec[size - 1], std::to_string(size - 1)), numTestsPassed, numTestsFailed);
+
+    vec.insert("front", vec.begin());
+    report("Insert", expectEqual(vec.front(), "front") && expectEqual(vec.size(), size + 1),
+           numTestsPassed, numTestsFailed);
+
+    vec.remove(vec.begin());
+    report("Remove", expectEqual(vec.front(), "0") && expectEqual(vec.size(), size),
+           numTestsPassed, numTestsFailed);
+
+    std::string last = vec.removeBack();
+    report("RemoveBack", expectEqual(last, std::to_string(size - 1)), numTestsPassed, numTestsFailed);
+
+    StaticVector<std::string, capacity> other(1, "merged");
+    vec.merge(other);
+    report("Merge", expectEqual(vec.back(), "merged"), numTestsPassed, numTestsFailed);
+
+    // test adding to a full vector
+    StaticVector<int, 2> full{1, 2};
+    bool threw = false;
+    try {
+        full.addBack(3);
+    } catch (const full_vector&) {
+        threw = true;
+    }
+    report("Full", threw && expectEqual(full.size(), 2), numTestsPassed, numTestsFailed);
+
+    vec.clear();
+    report("Clear", vec.empty(), numTestsPassed, numTestsFailed);
+}
+
+/**
+ * Macro for testing StaticVector Element Viewing methods
+ */
+void testD(const int size, int& numTestsPassed, int& numTestsFailed) {
+    StaticVector<int, capacity> vec;
+    for (int i = 0; i < size; i++) {
+        vec.addBack(i);
+    }
+    vec.check(0) = 20;
+    report("Check", expectEqual(vec.check(0), 20), numTestsPassed, numTestsFailed);
+    report("Front", expectEqual(vec.front(), 20), numTestsPassed, numTestsFailed);
+    report("Back", expectEqual(vec.back(), size - 1), numTestsPassed, numTestsFailed);
+
+    bool threw = false;
+    try {
+        vec.check(size);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    report("Check (out of range)", threw, numTestsPassed, numTestsFailed);
+}
+
+/**
+ * A table of squares built entirely at compile time
+ */
+constexpr StaticVector<int, 16> squares = [] {
+    StaticVector<int, 16> table;
+    for (int i = 0; i < 16; i++) {
+        table.addBack(i * i);
+    }
+    return table;
+}();
+static_assert(squares.size() == 16 && squares[15] == 225, "compile-time StaticVector table");
+
+#ifdef BII_HAS_CONSTEXPR_VECTOR
+/**
+ * A table built with a heap-backed Vector at compile time
+ * and frozen into a StaticVector
+ */
+constexpr StaticVector<int, 16> evens = [] {
+    Vector<int> scratch;
+    for (int i = 0; scratch.size() < 16; i++) {
+        if (i % 2 == 0) {
+            scratch.addBack(i);
+        }
+    }
+    return StaticVector<int, 16>(scratch.begin(), scratch.end());
+}();
+static_assert(evens.back() == 30, "compile-time Vector table");
+#endif
+
+/**
+ * Macro for testing StaticVector Compile-Time Tables
+ */
+void testE(const int /* size */, int& numTestsPassed, int& numTestsFailed) {
+    report("Constexpr StaticVector", expectEqual(squares[4], 16), numTestsPassed, numTestsFailed);
+#ifdef BII_HAS_CONSTEXPR_VECTOR
+    report("Constexpr Vector", expectEqual(evens[3], 6), numTestsPassed, numTestsFailed);
+#else
+    cout << "Constexpr Vector : SKIP (needs C++20)" << endl;
+#endif
+}
+
+/**
+ * Given the desired section and the appropriate information,
+ * performs the tests of that section
+ */
+void doTest(const char section, const bool option, const int size, int& numTestsPassed, int& numTestsFailed, void (*test)(const int, int&, int&)) {
+    cout << BOLD << "–––– Section " << section << " Tests ––––" << RESET << endl;
+    cout << endl;
+    if (option) {
+        (*test)(size, numTestsPassed, numTestsFailed);
+        cout << endl;
+    } else {
+        cout << "SKIP" << endl;
+        cout << endl;
+    }
+}
+
+int main() {
+    cout << BOLD << "Beginning StaticVector Tests..." << RESET << endl;
+    cout << endl;
+
+    cout << BOLD << "Section Key" << RESET << endl;
+    cout << "Section A : Constructors" << endl;
+    cout << "Section B : Capacity" << endl;
+    cout << "Section C : Modifiers" << endl;
+    cout << "Section D : Element Viewing" << endl;
+    cout << "Section E : Compile-Time Tables" << endl;
+    cout << endl;
+
+    // get testSize
+    int testSize = 0;
+    std::string response;
+    cout << "What is the desired test size, at most " << capacity - 1 << " (enter/return for default test size): ";
+    std::getline(std::cin, response);
+    if (response.empty()) {
+        testSize = 1000;
+    } else {
+        testSize = stoi(response);
+    }
+    if (testSize < 2 || testSize >= static_cast<int>(capacity)) {
+        testSize = 1000;
+    }
+    cout << endl;
+
+    // for use in testing
+    int numTestsFailed = 0;
+    int numTestsPassed = 0;
+
+    doTest('A', section_A, testSize, numTestsPassed, numTestsFailed, testA);
+    doTest('B', section_B, testSize, numTestsPassed, numTestsFailed, testB);
+    doTest('C', section_C, testSize, numTestsPassed, numTestsFailed, testC);
+    doTest('D', section_D, testSize, numTestsPassed, numTestsFailed, testD);
+    doTest('E', section_E, testSize, numTestsPassed, numTestsFailed, testE);
+
+    // Inform user as to which tests passed
+    if (!numTestsFailed) {
+        cout << BOLD << "Passed all " << numTestsPassed << " tests!" << RESET << endl;
+    } else {
+        cout << "Passed " << BOLD << numTestsPassed << RESET << " out of " << BOLD << numTestsPassed + numTestsFailed << RESET << " tests." << endl;
+    }
+
+    return 0;
+}
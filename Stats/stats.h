@@ -0,0 +1,220 @@
+/**
+ * Created on October 19, 2026. Stats.h is the
+ * allocation and growth instrumentation shared by
+ * BII containers.
+ *
+ * Instrumentation is off by default. Define BII_STATS
+ * before including a container (or pass -DBII_STATS) to
+ * turn it on; when it is off every hook expands to nothing
+ * and the containers carry no extra members.
+ */
+#pragma once
+#include <cstddef>
+#include <atomic>
+#include <iostream>
+
+#ifdef BII_STATS
+#define BII_STATS_ONLY(...) __VA_ARGS__
+#else
+#define BII_STATS_ONLY(...)
+#endif
+
+/**
+ * Plain counters for a single container or a snapshot
+ * of a global aggregate
+ */
+struct container_stats {
+    /** Number of times the underlying storage was regrown */
+    size_t expandCalls = 0;
+    /** Total bytes requested from the allocator */
+    size_t bytesAllocated = 0;
+    /** Elements copied between buffers */
+    size_t elementsCopied = 0;
+    /** Elements moved between buffers */
+    size_t elementsMoved = 0;
+    /** Largest capacity (or node count) ever reached */
+    size_t peakCapacity = 0;
+    /** Number of individual node allocations */
+    size_t nodeAllocations = 0;
+
+    /**
+     * Prints the counters under the given label
+     */
+    void dump(std::ostream& out, const char* label) const {
+        out << label << " stats:" << '\n'
+            << "  expand calls     : " << expandCalls << '\n'
+            << "  bytes allocated  : " << bytesAllocated << '\n'
+            << "  elements copied  : " << elementsCopied << '\n'
+            << "  elements moved   : " << elementsMoved << '\n'
+            << "  peak capacity    : " << peakCapacity << '\n'
+            << "  node allocations : " << nodeAllocations << '\n';
+    }
+};
+
+/**
+ * Counters of a thread's buffer cache (see Vector/buffer-cache.h)
+ */
+struct cache_stats {
+    /** Allocations served from the cache */
+    size_t hits = 0;
+    /** Allocations that went to the system */
+    size_t misses = 0;
+    /** Released buffers kept for reuse */
+    size_t kept = 0;
+    /** Released buffers freed because the cache was full */
+    size_t released = 0;
+    /** Cached bytes given back to the system by trimming */
+    size_t trimmedBytes = 0;
+
+    /**
+     * Returns the fraction of allocations served from the cache
+     */
+    double hitRate() const {
+        size_t requests = hits + misses;
+        return requests == 0 ? 0.0 : static_cast<double>(hits) / requests;
+    }
+
+    /**
+     * Prints the counters under the given label
+     */
+    void dump(std::ostream& out, const char* label) const {
+        out << label << " cache stats:" << '\n'
+            << "  hits             : " << hits << '\n'
+            << "  misses           : " << misses << '\n'
+            << "  hit rate         : " << hitRate() << '\n'
+            << "  buffers kept     : " << kept << '\n'
+            << "  buffers released : " << released << '\n'
+            << "  bytes trimmed    : " << trimmedBytes << '\n';
+    }
+};
+
+/**
+ * Process-wide aggregate of container_stats. Updated with
+ * relaxed atomics so containers on different threads can
+ * report into the same aggregate.
+ */
+struct global_stats {
+    std::atomic<size_t> expandCalls{0};
+    std::atomic<size_t> bytesAllocated{0};
+    std::atomic<size_t> elementsCopied{0};
+    std::atomic<size_t> elementsMoved{0};
+    std::atomic<size_t> peakCapacity{0};
+    std::atomic<size_t> nodeAllocations{0};
+
+    /**
+     * Returns a copy of the current counters
+     */
+    container_stats snapshot() const {
+        container_stats stats;
+        stats.expandCalls = expandCalls.load(std::memory_order_relaxed);
+        stats.bytesAllocated = bytesAllocated.load(std::memory_order_relaxed);
+        stats.elementsCopied = elementsCopied.load(std::memory_order_relaxed);
+        stats.elementsMoved = elementsMoved.load(std::memory_order_relaxed);
+        stats.peakCapacity = peakCapacity.load(std::memory_order_relaxed);
+        stats.nodeAllocations = nodeAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /**
+     * Sets every counter back to zero
+     */
+    void reset() {
+        expandCalls.store(0, std::memory_order_relaxed);
+        bytesAllocated.store(0, std::memory_order_relaxed);
+        elementsCopied.store(0, std::memory_order_relaxed);
+        elementsMoved.store(0, std::memory_order_relaxed);
+        peakCapacity.store(0, std::memory_order_relaxed);
+        nodeAllocations.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Prints a snapshot of the counters under the given label
+     */
+    void dump(std::ostream& out, const char* label) const {
+        snapshot().dump(out, label);
+    }
+};
+
+/**
+ * Per-instance counters that also report every event
+ * into a global aggregate. Containers hold one of these
+ * only when BII_STATS is defined.
+ */
+class stats_recorder {
+public:
+    explicit stats_recorder(global_stats& global) : _global(&global) { }
+
+    /** A copied container starts with fresh counters */
+    stats_recorder(const stats_recorder& other) : _global(other._global) { }
+    stats_recorder& operator=(const stats_recorder&) { return *this; }
+
+    /**
+     * Records a fresh buffer of the given byte size
+     * and capacity
+     */
+    void allocate(size_t bytes, size_t capacity) {
+        _local.bytesAllocated += bytes;
+        _global->bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+        peak(capacity);
+    }
+
+    /**
+     * Records a regrowth of the storage into a buffer
+     * of the given byte size and capacity
+     */
+    void expand(size_t bytes, size_t capacity) {
+        _local.expandCalls++;
+        _global->expandCalls.fetch_add(1, std::memory_order_relaxed);
+        allocate(bytes, capacity);
+    }
+
+    /**
+     * Records the given number of element copies
+     */
+    void copied(size_t count) {
+        _local.elementsCopied += count;
+        _global->elementsCopied.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * Records the given number of element moves
+     */
+    void moved(size_t count) {
+        _local.elementsMoved += count;
+        _global->elementsMoved.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * Records a single node allocation of the given byte
+     * size, with count nodes now live
+     */
+    void node(size_t bytes, size_t count) {
+        _local.nodeAllocations++;
+        _global->nodeAllocations.fetch_add(1, std::memory_order_relaxed);
+        allocate(bytes, count);
+    }
+
+    /**
+     * Returns the counters of this instance alone
+     */
+    const container_stats& local() const { return _local; }
+
+private:
+    /* counters for this instance */
+    container_stats _local;
+
+    /* the aggregate every event is also reported into */
+    global_stats* _global;
+
+    /**
+     * Raises the local and global peak capacity if needed
+     */
+    void peak(size_t capacity) {
+        if (capacity > _local.peakCapacity) {
+            _local.peakCapacity = capacity;
+        }
+        size_t seen = _global->peakCapacity.load(std::memory_order_relaxed);
+        while (capacity > seen &&
+               !_global->peakCapacity.compare_exchange_weak(seen, capacity, std::memory_order_relaxed)) { }
+    }
+};
@@ -0,0 +1,251 @@
+/**
+ * Created on October 19, 2026. bufferCache keeps the buffers
+ * that BII's contiguous containers release on each thread, sorted
+ * into size classes, and hands them back out to the next container
+ * that asks for the same class, so short-lived vectors of similar
+ * capacities stop round-tripping through malloc.
+ *
+ * The cache is off by default. Define BII_BUFFER_CACHE before
+ * including a container (or pass -DBII_BUFFER_CACHE) and every
+ * Storage<T> allocation goes through it; without it this header
+ * declares nothing.
+ *
+ * Size classes are spaced four to a doubling, so a buffer is at
+ * most 25% larger than asked for. Buffers past largestBytes, and
+ * types aligned beyond what operator new guarantees, bypass the
+ * cache. Each thread keeps at most limit() bytes (defaultLimit
+ * unless changed); a buffer released past that goes straight back
+ * to the system, as does everything cached when the thread exits,
+ * when trim is called, and when an allocation fails.
+ *
+ * Buffers are plain operator new memory, so one thread may free
+ * what another allocated; it lands in the freeing thread's cache.
+ */
+#pragma once
+#ifdef BII_BUFFER_CACHE
+#include <cstddef>
+#include <new>
+#include "../Stats/stats.h"
+
+class bufferCache {
+public:
+    /** The largest buffer, in bytes, that is cached */
+    static constexpr size_t largestBytes = size_t(1) << 20;
+
+    /** The bytes each thread may hold before releasing to the system */
+    static constexpr size_t defaultLimit = size_t(4) << 20;
+
+    /**
+     * Returns a buffer of at least the given number of bytes,
+     * reusing a cached one of the same size class if there is one
+     */
+    static void* allocate(size_t bytes) {
+        if (bytes > largestBytes) {
+            return ::operator new(bytes);
+        }
+        size_t sizeClass = classOf(bytes);
+        bufferCache* cache = local();
+        if (cache == nullptr) {
+            return ::operator new(bytesOf(sizeClass));
+        }
+        return cache->take(sizeClass);
+    }
+
+    /**
+     * Takes back a buffer from allocate, given the same byte count
+     */
+    static void deallocate(void* buffer, size_t bytes) {
+        bufferCache* cache = bytes > largestBytes ? nullptr : local();
+        if (cache == nullptr) {
+            ::operator delete(buffer);
+            return;
+        }
+        cache->keep(buffer, classOf(bytes));
+    }
+
+    /**
+     * Returns every buffer cached by this thread to the system
+     */
+    static void trim() {
+        if (bufferCache* cache = local()) {
+            cache->releaseAll();
+        }
+    }
+
+    /**
+     * Returns the bytes this thread may cache
+     */
+    static size_t limit() {
+        bufferCache* cache = local();
+        return cache == nullptr ? 0 : cache->_limit;
+    }
+
+    /**
+     * Sets the bytes this thread may cache, trimming if it
+     * already holds more; 0 turns caching off
+     */
+    static void limit(size_t bytes) {
+        if (bufferCache* cache = local()) {
+            cache->_limit = bytes;
+            if (cache->_cachedBytes > bytes) {
+                cache->releaseAll();
+            }
+        }
+    }
+
+    /**
+     * Returns the bytes this thread holds in its cache
+     */
+    static size_t cachedBytes() {
+        bufferCache* cache = local();
+        return cache == nullptr ? 0 : cache->_cachedBytes;
+    }
+
+    /**
+     * Returns this thread's hit and release counters
+     */
+    static cache_stats stats() {
+        bufferCache* cache = local();
+        return cache == nullptr ? cache_stats() : cache->_stats;
+    }
+
+    /**
+     * Sets this thread's counters back to zero
+     */
+    static void resetStats() {
+        if (bufferCache* cache = local()) {
+            cache->_stats = cache_stats();
+        }
+    }
+
+    bufferCache(const bufferCache&) = delete;
+    bufferCache& operator=(const bufferCache&) = delete;
+
+private:
+    /** Classes per doubling of the buffer size */
+    static constexpr size_t classesPerDoubling = 4;
+
+    /** Every buffer up to this size shares the smallest class */
+    static constexpr size_t smallestBytes = 16;
+
+    /** One class for the smallest buffers, then four per doubling up to largestBytes */
+    static constexpr size_t classCount = 65;
+
+    /** A cached buffer, linked through its own first bytes */
+    struct freeBuffer {
+        freeBuffer* next;
+    };
+
+    /* the cached buffers of each class */
+    freeBuffer* _lists[classCount] = {};
+
+    /* the bytes held across every list */
+    size_t _cachedBytes = 0;
+
+    /* the bytes the lists may hold */
+    size_t _limit = defaultLimit;
+
+    /* hit and release counters */
+    cache_stats _stats;
+
+    /* set once this thread's cache is destroyed, so late frees bypass it */
+    static inline thread_local bool _retired = false;
+
+    bufferCache() = default;
+
+    ~bufferCache() {
+        releaseAll();
+        _retired = true;
+    }
+
+    /**
+     * Returns this thread's cache, or nullptr once it has
+     * been destroyed at thread exit
+     */
+    static bufferCache* local() {
+        if (_retired) {
+            return nullptr;
+        }
+        thread_local bufferCache cache;
+        return &cache;
+    }
+
+    /**
+     * Returns the size class holding buffers of the given byte count
+     */
+    static size_t classOf(size_t bytes) {
+        if (bytes <= smallestBytes) {
+            return 0;
+        }
+        // the top three bits of bytes - 1 pick the doubling and the quarter
+        size_t rest = bytes - 1;
+        size_t doubling = 63 - static_cast<size_t>(__builtin_clzll(rest));
+        size_t quarter = (rest >> (doubling - 2)) & (classesPerDoubling - 1);
+        return (doubling - 4) * classesPerDoubling + quarter + 1;
+    }
+
+    /**
+     * Returns the byte size of every buffer in the given class
+     */
+    static size_t bytesOf(size_t sizeClass) {
+        if (sizeClass == 0) {
+            return smallestBytes;
+        }
+        size_t doubling = (sizeClass - 1) / classesPerDoubling + 4;
+        size_t quarter = (sizeClass - 1) % classesPerDoubling;
+        return (classesPerDoubling + quarter + 1) << (doubling - 2);
+    }
+
+    /**
+     * Pops a buffer of the given class, or allocates one
+     */
+    void* take(size_t sizeClass) {
+        if (freeBuffer* buffer = _lists[sizeClass]) {
+            _lists[sizeClass] = buffer->next;
+            _cachedBytes -= bytesOf(sizeClass);
+            _stats.hits++;
+            return buffer;
+        }
+        _stats.misses++;
+        void* buffer = ::operator new(bytesOf(sizeClass), std::nothrow);
+        if (buffer == nullptr) {
+            // the system is short of memory; give back what we hold first
+            releaseAll();
+            buffer = ::operator new(bytesOf(sizeClass));
+        }
+        return buffer;
+    }
+
+    /**
+     * Pushes a buffer onto its class list, or frees it
+     * if the cache is full
+     */
+    void keep(void* buffer, size_t sizeClass) {
+        size_t bytes = bytesOf(sizeClass);
+        if (_cachedBytes + bytes > _limit) {
+            _stats.released++;
+            ::operator delete(buffer);
+            return;
+        }
+        _stats.kept++;
+        freeBuffer* node = static_cast<freeBuffer*>(buffer);
+        node->next = _lists[sizeClass];
+        _lists[sizeClass] = node;
+        _cachedBytes += bytes;
+    }
+
+    /**
+     * Frees every cached buffer
+     */
+    void releaseAll() {
+        for (size_t sizeClass = 0; sizeClass < classCount; sizeClass++) {
+            while (freeBuffer* buffer = _lists[sizeClass]) {
+                _lists[sizeClass] = buffer->next;
+                ::operator delete(buffer);
+            }
+        }
+        _stats.trimmedBytes += _cachedBytes;
+        _cachedBytes = 0;
+    }
+};
+#endif
@@ -0,0 +1,711 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the immutable-vector.h class
+ */
+#pragma once
+#include "immutable-vector.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+uint64_t ImmutableVector<T>::freshOwner() {
+    return _owners.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+template <typename T>
+typename ImmutableVector<T>::treeNode* ImmutableVector<T>::retain(treeNode* node) {
+    if (node != nullptr) {
+        node->references.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+template <typename T>
+void ImmutableVector<T>::release(treeNode* node, unsigned shift) {
+    if (node == nullptr || node->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    if (shift == 0) {
+        delete static_cast<leafNode*>(node);
+        return;
+    }
+    // the tree is at most a dozen levels deep, so recursion is safe here
+    branchNode* branch = static_cast<branchNode*>(node);
+    for (size_t k = 0; k < branch->count; k++) {
+        release(branch->children[k], shift - bits);
+    }
+    delete branch;
+}
+
+template <typename T>
+inline size_t ImmutableVector<T>::sizeOf(const treeNode* node, unsigned shift) {
+    return shift == 0 ? node->count : static_cast<const branchNode*>(node)->sizes[node->count - 1];
+}
+
+template <typename T>
+inline size_t ImmutableVector<T>::childFor(const branchNode* branch, unsigned shift, size_t& index) {
+    // no child holds more than 1 << shift elements, so the radix guess is never too far right
+    size_t k = index >> shift;
+    if (branch->relaxed) {
+        while (branch->sizes[k] <= index) {
+            k++;
+        }
+        if (k != 0) {
+            index -= branch->sizes[k - 1];
+        }
+    } else {
+        index -= k << shift;
+    }
+    return k;
+}
+
+template <typename T>
+const typename ImmutableVector<T>::leafNode* ImmutableVector<T>::leafAt(const treeNode* root, unsigned shift,
+                                                                        size_t index, size_t& start) {
+    start = 0;
+    const treeNode* node = root;
+    for (; shift > 0; shift -= bits) {
+        size_t before = index;
+        const branchNode* branch = static_cast<const branchNode*>(node);
+        node = branch->children[childFor(branch, shift, index)];
+        start += before - index;
+    }
+    return static_cast<const leafNode*>(node);
+}
+
+template <typename T>
+void ImmutableVector<T>::refresh(branchNode* branch, unsigned shift) {
+    const size_t full = size_t(1) << shift;
+    size_t total = 0;
+    bool relaxed = false;
+    for (size_t k = 0; k < branch->count; k++) {
+        size_t size = sizeOf(branch->children[k], shift - bits);
+        total += size;
+        branch->sizes[k] = total;
+        relaxed = relaxed || (k + 1 < branch->count && size != full);
+    }
+    branch->relaxed = relaxed;
+}
+
+template <typename T>
+typename ImmutableVector<T>::treeNode* ImmutableVector<T>::editable(treeNode* node, unsigned shift, uint64_t owner) {
+    if (owner != 0 && node->owner == owner) {
+        return node;
+    }
+    treeNode* copy;
+    if (shift == 0) {
+        const leafNode* leaf = static_cast<const leafNode*>(node);
+        leafNode* fresh = new leafNode(owner);
+        BII_TRY {
+            for (; fresh->count < leaf->count; fresh->count++) {
+                Storage<T>::construct(fresh->elements() + fresh->count, leaf->elements()[fresh->count]);
+            }
+        } BII_CATCH_ALL {
+            delete fresh;
+            BII_RETHROW;
+        }
+        copy = fresh;
+    } else {
+        const branchNode* branch = static_cast<const branchNode*>(node);
+        branchNode* fresh = new branchNode(owner);
+        for (size_t k = 0; k < branch->count; k++) {
+            fresh->children[k] = retain(branch->children[k]);
+            fresh->sizes[k] = branch->sizes[k];
+        }
+        fresh->count = branch->count;
+        fresh->relaxed = branch->relaxed;
+        copy = fresh;
+    }
+    release(node, shift);
+    return copy;
+}
+
+template <typename T>
+template <typename Value>
+typename ImmutableVector<T>::treeNode* ImmutableVector<T>::newPath(unsigned shift, uint64_t owner, Value&& element) {
+    leafNode* leaf = new leafNode(owner);
+    BII_TRY {
+        Storage<T>::construct(leaf->elements(), std::forward<Value>(element));
+    } BII_CATCH_ALL {
+        delete leaf;
+        BII_RETHROW;
+    }
+    leaf->count = 1;
+    treeNode* node = leaf;
+    unsigned level = 0;
+    BII_TRY {
+        for (; level < shift; level += bits) {
+            branchNode* branch = new branchNode(owner);
+            branch->children[0] = node;
+            branch->sizes[0] = 1;
+            branch->count = 1;
+            node = branch;
+        }
+    } BII_CATCH_ALL {
+        release(node, level);
+        BII_RETHROW;
+    }
+    return node;
+}
+
+template <typename T>
+template <typename Value>
+void ImmutableVector<T>::append(treeNode*& root, unsigned& shift, size_t& size, uint64_t owner, Value&& element) {
+    if (root == nullptr) {
+        root = newPath(0, owner, std::forward<Value>(element));
+        shift = 0;
+        size = 1;
+        return;
+    }
+    // find the lowest node on the right edge with room for one more
+    bool room = false;
+    unsigned target = 0;
+    const treeNode* node = root;
+    for (unsigned level = shift;; level -= bits) {
+        if (node->count < branching) {
+            room = true;
+            target = level;
+        }
+        if (level == 0) break;
+        const branchNode* branch = static_cast<const branchNode*>(node);
+        node = branch->children[branch->count - 1];
+    }
+    if (!room) {
+        // the tree is full: the old root becomes the left child of a new one
+        treeNode* path = newPath(shift, owner, std::forward<Value>(element));
+        branchNode* top = nullptr;
+        BII_TRY {
+            top = new branchNode(owner);
+        } BII_CATCH_ALL {
+            release(path, shift);
+            BII_RETHROW;
+        }
+        top->children[0] = root;
+        top->children[1] = path;
+        top->count = 2;
+        refresh(top, shift + bits);
+        root = top;
+        shift += bits;
+        size++;
+        return;
+    }
+    // copy (or claim) the right edge down to the target, then add there
+    branchNode* edge[maxShift / bits + 1];
+    size_t depth = 0;
+    treeNode** slot = &root;
+    for (unsigned level = shift;; level -= bits) {
+        *slot = editable(*slot, level, owner);
+        if (level == target) break;
+        branchNode* branch = static_cast<branchNode*>(*slot);
+        edge[depth++] = branch;
+        slot = &branch->children[branch->count - 1];
+    }
+    if (target == 0) {
+        leafNode* leaf = static_cast<leafNode*>(*slot);
+        Storage<T>::construct(leaf->elements() + leaf->count, std::forward<Value>(element));
+        leaf->count++;
+    } else {
+        branchNode* branch = static_cast<branchNode*>(*slot);
+        branch->children[branch->count] = newPath(target - bits, owner, std::forward<Value>(element));
+        // the old last child stops being last, so it must now be full for the radix lookup
+        size_t before = branch->sizes[branch->count - 1];
+        size_t previous = branch->count == 1 ? before : before - branch->sizes[branch->count - 2];
+        branch->relaxed = branch->relaxed || previous != (size_t(1) << target);
+        branch->sizes[branch->count++] = before + 1;
+    }
+    // every branch above the target gained one element in its last child
+    for (size_t level = 0; level < depth; level++) {
+        edge[level]->sizes[edge[level]->count - 1]++;
+    }
+    size++;
+}
+
+template <typename T>
+void ImmutableVector<T>::assign(treeNode*& root, unsigned shift, size_t index, uint64_t owner, const T& element) {
+    treeNode** slot = &root;
+    for (unsigned level = shift;; level -= bits) {
+        *slot = editable(*slot, level, owner);
+        if (level == 0) break;
+        branchNode* branch = static_cast<branchNode*>(*slot);
+        slot = &branch->children[childFor(branch, level, index)];
+    }
+    static_cast<leafNode*>(*slot)->elements()[index] = element;
+}
+
+template <typename T>
+typename ImmutableVector<T>::seamNodes ImmutableVector<T>::join(treeNode* left, unsigned leftShift,
+                                                                treeNode* right, unsigned rightShift) {
+    const branchNode* leftBranch = leftShift == 0 ? nullptr : static_cast<const branchNode*>(left);
+    const branchNode* rightBranch = rightShift == 0 ? nullptr : static_cast<const branchNode*>(right);
+    if (leftShift > rightShift) {
+        seamNodes seam = join(leftBranch->children[leftBranch->count - 1], leftShift - bits, right, rightShift);
+        return pack(leftBranch, seam, nullptr, leftShift);
+    }
+    if (leftShift < rightShift) {
+        seamNodes seam = join(left, leftShift, rightBranch->children[0], rightShift - bits);
+        return pack(nullptr, seam, rightBranch, rightShift);
+    }
+    if (leftShift > 0) {
+        seamNodes seam = join(leftBranch->children[leftBranch->count - 1], leftShift - bits,
+                              rightBranch->children[0], rightShift - bits);
+        return pack(leftBranch, seam, rightBranch, leftShift);
+    }
+    seamNodes seam = {{nullptr, nullptr}, 0, 0};
+    const leafNode* leftLeaf = static_cast<const leafNode*>(left);
+    const leafNode* rightLeaf = static_cast<const leafNode*>(right);
+    if (leftLeaf->count + rightLeaf->count > branching) {
+        // too many for one leaf; both are shared as they are
+        seam.nodes[0] = retain(left);
+        seam.nodes[1] = retain(right);
+        seam.count = 2;
+        return seam;
+    }
+    leafNode* merged = new leafNode(0);
+    BII_TRY {
+        for (size_t i = 0; i < leftLeaf->count; i++, merged->count++) {
+            Storage<T>::construct(merged->elements() + merged->count, leftLeaf->elements()[i]);
+        }
+        for (size_t i = 0; i < rightLeaf->count; i++, merged->count++) {
+            Storage<T>::construct(merged->elements() + merged->count, rightLeaf->elements()[i]);
+        }
+    } BII_CATCH_ALL {
+        delete merged;
+        BII_RETHROW;
+    }
+    seam.nodes[0] = merged;
+    seam.count = 1;
+    return seam;
+}
+
+template <typename T>
+typename ImmutableVector<T>::treeNode* ImmutableVector<T>::gather(treeNode* const* nodes, size_t& from, size_t& offset,
+                                                                 size_t count, unsigned shift) {
+    if (shift == 0) {
+        leafNode* leaf = new leafNode(0);
+        BII_TRY {
+            for (; leaf->count < count; leaf->count++) {
+                const leafNode* source = static_cast<const leafNode*>(nodes[from]);
+                Storage<T>::construct(leaf->elements() + leaf->count, source->elements()[offset]);
+                if (++offset == source->count) {
+                    from++;
+                    offset = 0;
+                }
+            }
+        } BII_CATCH_ALL {
+            delete leaf;
+            BII_RETHROW;
+        }
+        return leaf;
+    }
+    branchNode* branch = new branchNode(0);
+    while (branch->count < count) {
+        const branchNode* source = static_cast<const branchNode*>(nodes[from]);
+        branch->children[branch->count++] = retain(source->children[offset]);
+        if (++offset == source->count) {
+            from++;
+            offset = 0;
+        }
+    }
+    refresh(branch, shift);
+    return branch;
+}
+
+template <typename T>
+typename ImmutableVector<T>::seamNodes ImmutableVector<T>::pack(const branchNode* left, seamNodes seam,
+                                                                const branchNode* right, unsigned shift) {
+    seamNodes packed = {{nullptr, nullptr}, 0, shift};
+    BII_TRY {
+        packed.nodes[0] = new branchNode(0);
+        packed.nodes[1] = new branchNode(0);
+    } BII_CATCH_ALL {
+        delete static_cast<branchNode*>(packed.nodes[0]);
+        for (size_t k = 0; k < seam.count; k++) {
+            release(seam.nodes[k], shift - bits);
+        }
+        BII_RETHROW;
+    }
+    // at most 31 + 2 + 31 children; the seam nodes are handed over, everything else is shared
+    treeNode* children[2 * branching];
+    size_t count = 0;
+    for (size_t k = 0; left != nullptr && k + 1 < left->count; k++) {
+        children[count++] = retain(left->children[k]);
+    }
+    for (size_t k = 0; k < seam.count; k++) {
+        children[count++] = seam.nodes[k];
+    }
+    for (size_t k = 1; right != nullptr && k < right->count; k++) {
+        children[count++] = retain(right->children[k]);
+    }
+
+    // plan how many elements or grandchildren each child gets: while there are more than
+    // extras children past the fewest that could hold them, the first one that is not full
+    // is spread over its right neighbors
+    size_t plan[2 * branching];
+    size_t total = 0;
+    for (size_t k = 0; k < count; k++) {
+        plan[k] = children[k]->count;
+        total += plan[k];
+    }
+    size_t length = count;
+    const size_t fewest = (total + branching - 1) / branching;
+    for (size_t i = 0; length > fewest + extras; i--) {
+        while (plan[i] == branching) {
+            i++;
+        }
+        size_t remaining = plan[i];
+        do {
+            size_t filled = std::min(remaining + plan[i + 1], branching);
+            remaining = remaining + plan[i + 1] - filled;
+            plan[i++] = filled;
+        } while (remaining > 0);
+        for (size_t j = i; j + 1 < length; j++) {
+            plan[j] = plan[j + 1];
+        }
+        length--;
+    }
+
+    // build the planned children, sharing any that keep their contents
+    treeNode* planned[2 * branching];
+    size_t made = 0;
+    BII_TRY {
+        size_t from = 0;
+        size_t offset = 0;
+        for (; made < length; made++) {
+            planned[made] = offset == 0 && children[from]->count == plan[made]
+                ? retain(children[from++]) : gather(children, from, offset, plan[made], shift - bits);
+        }
+    } BII_CATCH_ALL {
+        for (size_t k = 0; k < made; k++) {
+            release(planned[k], shift - bits);
+        }
+        for (size_t k = 0; k < count; k++) {
+            release(children[k], shift - bits);
+        }
+        delete static_cast<branchNode*>(packed.nodes[0]);
+        delete static_cast<branchNode*>(packed.nodes[1]);
+        BII_RETHROW;
+    }
+    for (size_t k = 0; k < count; k++) {
+        release(children[k], shift - bits);
+    }
+
+    // split evenly, so neither branch starts out nearly empty
+    packed.count = length > branching ? 2 : 1;
+    size_t first = packed.count == 2 ? (length + 1) / 2 : length;
+    for (size_t k = 0; k < length; k++) {
+        branchNode* branch = static_cast<branchNode*>(packed.nodes[k < first ? 0 : 1]);
+        branch->children[branch->count++] = planned[k];
+    }
+    if (packed.count == 1) {
+        delete static_cast<branchNode*>(packed.nodes[1]);
+        packed.nodes[1] = nullptr;
+    }
+    for (size_t n = 0; n < packed.count; n++) {
+        refresh(static_cast<branchNode*>(packed.nodes[n]), shift);
+    }
+    return packed;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+ImmutableVector<T>::ImmutableVector() :
+    _root(nullptr), _shift(0), _size(0) { }
+
+template <typename T>
+ImmutableVector<T>::ImmutableVector(treeNode* root, unsigned shift, size_t size) :
+    _root(root), _shift(shift), _size(size) { }
+
+template <typename T>
+ImmutableVector<T>::ImmutableVector(const Vector<T>& elements) :
+    _root(nullptr), _shift(0), _size(0) {
+    transientVector draft;
+    for (const T& element : elements) {
+        draft.addBack(element);
+    }
+    *this = draft.persistent();
+}
+
+template <typename T>
+ImmutableVector<T>::ImmutableVector(const ImmutableVector& other) :
+    _root(retain(other._root)), _shift(other._shift), _size(other._size) { }
+
+template <typename T>
+ImmutableVector<T>::ImmutableVector(ImmutableVector&& other) :
+    _root(other._root), _shift(other._shift), _size(other._size) {
+    other._root = nullptr;
+    other._shift = 0;
+    other._size = 0;
+}
+
+template <typename T>
+ImmutableVector<T>::~ImmutableVector() {
+    release(_root, _shift);
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t ImmutableVector<T>::size() const {
+    return _size;
+}
+
+template <typename T>
+inline bool ImmutableVector<T>::empty() const {
+    return _size == 0;
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+ImmutableVector<T> ImmutableVector<T>::addBack(const T& element) const {
+    ImmutableVector next(*this);
+    append(next._root, next._shift, next._size, 0, element);
+    return next;
+}
+
+template <typename T>
+ImmutableVector<T> ImmutableVector<T>::addBack(T&& element) const {
+    ImmutableVector next(*this);
+    append(next._root, next._shift, next._size, 0, std::move(element));
+    return next;
+}
+
+template <typename T>
+ImmutableVector<T> ImmutableVector<T>::set(size_t index, const T& element) const {
+    if (index >= _size) {
+        cout << "set failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    ImmutableVector next(*this);
+    assign(next._root, next._shift, index, 0, element);
+    return next;
+}
+
+template <typename T>
+ImmutableVector<T> ImmutableVector<T>::concat(const ImmutableVector& other) const {
+    if (other.empty()) {
+        return *this;
+    }
+    if (empty()) {
+        return other;
+    }
+    seamNodes top = join(_root, _shift, other._root, other._shift);
+    ImmutableVector joined(top.nodes[0], top.shift, _size + other._size);
+    if (top.count == 2) {
+        branchNode* root = nullptr;
+        BII_TRY {
+            root = new branchNode(0);
+        } BII_CATCH_ALL {
+            release(top.nodes[1], top.shift);
+            BII_RETHROW;
+        }
+        root->children[0] = top.nodes[0];
+        root->children[1] = top.nodes[1];
+        root->count = 2;
+        refresh(root, top.shift + bits);
+        joined._root = root;
+        joined._shift = top.shift + bits;
+    }
+    // a root with one child is just a taller path to that child
+    while (joined._shift > 0 && joined._root->count == 1) {
+        treeNode* child = retain(static_cast<branchNode*>(joined._root)->children[0]);
+        release(joined._root, joined._shift);
+        joined._root = child;
+        joined._shift -= bits;
+    }
+    if (joined._shift > maxShift) {
+        cout << "concat failed\n";
+        BII_THROW(std::length_error("Concatenation too deep for one immutable vector"));
+    }
+    return joined;
+}
+
+template <typename T>
+typename ImmutableVector<T>::transientVector ImmutableVector<T>::transient() const {
+    return transientVector(retain(_root), _shift, _size);
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+const T& ImmutableVector<T>::check(size_t index) const {
+    if (index >= _size) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    size_t start = 0;
+    return leafAt(_root, _shift, index, start)->elements()[index - start];
+}
+
+template <typename T>
+const T* ImmutableVector<T>::tryAt(size_t index) const {
+    if (index >= _size) {
+        return nullptr;
+    }
+    size_t start = 0;
+    return leafAt(_root, _shift, index, start)->elements() + (index - start);
+}
+
+template <typename T>
+const T& ImmutableVector<T>::front() const {
+    if (empty()) {
+        cout << "front failed\n";
+        BII_THROW(empty_vector());
+    }
+    return check(0);
+}
+
+template <typename T>
+const T& ImmutableVector<T>::back() const {
+    if (empty()) {
+        cout << "back failed\n";
+        BII_THROW(empty_vector());
+    }
+    return check(_size - 1);
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+const T& ImmutableVector<T>::operator[](size_t index) const {
+    return check(index);
+}
+
+template <typename T>
+ImmutableVector<T>& ImmutableVector<T>::operator=(const ImmutableVector& assign) {
+    // retain first, in case assign shares this version's nodes
+    treeNode* root = retain(assign._root);
+    release(_root, _shift);
+    _root = root;
+    _shift = assign._shift;
+    _size = assign._size;
+    return *this;
+}
+
+template <typename T>
+ImmutableVector<T>& ImmutableVector<T>::operator=(ImmutableVector&& assign) {
+    if (&assign == this) return *this;
+    release(_root, _shift);
+    _root = assign._root;
+    _shift = assign._shift;
+    _size = assign._size;
+    assign._root = nullptr;
+    assign._shift = 0;
+    assign._size = 0;
+    return *this;
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename ImmutableVector<T>::const_iterator ImmutableVector<T>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template <typename T>
+typename ImmutableVector<T>::const_iterator ImmutableVector<T>::end() const {
+    return const_iterator(this, _size);
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T_>
+ImmutableVector<T_> operator+(const ImmutableVector<T_>& first, const ImmutableVector<T_>& second) {
+    return first.concat(second);
+}
+
+template <typename T_>
+bool operator==(const ImmutableVector<T_>& first, const ImmutableVector<T_>& second) {
+    if (first._size != second._size) {
+        return false;
+    }
+    if (first._root == second._root) {
+        return true;
+    }
+    auto left = first.begin();
+    auto right = second.begin();
+    for (; left != first.end(); ++left, ++right) {
+        if (!(*left == *right)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T_>
+bool operator!=(const ImmutableVector<T_>& first, const ImmutableVector<T_>& second) {
+    return !(first == second);
+}
+
+// Transient –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+ImmutableVector<T>::transientVector::transientVector() :
+    _root(nullptr), _shift(0), _size(0), _owner(freshOwner()) { }
+
+template <typename T>
+ImmutableVector<T>::transientVector::transientVector(treeNode* root, unsigned shift, size_t size) :
+    _root(root), _shift(shift), _size(size), _owner(freshOwner()) { }
+
+template <typename T>
+ImmutableVector<T>::transientVector::transientVector(transientVector&& other) :
+    _root(other._root), _shift(other._shift), _size(other._size), _owner(other._owner) {
+    other._root = nullptr;
+    other._shift = 0;
+    other._size = 0;
+}
+
+template <typename T>
+ImmutableVector<T>::transientVector::~transientVector() {
+    release(_root, _shift);
+}
+
+template <typename T>
+size_t ImmutableVector<T>::transientVector::size() const {
+    return _size;
+}
+
+template <typename T>
+typename ImmutableVector<T>::transientVector& ImmutableVector<T>::transientVector::addBack(const T& element) {
+    append(_root, _shift, _size, _owner, element);
+    return *this;
+}
+
+template <typename T>
+typename ImmutableVector<T>::transientVector& ImmutableVector<T>::transientVector::addBack(T&& element) {
+    append(_root, _shift, _size, _owner, std::move(element));
+    return *this;
+}
+
+template <typename T>
+typename ImmutableVector<T>::transientVector& ImmutableVector<T>::transientVector::set(size_t index, const T& element) {
+    if (index >= _size) {
+        cout << "set failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    assign(_root, _shift, index, _owner, element);
+    return *this;
+}
+
+template <typename T>
+const T& ImmutableVector<T>::transientVector::check(size_t index) const {
+    if (index >= _size) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    size_t start = 0;
+    return leafAt(_root, _shift, index, start)->elements()[index - start];
+}
+
+template <typename T>
+const T& ImmutableVector<T>::transientVector::operator[](size_t index) const {
+    return check(index);
+}
+
+template <typename T>
+ImmutableVector<T> ImmutableVector<T>::transientVector::persistent() {
+    // from here on the transient must copy what the version can see
+    _owner = freshOwner();
+    return ImmutableVector(retain(_root), _shift, _size);
+}
@@ -0,0 +1,503 @@
+/**
+ * Created on October 19, 2026. ImmutableVector<T> is a persistent
+ * vector whose versions share structure, for use in projects by BII.
+ *
+ * The elements sit in the leaves of a relaxed radix-balanced (RRB)
+ * tree with 32-way nodes. Where every subtree to the left of a path
+ * is full, a node finds its child from five bits of the index, as in
+ * a plain radix tree; nodes built by concatenation may hold partly
+ * filled children and keep a table of cumulative sizes instead, which
+ * the lookup scans from the radix guess. Either way an index costs
+ * O(log32 N) node visits, at most seven for 2^32 elements.
+ *
+ * Nodes are never changed once a version can see them. set and
+ * addBack copy the path from the root to one leaf and share the
+ * rest, concat rebuilds only the nodes along the seam, and copying
+ * a version bumps one reference count, so a snapshot is O(1). Along
+ * the seam concat spreads the contents of partly filled nodes over
+ * their neighbors until each level has at most two nodes more than
+ * it needs, which keeps the tree shallow however often it is joined.
+ *
+ * For building or changing many elements at once, transient()
+ * returns a transientVector that edits the nodes it made itself in
+ * place and copies shared ones on first touch; persistent() hands
+ * the result back as a new version.
+ *
+ * Reference counts are atomic, so versions that share nodes may be
+ * copied, read, and destroyed on different threads; a single object
+ * must not be assigned to while another thread reads it.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added ImmutableVector with size, empty, addBack, set, concat, +,
+ * check, [], tryAt, front, back, transient, iterators, ==, and !=,
+ * and transientVector with addBack, set, check, [], and persistent.
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "storage.h"
+#include "vector.h"
+
+template <typename T>
+class ImmutableVector {
+    /** The children per node, and the index bits each level uses */
+    static constexpr size_t branching = 32;
+    static constexpr unsigned bits = 5;
+    /** How many children past the fewest that would do concat may leave on a level */
+    static constexpr size_t extras = 2;
+    /** The level of the highest root, the most append's right edge buffer holds */
+    static constexpr unsigned maxShift = 64 / bits * bits;
+
+    /** The header every node starts with */
+    struct treeNode {
+        /** The number of versions and nodes pointing at this node */
+        mutable std::atomic<size_t> references;
+        /** The transient that may edit this node in place, or 0 */
+        uint64_t owner;
+        /** The elements of a leaf or the children of a branch */
+        size_t count;
+
+        explicit treeNode(uint64_t owner) : references(1), owner(owner), count(0) { }
+    };
+
+    /** A node at level 0, holding up to 32 elements */
+    struct leafNode : treeNode {
+        alignas(T) unsigned char storage[branching * sizeof(T)];
+
+        explicit leafNode(uint64_t owner) : treeNode(owner) { }
+        ~leafNode() { Storage<T>::destroy(elements(), elements() + this->count); }
+
+        T* elements() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* elements() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    /** A node above level 0, holding up to 32 subtrees */
+    struct branchNode : treeNode {
+        treeNode* children[branching];
+        /** sizes[k] is the number of elements in children 0 through k */
+        size_t sizes[branching];
+        /** False while every child but the last is full, so the index picks the child */
+        bool relaxed;
+
+        explicit branchNode(uint64_t owner) : treeNode(owner), relaxed(false) { }
+    };
+
+public:
+    class const_iterator;
+    class transientVector;
+
+    using iterator = const_iterator;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty vector without allocating
+     */
+    ImmutableVector();
+
+    /**
+     * Creates a vector holding copies of the given elements
+     * O(N) asymptotic complexity
+     */
+    explicit ImmutableVector(const Vector<T>& elements);
+
+    /**
+     * Copy Constructor
+     * Shares every node of the given version
+     * O(1) asymptotic complexity
+     */
+    ImmutableVector(const ImmutableVector& other);
+
+    /**
+     * Move Constructor
+     * O(1) asymptotic complexity
+     */
+    ImmutableVector(ImmutableVector&& other);
+
+    /**
+     * Destructor
+     * Frees the nodes no other version shares
+     */
+    ~ImmutableVector();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of elements in this version
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if this version is empty
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a new version with the given element at the
+     * back, leaving this one unchanged
+     * O(log32 N) asymptotic complexity
+     */
+    ImmutableVector addBack(const T& element) const;
+
+    /**
+     * Returns a new version with the given r-value element
+     * at the back, leaving this one unchanged
+     * O(log32 N) asymptotic complexity
+     */
+    ImmutableVector addBack(T&& element) const;
+
+    /**
+     * Returns a new version with the element at the given index
+     * replaced, leaving this one unchanged
+     * Throws an error for invalid indexes
+     * O(log32 N) asymptotic complexity
+     */
+    ImmutableVector set(size_t index, const T& element) const;
+
+    /**
+     * Returns a new version holding this version's elements followed
+     * by the given one's, sharing every node off the seam between them
+     * Throws an error if the joined tree would be too tall to index
+     * O(log32 N) node copies
+     */
+    ImmutableVector concat(const ImmutableVector& other) const;
+
+    /**
+     * Returns a transient that starts from this version
+     */
+    transientVector transient() const;
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element at the given index
+     * Throws an error for invalid indexes
+     * O(log32 N) asymptotic complexity
+     */
+    const T& check(size_t index) const;
+
+    /**
+     * Returns a pointer to the element at the given index,
+     * or nullptr for invalid indexes
+     */
+    const T* tryAt(size_t index) const;
+
+    /**
+     * Views the first element
+     * Throws an error if the vector is empty
+     */
+    const T& front() const;
+
+    /**
+     * Views the last element
+     * Throws an error if the vector is empty
+     */
+    const T& back() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the element at the given index
+     * Throws an error for invalid indexes
+     */
+    const T& operator[](size_t index) const;
+
+    /**
+     * Copy Assignment
+     * O(1) asymptotic complexity, plus the nodes freed
+     */
+    ImmutableVector& operator=(const ImmutableVector& assign);
+
+    /**
+     * Move Assignment
+     * O(1) asymptotic complexity, plus the nodes freed
+     */
+    ImmutableVector& operator=(ImmutableVector&& assign);
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator to the first element
+     */
+    const_iterator begin() const;
+
+    /**
+     * Iterator past the last element
+     */
+    const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two versions, returns their concatenation
+     */
+    template <typename T_>
+    friend ImmutableVector<T_> operator+(const ImmutableVector<T_>& first, const ImmutableVector<T_>& second);
+
+    /**
+     * Given two versions, returns true if they have the
+     * same elements in the same order
+     */
+    template <typename T_>
+    friend bool operator==(const ImmutableVector<T_>& first, const ImmutableVector<T_>& second);
+
+    /**
+     * Given two versions, returns true if they don't have
+     * the same elements in the same order
+     */
+    template <typename T_>
+    friend bool operator!=(const ImmutableVector<T_>& first, const ImmutableVector<T_>& second);
+
+    /**
+     * Walks the elements in order, one leaf at a time
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = const T&;
+        using pointer = const T*;
+
+        const_iterator() : _vector(nullptr), _index(0), _element(nullptr), _leafEnd(0) { }
+
+        reference operator*() const { return *_element; }
+        pointer operator->() const { return _element; }
+
+        const_iterator& operator++() {
+            _index++;
+            if (_index < _leafEnd) {
+                _element++;
+            } else {
+                seek();
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator before = *this;
+            ++*this;
+            return before;
+        }
+
+        bool operator==(const const_iterator& other) const { return _index == other._index; }
+        bool operator!=(const const_iterator& other) const { return _index != other._index; }
+
+    private:
+        friend class ImmutableVector;
+
+        const_iterator(const ImmutableVector* vector, size_t index) :
+            _vector(vector), _index(index), _element(nullptr), _leafEnd(0) {
+            seek();
+        }
+
+        /** Finds the leaf holding the current index */
+        void seek() {
+            if (_index < _vector->_size) {
+                size_t start = 0;
+                const leafNode* leaf = leafAt(_vector->_root, _vector->_shift, _index, start);
+                _element = leaf->elements() + (_index - start);
+                _leafEnd = start + leaf->count;
+            }
+        }
+
+        const ImmutableVector* _vector;
+        size_t _index;
+        const T* _element;
+        size_t _leafEnd;
+    };
+
+    /**
+     * A mutable draft of a version. Nodes the transient made are
+     * changed in place; nodes it shares with versions are copied
+     * the first time they are changed. Not safe to use from two
+     * threads at once.
+     */
+    class transientVector {
+    public:
+        /**
+         * Creates an empty transient
+         */
+        transientVector();
+
+        transientVector(const transientVector&) = delete;
+        transientVector& operator=(const transientVector&) = delete;
+
+        /**
+         * Move Constructor
+         */
+        transientVector(transientVector&& other);
+
+        /**
+         * Destructor
+         */
+        ~transientVector();
+
+        /**
+         * Returns the number of elements
+         */
+        size_t size() const;
+
+        /**
+         * Appends an l-value element
+         * O(1) amortized node allocations
+         */
+        transientVector& addBack(const T& element);
+
+        /**
+         * Appends an r-value element
+         * O(1) amortized node allocations
+         */
+        transientVector& addBack(T&& element);
+
+        /**
+         * Replaces the element at the given index
+         * Throws an error for invalid indexes
+         */
+        transientVector& set(size_t index, const T& element);
+
+        /**
+         * Views the element at the given index
+         * Throws an error for invalid indexes
+         */
+        const T& check(size_t index) const;
+        const T& operator[](size_t index) const;
+
+        /**
+         * Returns the elements so far as a version. Later changes
+         * to the transient copy the nodes they touch, so the
+         * version never sees them.
+         * O(1) asymptotic complexity
+         */
+        ImmutableVector persistent();
+
+    private:
+        friend class ImmutableVector;
+
+        transientVector(treeNode* root, unsigned shift, size_t size);
+
+        treeNode* _root;
+        unsigned _shift;
+        size_t _size;
+        uint64_t _owner;
+    };
+
+private:
+    /** The root of the tree, or nullptr when empty */
+    treeNode* _root;
+
+    /** The index bits below the root: 0 when the root is a leaf */
+    unsigned _shift;
+
+    /** The number of elements */
+    size_t _size;
+
+    /** The last owner handed to a transient */
+    static inline std::atomic<uint64_t> _owners{0};
+
+    /** Up to two nodes of one level, left over from joining two subtrees */
+    struct seamNodes {
+        treeNode* nodes[2];
+        size_t count;
+        unsigned shift;
+    };
+
+    /**
+     * Makes a version from a root it already holds a reference to
+     */
+    ImmutableVector(treeNode* root, unsigned shift, size_t size);
+
+    /**
+     * Returns an owner no node has yet
+     */
+    static uint64_t freshOwner();
+
+    /**
+     * Adds a reference to the given node, if any
+     */
+    static treeNode* retain(treeNode* node);
+
+    /**
+     * Drops a reference to the given node at the given level,
+     * freeing it and every subtree no one else references
+     */
+    static void release(treeNode* node, unsigned shift);
+
+    /**
+     * Returns the number of elements under the given node
+     */
+    static size_t sizeOf(const treeNode* node, unsigned shift);
+
+    /**
+     * Finds the leaf holding the given index, setting start
+     * to the index of its first element
+     */
+    static const leafNode* leafAt(const treeNode* root, unsigned shift, size_t index, size_t& start);
+
+    /**
+     * Picks the child of a branch holding the given index, and
+     * makes the index relative to that child
+     */
+    static size_t childFor(const branchNode* branch, unsigned shift, size_t& index);
+
+    /**
+     * Recomputes a branch's size table and whether it is relaxed
+     */
+    static void refresh(branchNode* branch, unsigned shift);
+
+    /**
+     * Takes over a reference to the given node and returns a node
+     * the owner may change: the node itself if the owner made it,
+     * otherwise a copy sharing its children
+     */
+    static treeNode* editable(treeNode* node, unsigned shift, uint64_t owner);
+
+    /**
+     * Returns a chain of single-child branches from the given
+     * level down to a leaf holding one element
+     */
+    template <typename Value>
+    static treeNode* newPath(unsigned shift, uint64_t owner, Value&& element);
+
+    /**
+     * Appends an element to the tree, growing a level when the
+     * right edge is full; owner 0 copies every node it changes
+     */
+    template <typename Value>
+    static void append(treeNode*& root, unsigned& shift, size_t& size, uint64_t owner, Value&& element);
+
+    /**
+     * Replaces the element at a valid index; owner 0 copies
+     * every node it changes
+     */
+    static void assign(treeNode*& root, unsigned shift, size_t index, uint64_t owner, const T& element);
+
+    /**
+     * Joins two subtrees edge to edge, rebuilding the nodes along
+     * the seam, and returns what is left at the higher level
+     */
+    static seamNodes join(treeNode* left, unsigned leftShift, treeNode* right, unsigned rightShift);
+
+    /**
+     * Builds a node at the given level from the next count elements
+     * (at level 0) or children of the given nodes, starting at
+     * position offset of node from, and moves both past them
+     */
+    static treeNode* gather(treeNode* const* nodes, size_t& from, size_t& offset, size_t count, unsigned shift);
+
+    /**
+     * Packs the children of left (except its last), the seam nodes,
+     * and the children of right (except its first) into one or two
+     * new branches at the given level, first regrouping their contents
+     * into fewer children when there are more than extras too many
+     */
+    static seamNodes pack(const branchNode* left, seamNodes seam, const branchNode* right, unsigned shift);
+};
+
+#include "immutable-vector.cpp"
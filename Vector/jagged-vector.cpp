@@ -0,0 +1,336 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the jagged-vector.h class
+ */
+#pragma once
+#include "jagged-vector.h"
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+JaggedVector<T>::JaggedVector() : _values(0), _ends(0) { }
+
+template <typename T>
+JaggedVector<T>::JaggedVector(const Vector<Vector<T>>& rows) : _values(0), _ends(static_cast<int>(rows.size())) {
+    size_t total = 0;
+    for (const Vector<T>& row : rows) {
+        total += row.size();
+    }
+    if (total > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        cout << "JaggedVector failed\n";
+        BII_THROW(std::length_error("Too many values for one jagged vector"));
+    }
+    _values = Vector<T>(static_cast<int>(total));
+    for (const Vector<T>& row : rows) {
+        for (const T& value : row) {
+            _values.addBack(value);
+        }
+        _ends.addBack(_values.size());
+    }
+}
+
+template <typename T>
+JaggedVector<T>::JaggedVector(size_t rowCount, const Vector<std::pair<size_t, T>>& edges, unsigned threads)
+    : _values(0), _ends(0) {
+    if (rowCount > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        cout << "JaggedVector failed\n";
+        BII_THROW(std::length_error("Too many rows for one jagged vector"));
+    }
+    size_t edgeCount = edges.size();
+    if (edgeCount > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        cout << "JaggedVector failed\n";
+        BII_THROW(std::length_error("Too many values for one jagged vector"));
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // each part keeps a count per row, so parts are only worth
+    // adding while they have more edges than there are rows
+    size_t parts = edgeCount / std::max(rowCount, static_cast<size_t>(edgesPerThread));
+    parts = std::max(static_cast<size_t>(1), std::min(parts, static_cast<size_t>(threads)));
+    size_t rowsPerPart = (rowCount + parts - 1) / parts;
+    size_t edgesPerPart = (edgeCount + parts - 1) / parts;
+    const std::pair<size_t, T>* edge = edges.begin();
+
+    // count each part's edges per row; parts * rows is at most the edge count
+    Vector<size_t> counts(static_cast<int>(parts * rowCount), forOverwrite);
+    size_t* count = counts.begin();
+    std::atomic<bool> outside(false);
+    runParts(parts, [&](size_t part) {
+        size_t* mine = count + part * rowCount;
+        std::fill(mine, mine + rowCount, 0);
+        size_t last = std::min(edgeCount, (part + 1) * edgesPerPart);
+        for (size_t e = part * edgesPerPart; e < last; e++) {
+            if (edge[e].first >= rowCount) {
+                outside.store(true, std::memory_order_relaxed);
+                return;
+            }
+            mine[edge[e].first]++;
+        }
+    });
+    if (outside.load()) {
+        cout << "JaggedVector failed\n";
+        BII_THROW(std::out_of_range("Edge names a row outside of jagged vector"));
+    }
+
+    // total each block of rows, then offset the blocks from one another
+    Vector<size_t> blockStarts(static_cast<int>(parts), forOverwrite);
+    size_t* blockStart = blockStarts.begin();
+    runParts(parts, [&](size_t part) {
+        size_t last = std::min(rowCount, (part + 1) * rowsPerPart);
+        size_t total = 0;
+        for (size_t row = part * rowsPerPart; row < last; row++) {
+            for (size_t p = 0; p < parts; p++) {
+                total += count[p * rowCount + row];
+            }
+        }
+        blockStart[part] = total;
+    });
+    size_t running = 0;
+    for (size_t part = 0; part < parts; part++) {
+        size_t total = blockStart[part];
+        blockStart[part] = running;
+        running += total;
+    }
+
+    // turn the counts into each part's first write position per row
+    _ends = Vector<size_t>(static_cast<int>(rowCount), forOverwrite);
+    size_t* end = _ends.begin();
+    runParts(parts, [&](size_t part) {
+        size_t last = std::min(rowCount, (part + 1) * rowsPerPart);
+        size_t position = blockStart[part];
+        for (size_t row = part * rowsPerPart; row < last; row++) {
+            for (size_t p = 0; p < parts; p++) {
+                size_t rowCountOfPart = count[p * rowCount + row];
+                count[p * rowCount + row] = position;
+                position += rowCountOfPart;
+            }
+            end[row] = position;
+        }
+    });
+
+    // scatter; each part writes its edges in order into its own positions
+    _values = Vector<T>(static_cast<int>(edgeCount), forOverwrite);
+    T* value = _values.begin();
+    runParts(parts, [&](size_t part) {
+        size_t* position = count + part * rowCount;
+        size_t last = std::min(edgeCount, (part + 1) * edgesPerPart);
+        for (size_t e = part * edgesPerPart; e < last; e++) {
+            value[position[edge[e].first]++] = edge[e].second;
+        }
+    });
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t JaggedVector<T>::rows() const {
+    return _ends.size();
+}
+
+template <typename T>
+inline size_t JaggedVector<T>::size() const {
+    return _values.size();
+}
+
+template <typename T>
+inline bool JaggedVector<T>::empty() const {
+    return _ends.empty();
+}
+
+template <typename T>
+size_t JaggedVector<T>::rowSize(size_t row) const {
+    return check(row).size();
+}
+
+template <typename T>
+void JaggedVector<T>::reserve(size_t rowCount, size_t valueCount) {
+    size_t room = _ends.capacity() - _ends.size();
+    if (rowCount > room) {
+        _ends.reserve(rowCount - room);
+    }
+    room = _values.capacity() - _values.size();
+    if (valueCount > room) {
+        _values.reserve(valueCount - room);
+    }
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+JaggedVector<T>& JaggedVector<T>::addRow() {
+    _ends.addBack(_values.size());
+    return *this;
+}
+
+template <typename T>
+JaggedVector<T>& JaggedVector<T>::addRow(Span<const T> row) {
+    reserve(1, row.size());
+    addRow();
+    for (const T& value : row) {
+        addBack(value);
+    }
+    return *this;
+}
+
+template <typename T>
+JaggedVector<T>& JaggedVector<T>::addBack(const T& value) {
+    if (_ends.empty()) {
+        cout << "addBack failed\n";
+        BII_THROW(empty_vector());
+    }
+    _values.addBack(value);
+    _ends.begin()[_ends.size() - 1]++;
+    return *this;
+}
+
+template <typename T>
+JaggedVector<T>& JaggedVector<T>::addBack(T&& value) {
+    if (_ends.empty()) {
+        cout << "addBack failed\n";
+        BII_THROW(empty_vector());
+    }
+    _values.addBack(std::move(value));
+    _ends.begin()[_ends.size() - 1]++;
+    return *this;
+}
+
+template <typename T>
+JaggedVector<T>& JaggedVector<T>::removeRow() {
+    if (_ends.empty()) {
+        cout << "removeRow failed\n";
+        BII_THROW(empty_vector());
+    }
+    size_t first = start(_ends.size() - 1);
+    while (_values.size() > first) {
+        _values.removeBack();
+    }
+    _ends.removeBack();
+    return *this;
+}
+
+template <typename T>
+JaggedVector<T>& JaggedVector<T>::clear() {
+    _values.clear();
+    _ends.clear();
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+Span<T> JaggedVector<T>::check(size_t row) {
+    Span<const T> view = static_cast<const JaggedVector<T>&>(*this).check(row);
+    return Span<T>(const_cast<T*>(view.data()), view.size());
+}
+
+template <typename T>
+Span<const T> JaggedVector<T>::check(size_t row) const {
+    if (row >= _ends.size()) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access row outside of jagged vector"));
+    }
+    size_t first = start(row);
+    return Span<const T>(_values.begin() + first, _ends.begin()[row] - first);
+}
+
+template <typename T>
+Span<T> JaggedVector<T>::values() {
+    return Span<T>(_values.begin(), _values.size());
+}
+
+template <typename T>
+Span<const T> JaggedVector<T>::values() const {
+    return Span<const T>(_values.begin(), _values.size());
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+Span<T> JaggedVector<T>::operator[](size_t row) {
+    return check(row);
+}
+
+template <typename T>
+Span<const T> JaggedVector<T>::operator[](size_t row) const {
+    return check(row);
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename JaggedVector<T>::iterator JaggedVector<T>::begin() {
+    return iterator(_values.begin(), _ends.begin(), 0);
+}
+
+template <typename T>
+typename JaggedVector<T>::iterator JaggedVector<T>::end() {
+    return iterator(_values.begin(), _ends.begin(), _ends.size());
+}
+
+template <typename T>
+typename JaggedVector<T>::const_iterator JaggedVector<T>::begin() const {
+    return const_iterator(_values.begin(), _ends.begin(), 0);
+}
+
+template <typename T>
+typename JaggedVector<T>::const_iterator JaggedVector<T>::end() const {
+    return const_iterator(_values.begin(), _ends.begin(), _ends.size());
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T_>
+bool operator==(const JaggedVector<T_>& first, const JaggedVector<T_>& second) {
+    return first._ends == second._ends && first._values == second._values;
+}
+
+template <typename T_>
+bool operator!=(const JaggedVector<T_>& first, const JaggedVector<T_>& second) {
+    return !(first == second);
+}
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t JaggedVector<T>::start(size_t row) const {
+    return row == 0 ? 0 : _ends.begin()[row - 1];
+}
+
+template <typename T>
+template <typename Work>
+void JaggedVector<T>::runParts(size_t parts, Work work) {
+    if (parts == 1) {
+        work(0);
+        return;
+    }
+    Vector<std::thread> workers(static_cast<int>(parts - 1));
+    Vector<std::exception_ptr> failures(static_cast<int>(parts), std::exception_ptr());
+    std::exception_ptr* failure = failures.begin();
+    auto guarded = [&work, failure](size_t part) {
+        BII_TRY {
+            work(part);
+        } BII_CATCH_ALL {
+            failure[part] = std::current_exception();
+        }
+    };
+    for (size_t part = 1; part < parts; part++) {
+        BII_TRY {
+            workers.addBack(std::thread(guarded, part));
+        } BII_CATCH_ALL {
+            // no thread to spare; do the part here instead
+            guarded(part);
+        }
+    }
+    guarded(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+#if BII_EXCEPTIONS
+    for (std::exception_ptr& thrown : failures) {
+        if (thrown) {
+            std::rethrow_exception(thrown);
+        }
+    }
+#endif
+}
@@ -0,0 +1,275 @@
+/**
+ * Created on October 19, 2026. JaggedVector<T> is a list of rows
+ * of varying length stored flat (compressed sparse rows), for use
+ * in projects by BII in place of Vector<Vector<T>>.
+ *
+ * Every value of every row lives in one Vector<T>, row after row,
+ * and a second Vector holds where each row ends. A row costs one
+ * offset instead of a Vector with its own buffer, and walking the
+ * rows in order walks memory in order. Rows are viewed as a
+ * Span<T>, which is valid until the next call that adds or
+ * removes values.
+ *
+ * Rows are built at the back: addRow opens a new last row and
+ * addBack appends to it, so a list is filled row by row without
+ * knowing the row lengths up front. A whole list can also be
+ * built from an edge list of (row, value) pairs by counting sort:
+ * the edges are split across threads, each counts its own edges
+ * per row, the counts are turned into write positions, and each
+ * thread then scatters its edges. Values keep their edge list order
+ * within a row, whatever the number of threads.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added JaggedVector with addRow, addBack, removeRow, clear, reserve,
+ * rows, size, rowSize, [], check, values, row iterators, ==, and !=,
+ * and construction from Vector<Vector<T>> and from edge lists.
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "../Span/span.h"
+#include "vector.h"
+
+template <typename T>
+class JaggedVector {
+public:
+    template <bool Const>
+    class rowIterator;
+
+    using iterator = rowIterator<false>;
+    using const_iterator = rowIterator<true>;
+
+    /** The fewest edges worth giving a thread of its own */
+    static constexpr size_t edgesPerThread = 1 << 14;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates a list with no rows without allocating
+     */
+    JaggedVector();
+
+    /**
+     * Creates a list holding copies of the given rows, with the
+     * values allocated once at the exact total size
+     */
+    explicit JaggedVector(const Vector<Vector<T>>& rows);
+
+    /**
+     * Creates a list of rowCount rows, where each (row, value)
+     * edge adds value to its row, using up to the given number of
+     * threads (0 for one per core); T must be default constructible
+     * Throws an error if an edge names a row past rowCount, or if
+     * there are more rows or edges than a Vector can hold
+     * O(E + R) asymptotic complexity
+     */
+    JaggedVector(size_t rowCount, const Vector<std::pair<size_t, T>>& edges, unsigned threads = 0);
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of rows
+     * O(1) asymptotic complexity
+     */
+    inline size_t rows() const;
+
+    /**
+     * Returns the number of values across all rows
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if there are no rows
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns the number of values in the given row
+     * Throws an error for invalid rows
+     */
+    size_t rowSize(size_t row) const;
+
+    /**
+     * Makes room for the given number of further rows and values
+     */
+    void reserve(size_t rowCount, size_t valueCount);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Opens a new, empty last row
+     * O(1) amortized asymptotic complexity
+     */
+    JaggedVector<T>& addRow();
+
+    /**
+     * Adds a copy of the given values as a new last row
+     * O(N) asymptotic complexity in the values added
+     */
+    JaggedVector<T>& addRow(Span<const T> row);
+
+    /**
+     * Appends a value to the last row
+     * Throws an error if there are no rows
+     * O(1) amortized asymptotic complexity
+     */
+    JaggedVector<T>& addBack(const T& value);
+
+    /**
+     * Appends an r-value to the last row
+     * Throws an error if there are no rows
+     * O(1) amortized asymptotic complexity
+     */
+    JaggedVector<T>& addBack(T&& value);
+
+    /**
+     * Removes the last row and its values
+     * Throws an error if there are no rows
+     */
+    JaggedVector<T>& removeRow();
+
+    /**
+     * Removes every row, keeping the capacity
+     */
+    JaggedVector<T>& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a view of the given row
+     * Throws an error for invalid rows
+     */
+    Span<T> check(size_t row);
+    Span<const T> check(size_t row) const;
+
+    /**
+     * Returns a view of every value, row after row
+     */
+    Span<T> values();
+    Span<const T> values() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns a view of the given row
+     * Throws an error for invalid rows
+     */
+    Span<T> operator[](size_t row);
+    Span<const T> operator[](size_t row) const;
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator over the rows, starting at the first
+     */
+    iterator begin();
+
+    /**
+     * Iterator past the last row
+     */
+    iterator end();
+
+    /**
+     * Const iterator over the rows, starting at the first
+     */
+    const_iterator begin() const;
+
+    /**
+     * Const iterator past the last row
+     */
+    const_iterator end() const;
+
+    /**
+     * Forward iterator handing out each row as a span
+     */
+    template <bool Const>
+    class rowIterator {
+    public:
+        using value_type = Span<typename std::conditional<Const, const T, T>::type>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+        using iterator_category = std::input_iterator_tag;
+
+        rowIterator() : _values(nullptr), _ends(nullptr), _row(0) { }
+
+        /**
+         * Returns a view of the current row
+         */
+        value_type operator*() const {
+            size_t start = _row == 0 ? 0 : _ends[_row - 1];
+            return value_type(_values + start, _ends[_row] - start);
+        }
+
+        rowIterator& operator++() {
+            _row++;
+            return *this;
+        }
+
+        rowIterator operator++(int) {
+            rowIterator before = *this;
+            _row++;
+            return before;
+        }
+
+        friend bool operator==(const rowIterator& left, const rowIterator& right) { return left._row == right._row; }
+        friend bool operator!=(const rowIterator& left, const rowIterator& right) { return left._row != right._row; }
+
+    private:
+        friend class JaggedVector<T>;
+
+        rowIterator(typename std::conditional<Const, const T, T>::type* values, const size_t* ends, size_t row)
+            : _values(values), _ends(ends), _row(row) { }
+
+        /* the first value of the first row */
+        typename std::conditional<Const, const T, T>::type* _values;
+
+        /* where each row ends */
+        const size_t* _ends;
+
+        /* the current row */
+        size_t _row;
+    };
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two lists, returns true if they have the same rows
+     */
+    template <typename T_>
+    friend bool operator==(const JaggedVector<T_>& first, const JaggedVector<T_>& second);
+
+    /**
+     * Given two lists, returns true if any row differs
+     */
+    template <typename T_>
+    friend bool operator!=(const JaggedVector<T_>& first, const JaggedVector<T_>& second);
+
+private:
+    /* every value, row after row */
+    Vector<T> _values;
+
+    /* one past the last value of each row */
+    Vector<size_t> _ends;
+
+    /**
+     * Returns the offset of the first value of the given row
+     */
+    inline size_t start(size_t row) const;
+
+    /**
+     * Calls work(part) for every part below parts, one part per
+     * thread, with part 0 on the calling thread; rethrows the first
+     * error any part threw once all of them are done
+     */
+    template <typename Work>
+    static void runParts(size_t parts, Work work);
+};
+
+#include "jagged-vector.cpp"
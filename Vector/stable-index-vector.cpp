@@ -0,0 +1,383 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the stable-index-vector.h class
+ */
+#pragma once
+#include "stable-index-vector.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+size_t StableIndexVector<T>::nextLive(size_t from) const {
+    if (from >= _end) {
+        return _end;
+    }
+    const uint64_t* live = _live.begin();
+    size_t word = from / wordBits;
+    size_t words = (_end + wordBits - 1) / wordBits;
+    // drop the bits below from, then scan whole words for the next set bit
+    uint64_t bits = live[word] & (~uint64_t(0) << (from % wordBits));
+    while (bits == 0) {
+        if (++word == words) {
+            return _end;
+        }
+        bits = live[word];
+    }
+    return word * wordBits + static_cast<size_t>(__builtin_ctzll(bits));
+}
+
+template <typename T>
+inline void StableIndexVector<T>::mark(size_t index, bool live) {
+    uint64_t bit = uint64_t(1) << (index % wordBits);
+    uint64_t& word = _live.begin()[index / wordBits];
+    word = live ? word | bit : word & ~bit;
+}
+
+template <typename T>
+T* StableIndexVector<T>::claim() {
+    if (_end == _capacity) {
+        regrow(_capacity == 0 ? wordBits : _capacity * 2);
+    }
+    return _slots + _end;
+}
+
+template <typename T>
+void StableIndexVector<T>::regrow(size_t capacity) {
+    T* slots = Storage<T>::allocate(capacity);
+    if (std::is_trivially_copyable<T>::value) {
+        // dead slots are copied along with the live ones; they are never read
+        if (_end != 0) {
+            std::memcpy(static_cast<void*>(slots), static_cast<const void*>(_slots), _end * sizeof(T));
+        }
+    } else {
+        size_t index = nextLive(0);
+        BII_TRY {
+            for (; index != _end; index = nextLive(index + 1)) {
+                Storage<T>::construct(slots + index, std::move_if_noexcept(_slots[index]));
+            }
+        } BII_CATCH_ALL {
+            for (size_t built = nextLive(0); built != index; built = nextLive(built + 1)) {
+                Storage<T>::destroy(slots + built, slots + built + 1);
+            }
+            Storage<T>::deallocate(slots, capacity);
+            BII_RETHROW;
+        }
+        for (index = nextLive(0); index != _end; index = nextLive(index + 1)) {
+            Storage<T>::destroy(_slots + index, _slots + index + 1);
+        }
+    }
+    Storage<T>::deallocate(_slots, _capacity);
+    _slots = slots;
+    _capacity = capacity;
+    while (_live.size() * wordBits < _capacity) {
+        _live.addBack(0);
+    }
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename T>
+StableIndexVector<T>::StableIndexVector() :
+    _slots(nullptr), _end(0), _capacity(0), _size(0), _live(0), _compacting(false), _read(0), _write(0), _remap(0) { }
+
+template <typename T>
+StableIndexVector<T>::StableIndexVector(const StableIndexVector& other) :
+    _slots(Storage<T>::allocate(other._capacity)), _end(other._end), _capacity(other._capacity), _size(other._size),
+    _live(other._live), _compacting(other._compacting), _read(other._read), _write(other._write),
+    _remap(other._remap) {
+    size_t index = other.nextLive(0);
+    BII_TRY {
+        for (; index != _end; index = other.nextLive(index + 1)) {
+            Storage<T>::construct(_slots + index, other._slots[index]);
+        }
+    } BII_CATCH_ALL {
+        for (size_t built = other.nextLive(0); built != index; built = other.nextLive(built + 1)) {
+            Storage<T>::destroy(_slots + built, _slots + built + 1);
+        }
+        Storage<T>::deallocate(_slots, _capacity);
+        BII_RETHROW;
+    }
+}
+
+template <typename T>
+StableIndexVector<T>::StableIndexVector(StableIndexVector&& other) :
+    _slots(other._slots), _end(other._end), _capacity(other._capacity), _size(other._size),
+    _live(std::move(other._live)), _compacting(other._compacting), _read(other._read), _write(other._write),
+    _remap(std::move(other._remap)) {
+    other._slots = nullptr;
+    other._end = 0;
+    other._capacity = 0;
+    other._size = 0;
+    other._live.clear();
+    other._compacting = false;
+}
+
+template <typename T>
+StableIndexVector<T>::~StableIndexVector() {
+    clear();
+    Storage<T>::deallocate(_slots, _capacity);
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+inline size_t StableIndexVector<T>::size() const {
+    return _size;
+}
+
+template <typename T>
+inline bool StableIndexVector<T>::empty() const {
+    return _size == 0;
+}
+
+template <typename T>
+inline size_t StableIndexVector<T>::slots() const {
+    return _end;
+}
+
+template <typename T>
+inline size_t StableIndexVector<T>::tombstones() const {
+    return _end - _size;
+}
+
+template <typename T>
+inline size_t StableIndexVector<T>::capacity() const {
+    return _capacity;
+}
+
+template <typename T>
+void StableIndexVector<T>::reserve(size_t count) {
+    if (_end + count > _capacity) {
+        regrow(_end + count);
+    }
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+size_t StableIndexVector<T>::addBack(const T& element) {
+    return emplaceBack(element);
+}
+
+template <typename T>
+size_t StableIndexVector<T>::addBack(T&& element) {
+    return emplaceBack(std::move(element));
+}
+
+template <typename T>
+template <typename... Args>
+size_t StableIndexVector<T>::emplaceBack(Args&&... args) {
+    if (_end == _capacity) {
+        // args may refer to an element in the slots that claim releases
+        T element(std::forward<Args>(args)...);
+        Storage<T>::construct(claim(), std::move(element));
+    } else {
+        Storage<T>::construct(_slots + _end, std::forward<Args>(args)...);
+    }
+    mark(_end, true);
+    _size++;
+    return _end++;
+}
+
+template <typename T>
+void StableIndexVector<T>::erase(size_t index) {
+    if (!contains(index)) {
+        cout << "erase failed\n";
+        BII_THROW(std::out_of_range("Trying to erase an index that holds no element"));
+    }
+    Storage<T>::destroy(_slots + index, _slots + index + 1);
+    mark(index, false);
+    _size--;
+}
+
+template <typename T>
+void StableIndexVector<T>::clear() {
+    for (size_t index = nextLive(0); index != _end; index = nextLive(index + 1)) {
+        Storage<T>::destroy(_slots + index, _slots + index + 1);
+    }
+    for (uint64_t& word : _live) {
+        word = 0;
+    }
+    _end = 0;
+    _size = 0;
+    _compacting = false;
+    _remap.clear();
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+bool StableIndexVector<T>::contains(size_t index) const {
+    return index < _end && (_live.begin()[index / wordBits] >> (index % wordBits) & 1) != 0;
+}
+
+template <typename T>
+T& StableIndexVector<T>::check(size_t index) {
+    return const_cast<T&>(static_cast<const StableIndexVector<T>&>(*this).check(index));
+}
+
+template <typename T>
+const T& StableIndexVector<T>::check(size_t index) const {
+    if (!contains(index)) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access an index that holds no element"));
+    }
+    return _slots[index];
+}
+
+template <typename T>
+T* StableIndexVector<T>::tryAt(size_t index) {
+    return const_cast<T*>(static_cast<const StableIndexVector<T>&>(*this).tryAt(index));
+}
+
+template <typename T>
+const T* StableIndexVector<T>::tryAt(size_t index) const {
+    return contains(index) ? _slots + index : nullptr;
+}
+
+// Compaction ––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+Vector<size_t> StableIndexVector<T>::compact() {
+    while (!compactStep(static_cast<size_t>(-1))) { }
+    return std::move(_remap);
+}
+
+template <typename T>
+bool StableIndexVector<T>::compactStep(size_t budget) {
+    if (!_compacting) {
+        _compacting = true;
+        _read = 0;
+        _write = 0;
+        _remap = Vector<size_t>(static_cast<int>(_end), [](size_t i) { return i; });
+    }
+    // slots appended since the pass began have not moved yet
+    while (_remap.size() < _end) {
+        _remap.addBack(_remap.size());
+    }
+    size_t stop = budget < _end - _read ? _read + budget : _end;
+    size_t* remap = _remap.begin();
+    while (_read < stop) {
+        size_t next = nextLive(_read);
+        if (next > stop) {
+            next = stop;
+        }
+        // everything skipped by the bit scan is a tombstone
+        for (; _read < next; _read++) {
+            remap[_read] = erased;
+        }
+        if (_read == stop) {
+            break;
+        }
+        if (_read != _write) {
+            Storage<T>::relocate(_slots + _read, _slots + _read + 1, _slots + _write);
+            mark(_write, true);
+            mark(_read, false);
+        }
+        remap[_read++] = _write++;
+    }
+    if (_read < _end) {
+        return false;
+    }
+    _end = _write;
+    _compacting = false;
+    return true;
+}
+
+template <typename T>
+bool StableIndexVector<T>::compacting() const {
+    return _compacting;
+}
+
+template <typename T>
+const Vector<size_t>& StableIndexVector<T>::remap() const {
+    return _remap;
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+T& StableIndexVector<T>::operator[](size_t index) {
+    return check(index);
+}
+
+template <typename T>
+const T& StableIndexVector<T>::operator[](size_t index) const {
+    return check(index);
+}
+
+template <typename T>
+StableIndexVector<T>& StableIndexVector<T>::operator=(const StableIndexVector& assign) {
+    if (&assign != this) {
+        StableIndexVector copy(assign);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+StableIndexVector<T>& StableIndexVector<T>::operator=(StableIndexVector&& assign) {
+    if (&assign == this) return *this;
+    clear();
+    Storage<T>::deallocate(_slots, _capacity);
+    _slots = assign._slots;
+    _end = assign._end;
+    _capacity = assign._capacity;
+    _size = assign._size;
+    _live = std::move(assign._live);
+    _compacting = assign._compacting;
+    _read = assign._read;
+    _write = assign._write;
+    _remap = std::move(assign._remap);
+    assign._slots = nullptr;
+    assign._end = 0;
+    assign._capacity = 0;
+    assign._size = 0;
+    assign._live.clear();
+    assign._compacting = false;
+    return *this;
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T>
+typename StableIndexVector<T>::iterator StableIndexVector<T>::begin() {
+    return iterator(this, nextLive(0));
+}
+
+template <typename T>
+typename StableIndexVector<T>::iterator StableIndexVector<T>::end() {
+    return iterator(this, _end);
+}
+
+template <typename T>
+typename StableIndexVector<T>::const_iterator StableIndexVector<T>::begin() const {
+    return const_iterator(this, nextLive(0));
+}
+
+template <typename T>
+typename StableIndexVector<T>::const_iterator StableIndexVector<T>::end() const {
+    return const_iterator(this, _end);
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename T_>
+bool operator==(const StableIndexVector<T_>& first, const StableIndexVector<T_>& second) {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    auto left = first.begin();
+    auto right = second.begin();
+    for (; left != first.end(); ++left, ++right) {
+        if (left.index() != right.index() || !(*left == *right)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T_>
+bool operator!=(const StableIndexVector<T_>& first, const StableIndexVector<T_>& second) {
+    return !(first == second);
+}
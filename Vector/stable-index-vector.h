@@ -0,0 +1,348 @@
+/**
+ * Created on October 19, 2026. StableIndexVector<T> is a
+ * list whose elements keep their index until it is compacted,
+ * for use in projects by BII.
+ *
+ * addBack hands out the index of the new element. erase destroys
+ * the element in place and clears its bit in a live bitmap, so it
+ * is O(1) and never shifts the elements after it; the slot stays
+ * dead (a tombstone) and its index is not handed out again. Walking
+ * the list skips dead slots a 64-bit word at a time with bit scans,
+ * so a mostly empty stretch costs one load per 64 slots.
+ *
+ * Tombstones are reclaimed only by compaction, which slides the
+ * live elements down in order and reports where each one went as
+ * an old-to-new remap (erased for the ones that were dead).
+ * compact() does the whole pass at once. compactStep(budget) does
+ * it a bounded number of slots at a time, so the pass can be
+ * spread across frames or requests; between steps every element
+ * is at remap()[its index before the pass], and the list can be
+ * read, appended to, and erased from as usual. An erase behind the
+ * pass leaves a tombstone for the next one.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added StableIndexVector with addBack, emplaceBack, erase, clear,
+ * reserve, contains, check, [], tryAt, compact, compactStep, remap,
+ * iterators, ==, and !=.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../Exceptions/exception.h"
+#include "storage.h"
+#include "vector.h"
+
+template <typename T>
+class StableIndexVector {
+public:
+    template <bool Const>
+    class slotIterator;
+
+    using iterator = slotIterator<false>;
+    using const_iterator = slotIterator<true>;
+
+    /** The remap entry of an element that was erased */
+    static constexpr size_t erased = static_cast<size_t>(-1);
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty list without allocating
+     */
+    StableIndexVector();
+
+    /**
+     * Copy Constructor
+     * Copies the live elements to the same indexes
+     */
+    StableIndexVector(const StableIndexVector& other);
+
+    /**
+     * Move Constructor
+     * O(1) asymptotic complexity
+     */
+    StableIndexVector(StableIndexVector&& other);
+
+    /**
+     * Destructor
+     */
+    ~StableIndexVector();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of live elements
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if there are no live elements
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns the number of slots handed out, live or dead;
+     * every index is below it
+     */
+    inline size_t slots() const;
+
+    /**
+     * Returns the number of dead slots compaction would reclaim
+     */
+    inline size_t tombstones() const;
+
+    /**
+     * Returns the number of slots there is room for
+     */
+    inline size_t capacity() const;
+
+    /**
+     * Makes room for the given number of further addBacks
+     */
+    void reserve(size_t count);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Appends an l-value element and returns its index
+     * O(1) amortized asymptotic complexity
+     */
+    size_t addBack(const T& element);
+
+    /**
+     * Appends an r-value element and returns its index
+     * O(1) amortized asymptotic complexity
+     */
+    size_t addBack(T&& element);
+
+    /**
+     * Constructs an element from the given arguments at
+     * the back and returns its index
+     */
+    template <typename... Args>
+    size_t emplaceBack(Args&&... args);
+
+    /**
+     * Destroys the element at the given index, leaving a tombstone
+     * Throws an error if the index does not hold a live element
+     * O(1) asymptotic complexity
+     */
+    void erase(size_t index);
+
+    /**
+     * Destroys every element and forgets every index,
+     * keeping the capacity
+     */
+    void clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns true if the given index holds a live element
+     * O(1) asymptotic complexity
+     */
+    bool contains(size_t index) const;
+
+    /**
+     * Returns the element at the given index
+     * Throws an error if the index does not hold a live element
+     */
+    T& check(size_t index);
+    const T& check(size_t index) const;
+
+    /**
+     * Returns a pointer to the element at the given index,
+     * or nullptr if the index does not hold a live element
+     */
+    T* tryAt(size_t index);
+    const T* tryAt(size_t index) const;
+
+    // Compaction ––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Slides every live element down over the tombstones, keeping
+     * their order, and returns the remap: entry i is the new index
+     * of the element that was at i, or erased. Finishes a pass that
+     * compactStep started, with the remap covering the whole pass.
+     * O(N) asymptotic complexity in the slots
+     */
+    Vector<size_t> compact();
+
+    /**
+     * Advances the compaction pass by up to budget slots, starting
+     * a new pass if none is under way. Returns true once the pass
+     * has finished, leaving its remap in remap().
+     */
+    bool compactStep(size_t budget);
+
+    /**
+     * Returns true while a compactStep pass is under way
+     */
+    bool compacting() const;
+
+    /**
+     * Returns the remap of the current or last compactStep pass; entry
+     * i is where the element at i before the pass is now, or erased
+     */
+    const Vector<size_t>& remap() const;
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the element at the given index
+     * Throws an error if the index does not hold a live element
+     */
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+
+    /**
+     * Copy Assignment
+     */
+    StableIndexVector& operator=(const StableIndexVector& assign);
+
+    /**
+     * Move Assignment
+     */
+    StableIndexVector& operator=(StableIndexVector&& assign);
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator to the first live element
+     */
+    iterator begin();
+
+    /**
+     * Iterator past the last slot
+     */
+    iterator end();
+
+    /**
+     * Const iterator to the first live element
+     */
+    const_iterator begin() const;
+
+    /**
+     * Const iterator past the last slot
+     */
+    const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two lists, returns true if they hold equal
+     * elements at the same indexes
+     */
+    template <typename T_>
+    friend bool operator==(const StableIndexVector<T_>& first, const StableIndexVector<T_>& second);
+
+    /**
+     * Given two lists, returns true if they don't hold
+     * equal elements at the same indexes
+     */
+    template <typename T_>
+    friend bool operator!=(const StableIndexVector<T_>& first, const StableIndexVector<T_>& second);
+
+    /**
+     * Walks the live elements in index order
+     */
+    template <bool Const>
+    class slotIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+
+        slotIterator() : _list(nullptr), _index(0) { }
+
+        /** Every iterator converts to a const_iterator */
+        operator slotIterator<true>() const { return slotIterator<true>(_list, _index); }
+
+        reference operator*() const { return _list->_slots[_index]; }
+        pointer operator->() const { return _list->_slots + _index; }
+
+        /** The index of the element pointed to */
+        size_t index() const { return _index; }
+
+        slotIterator& operator++() {
+            _index = _list->nextLive(_index + 1);
+            return *this;
+        }
+
+        slotIterator operator++(int) {
+            slotIterator before = *this;
+            ++*this;
+            return before;
+        }
+
+        bool operator==(const slotIterator& other) const { return _index == other._index; }
+        bool operator!=(const slotIterator& other) const { return _index != other._index; }
+
+    private:
+        friend class StableIndexVector;
+
+        template <bool>
+        friend class slotIterator;
+
+        slotIterator(const StableIndexVector* list, size_t index) : _list(list), _index(index) { }
+
+        const StableIndexVector* _list;
+        size_t _index;
+    };
+
+private:
+    /** Slots per bitmap word */
+    static constexpr size_t wordBits = 64;
+
+    /* the elements, constructed only in live slots */
+    T* _slots;
+
+    /* the slots handed out */
+    size_t _end;
+
+    /* the slots there is room for */
+    size_t _capacity;
+
+    /* the live slots */
+    size_t _size;
+
+    /* one bit per slot of capacity, set for live slots */
+    Vector<uint64_t> _live;
+
+    /* true while a compactStep pass is under way */
+    bool _compacting;
+
+    /* the next slot the pass will look at */
+    size_t _read;
+
+    /* the slot the pass will move the next live element to */
+    size_t _write;
+
+    /* where each slot from before the pass went */
+    Vector<size_t> _remap;
+
+    /**
+     * Returns the first live index at or after from, or slots()
+     */
+    size_t nextLive(size_t from) const;
+
+    /**
+     * Sets or clears the live bit of a slot
+     */
+    void mark(size_t index, bool live);
+
+    /**
+     * Returns the slot for the next addBack, growing if full
+     */
+    T* claim();
+
+    /**
+     * Moves the live elements into a buffer of the given capacity,
+     * keeping their indexes
+     */
+    void regrow(size_t capacity);
+};
+
+#include "stable-index-vector.cpp"
@@ -0,0 +1,225 @@
+/**
+ * Created on October 19, 2026. Storage<T> gathers the raw
+ * memory operations behind BII's contiguous containers:
+ * allocating uninitialized buffers, constructing and
+ * destroying elements in place, and relocating elements
+ * from one buffer to another when a container grows.
+ *
+ * Buffers handed out by allocate hold no live elements;
+ * containers construct into them and destroy out of them
+ * themselves, so unused capacity never costs a default
+ * construction.
+ *
+ * Under C++20 every operation is constexpr (through
+ * std::allocator, std::construct_at, and std::destroy_at),
+ * which is what lets Vector<T> run at compile time.
+ *
+ * With BII_BUFFER_CACHE defined, buffers allocated at run time
+ * come from the calling thread's bufferCache (see buffer-cache.h).
+ */
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "buffer-cache.h"
+
+/**
+ * Expands to constexpr when the compiler supports constexpr
+ * allocation (C++20). Instrumentation keeps global counters,
+ * which cannot be touched at compile time, so BII_STATS
+ * turns it off.
+ */
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L && !defined(BII_STATS)
+#define BII_CONSTEXPR constexpr
+#define BII_HAS_CONSTEXPR_VECTOR 1
+#else
+#define BII_CONSTEXPR
+#endif
+
+/**
+ * True while the enclosing call is being evaluated at
+ * compile time. Always false before C++20.
+ */
+constexpr bool biiConstantEvaluated() {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+struct Storage {
+    /**
+     * Returns an uninitialized buffer with room for count
+     * elements, or nullptr when count is 0
+     */
+    static BII_CONSTEXPR T* allocate(size_t count) {
+        if (count == 0) {
+            return nullptr;
+        }
+#ifdef BII_BUFFER_CACHE
+        if (cacheable() && !biiConstantEvaluated()) {
+            return static_cast<T*>(bufferCache::allocate(count * sizeof(T)));
+        }
+#endif
+        return std::allocator<T>().allocate(count);
+    }
+
+    /**
+     * Returns a buffer obtained from allocate. Any elements
+     * in it must already have been destroyed.
+     */
+    static BII_CONSTEXPR void deallocate(T* buffer, size_t count) {
+        if (buffer == nullptr) {
+            return;
+        }
+#ifdef BII_BUFFER_CACHE
+        if (cacheable() && !biiConstantEvaluated()) {
+            bufferCache::deallocate(buffer, count * sizeof(T));
+            return;
+        }
+#endif
+        std::allocator<T>().deallocate(buffer, count);
+    }
+
+    /**
+     * Constructs an element in the given uninitialized slot
+     */
+    template <typename... Args>
+    static BII_CONSTEXPR void construct(T* slot, Args&&... args) {
+#ifdef BII_HAS_CONSTEXPR_VECTOR
+        std::construct_at(slot, std::forward<Args>(args)...);
+#else
+        ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+#endif
+    }
+
+    /**
+     * Destroys the elements in [first, last)
+     */
+    static BII_CONSTEXPR void destroy(T* first, T* last) {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    /**
+     * Copy constructs the elements in [first, last) into the
+     * uninitialized buffer starting at destination. If a copy
+     * throws, the elements already copied are destroyed.
+     */
+    template <typename Iterator>
+    static BII_CONSTEXPR T* copy(Iterator first, Iterator last, T* destination) {
+        rollback guard(destination);
+        for (; first != last; ++first, ++guard.current) {
+            construct(guard.current, *first);
+        }
+        return guard.release();
+    }
+
+    /**
+     * Move constructs the elements in [first, last) into the
+     * uninitialized buffer starting at destination
+     */
+    static BII_CONSTEXPR T* move(T* first, T* last, T* destination) {
+        rollback guard(destination);
+        for (; first != last; ++first, ++guard.current) {
+            construct(guard.current, std::move(*first));
+        }
+        return guard.release();
+    }
+
+    /**
+     * Constructs count copies of value in the uninitialized
+     * buffer starting at destination
+     */
+    static BII_CONSTEXPR T* fill(T* destination, size_t count, const T& value) {
+        rollback guard(destination);
+        for (size_t i = 0; i < count; i++, ++guard.current) {
+            construct(guard.current, value);
+        }
+        return guard.release();
+    }
+
+    /**
+     * Default-initializes count elements in the uninitialized buffer
+     * starting at destination. Trivial elements are left as they are,
+     * except during constant evaluation, which forbids reading them.
+     */
+    static BII_CONSTEXPR T* defaultConstruct(T* destination, size_t count) {
+        if (std::is_trivially_default_constructible<T>::value && !biiConstantEvaluated()) {
+            return destination + count;
+        }
+        rollback guard(destination);
+        for (size_t i = 0; i < count; i++, ++guard.current) {
+            construct(guard.current);
+        }
+        return guard.release();
+    }
+
+    /**
+     * True when relocate moves elements rather than copying them
+     */
+    static constexpr bool relocatesByMove() {
+        return std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value;
+    }
+
+    /**
+     * Moves the elements in [first, last) into the uninitialized
+     * buffer starting at destination and destroys the originals.
+     * Falls back to copying when moving could throw, so a failed
+     * relocation leaves the source intact.
+     */
+    static BII_CONSTEXPR void relocate(T* first, T* last, T* destination) {
+        if (std::is_trivially_copyable<T>::value && !biiConstantEvaluated()) {
+            if (first != last) {
+                std::memcpy(static_cast<void*>(destination), static_cast<const void*>(first),
+                            (last - first) * sizeof(T));
+            }
+            return;
+        }
+        if constexpr (relocatesByMove()) {
+            move(first, last, destination);
+        } else {
+            copy(first, last, destination);
+        }
+        destroy(first, last);
+    }
+
+private:
+#ifdef BII_BUFFER_CACHE
+    /**
+     * True when plain operator new memory is aligned enough for T
+     */
+    static constexpr bool cacheable() {
+        return alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+#endif
+
+    /**
+     * Destroys a partially constructed range unless released,
+     * so a throwing constructor cannot leak elements
+     */
+    struct rollback {
+        T* first;
+        T* current;
+
+        BII_CONSTEXPR explicit rollback(T* start) : first(start), current(start) { }
+
+        BII_CONSTEXPR T* release() {
+            T* end = current;
+            first = current;
+            return end;
+        }
+
+        BII_CONSTEXPR ~rollback() {
+            destroy(first, current);
+        }
+    };
+};
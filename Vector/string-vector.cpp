@@ -0,0 +1,348 @@
+/**
+ * Created on October 19, 2026. Function
+ * definitions for the string-vector.h class
+ */
+#pragma once
+#include "string-vector.h"
+
+// Private Functions –––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+std::string_view BasicStringVector<Offset>::view(size_t index) const {
+    const Offset* ends = _ends.begin();
+    size_t start = index == 0 ? 0 : ends[index - 1];
+    return std::string_view(_blob + start, ends[index] - start);
+}
+
+template <typename Offset>
+void BasicStringVector<Offset>::regrow(size_t capacity) {
+    char* blob = Storage<char>::allocate(capacity);
+    if (_bytes != 0) {
+        std::memcpy(blob, _blob, _bytes);
+    }
+    Storage<char>::deallocate(_blob, _capacity);
+    _blob = blob;
+    _capacity = capacity;
+}
+
+// Constructors/Destructor –––––––––––––––––––––––––––––––
+
+template <typename Offset>
+BasicStringVector<Offset>::BasicStringVector() :
+    _blob(nullptr), _bytes(0), _capacity(0), _ends() { }
+
+template <typename Offset>
+BasicStringVector<Offset>::BasicStringVector(const Vector<std::string>& strings) :
+    _blob(nullptr), _bytes(0), _capacity(0), _ends(strings.empty() ? initialCapacity : int(strings.size())) {
+    size_t total = 0;
+    for (const std::string& text : strings) {
+        total += text.size();
+    }
+    reserve(total);
+    for (const std::string& text : strings) {
+        addBack(text);
+    }
+}
+
+template <typename Offset>
+BasicStringVector<Offset>::BasicStringVector(const BasicStringVector& other) :
+    _blob(Storage<char>::allocate(other._bytes)), _bytes(other._bytes), _capacity(other._bytes), _ends(other._ends) {
+    if (_bytes != 0) {
+        std::memcpy(_blob, other._blob, _bytes);
+    }
+}
+
+template <typename Offset>
+BasicStringVector<Offset>::BasicStringVector(BasicStringVector&& other) :
+    _blob(other._blob), _bytes(other._bytes), _capacity(other._capacity), _ends(move(other._ends)) {
+    other._blob = nullptr;
+    other._bytes = 0;
+    other._capacity = 0;
+}
+
+template <typename Offset>
+BasicStringVector<Offset>::~BasicStringVector() {
+    Storage<char>::deallocate(_blob, _capacity);
+}
+
+// Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+inline size_t BasicStringVector<Offset>::size() const {
+    return _ends.size();
+}
+
+template <typename Offset>
+inline bool BasicStringVector<Offset>::empty() const {
+    return _ends.empty();
+}
+
+template <typename Offset>
+inline size_t BasicStringVector<Offset>::bytes() const {
+    return _bytes;
+}
+
+template <typename Offset>
+void BasicStringVector<Offset>::reserve(size_t characters) {
+    if (_bytes + characters > _capacity) {
+        regrow(_bytes + characters);
+    }
+}
+
+// Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+BasicStringVector<Offset>& BasicStringVector<Offset>::addBack(std::string_view text) {
+    if (text.size() > static_cast<Offset>(-1) - _bytes) {
+        cout << "addBack failed\n";
+        BII_THROW(std::length_error("StringVector offsets would overflow"));
+    }
+    if (_bytes + text.size() > _capacity) {
+        // text may view this blob, so find it again after the move
+        bool inside = _blob != nullptr && text.data() >= _blob && text.data() < _blob + _bytes;
+        size_t start = inside ? static_cast<size_t>(text.data() - _blob) : 0;
+        size_t doubled = _capacity == 0 ? 64 : _capacity * 2;
+        regrow(std::max(doubled, _bytes + text.size()));
+        if (inside) {
+            text = std::string_view(_blob + start, text.size());
+        }
+    }
+    if (!text.empty()) {
+        std::memmove(_blob + _bytes, text.data(), text.size());
+    }
+    _bytes += text.size();
+    _ends.addBack(static_cast<Offset>(_bytes));
+    return *this;
+}
+
+template <typename Offset>
+std::string BasicStringVector<Offset>::removeBack() {
+    if (empty()) {
+        cout << "removeBack failed\n";
+        BII_THROW(empty_vector());
+    }
+    std::string text(view(size() - 1));
+    _ends.removeBack();
+    _bytes = empty() ? 0 : _ends.back();
+    return text;
+}
+
+template <typename Offset>
+BasicStringVector<Offset>& BasicStringVector<Offset>::clear() {
+    _ends.clear();
+    _bytes = 0;
+    return *this;
+}
+
+// Element Viewing –––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+std::string_view BasicStringVector<Offset>::check(size_t index) const {
+    if (index >= size()) {
+        cout << "Check failed\n";
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+    }
+    return view(index);
+}
+
+template <typename Offset>
+std::string_view BasicStringVector<Offset>::front() const {
+    if (empty()) {
+        cout << "front failed\n";
+        BII_THROW(empty_vector());
+    }
+    return view(0);
+}
+
+template <typename Offset>
+std::string_view BasicStringVector<Offset>::back() const {
+    if (empty()) {
+        cout << "back failed\n";
+        BII_THROW(empty_vector());
+    }
+    return view(size() - 1);
+}
+
+template <typename Offset>
+std::optional<std::string_view> BasicStringVector<Offset>::tryAt(size_t index) const {
+    if (index >= size()) {
+        return std::nullopt;
+    }
+    return view(index);
+}
+
+// Sorting –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+Vector<size_t> BasicStringVector<Offset>::order() const {
+    return order([](std::string_view left, std::string_view right) { return left < right; });
+}
+
+template <typename Offset>
+template <typename Compare>
+Vector<size_t> BasicStringVector<Offset>::order(Compare compare) const {
+    Vector<size_t> indexes(static_cast<int>(size()), [](size_t i) { return i; });
+    // the index array is small and moves cheaply; the strings never move
+    std::stable_sort(indexes.begin(), indexes.end(), [&](size_t left, size_t right) {
+        return compare(view(left), view(right));
+    });
+    return indexes;
+}
+
+template <typename Offset>
+BasicStringVector<Offset>& BasicStringVector<Offset>::sort() {
+    return permute(order());
+}
+
+template <typename Offset>
+template <typename Compare>
+BasicStringVector<Offset>& BasicStringVector<Offset>::sort(Compare compare) {
+    return permute(order(compare));
+}
+
+template <typename Offset>
+BasicStringVector<Offset>& BasicStringVector<Offset>::permute(const Vector<size_t>& permutation) {
+    if (permutation.size() != size()) {
+        cout << "permute failed\n";
+        BII_THROW(std::invalid_argument("permutation size does not match"));
+    }
+    // every index must appear once, or the strings would not fit the blob
+    Vector<uint64_t> seen(static_cast<int>((size() + 63) / 64), uint64_t(0));
+    uint64_t* bits = seen.begin();
+    for (size_t index : permutation) {
+        if (index >= size()) {
+            cout << "permute failed\n";
+            BII_THROW(std::out_of_range("Trying to access index outside of vector"));
+        }
+        uint64_t bit = uint64_t(1) << (index % 64);
+        if (bits[index / 64] & bit) {
+            cout << "permute failed\n";
+            BII_THROW(std::invalid_argument("permutation repeats an index"));
+        }
+        bits[index / 64] |= bit;
+    }
+    Vector<Offset> ends(static_cast<int>(size()), forOverwrite);
+    char* blob = Storage<char>::allocate(_capacity);
+    Offset* written = ends.begin();
+    size_t position = 0;
+    for (size_t index : permutation) {
+        std::string_view text = view(index);
+        if (!text.empty()) {
+            std::memcpy(blob + position, text.data(), text.size());
+        }
+        position += text.size();
+        *written++ = static_cast<Offset>(position);
+    }
+    Storage<char>::deallocate(_blob, _capacity);
+    _blob = blob;
+    _bytes = position;
+    _ends = move(ends);
+    return *this;
+}
+
+// Serialization –––––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+void BasicStringVector<Offset>::serialize(std::ostream& out) const {
+    uint64_t header[2] = {static_cast<uint64_t>(size()), static_cast<uint64_t>(_bytes)};
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(_ends.begin()), static_cast<std::streamsize>(size() * sizeof(Offset)));
+    out.write(_blob, static_cast<std::streamsize>(_bytes));
+}
+
+template <typename Offset>
+BasicStringVector<Offset> BasicStringVector<Offset>::deserialize(std::istream& in) {
+    uint64_t header[2] = {0, 0};
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!in || header[0] > static_cast<uint64_t>(std::numeric_limits<int>::max()) || header[1] > static_cast<Offset>(-1)) {
+        cout << "deserialize failed\n";
+        BII_THROW(std::runtime_error("StringVector header is missing or too large"));
+    }
+    BasicStringVector list;
+    list._ends = Vector<Offset>(header[0] == 0 ? initialCapacity : static_cast<int>(header[0]), forOverwrite);
+    if (header[0] == 0) {
+        list._ends.clear();
+    }
+    in.read(reinterpret_cast<char*>(list._ends.begin()), static_cast<std::streamsize>(header[0] * sizeof(Offset)));
+    list.reserve(header[1]);
+    in.read(list._blob, static_cast<std::streamsize>(header[1]));
+    // the ends must climb from 0 to the byte count
+    bool consistent = static_cast<bool>(in);
+    const Offset* ends = list._ends.begin();
+    for (size_t i = 0; consistent && i < header[0]; i++) {
+        consistent = ends[i] <= header[1] && (i == 0 || ends[i - 1] <= ends[i]);
+    }
+    consistent = consistent && (header[0] == 0 ? header[1] == 0 : ends[header[0] - 1] == header[1]);
+    if (!consistent) {
+        cout << "deserialize failed\n";
+        BII_THROW(std::runtime_error("StringVector data is truncated or inconsistent"));
+    }
+    list._bytes = header[1];
+    return list;
+}
+
+// Operators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+std::string_view BasicStringVector<Offset>::operator[](size_t index) const {
+    return check(index);
+}
+
+template <typename Offset>
+BasicStringVector<Offset>& BasicStringVector<Offset>::operator=(const BasicStringVector& assign) {
+    if (&assign == this) return *this;
+    if (assign._bytes > _capacity) {
+        Storage<char>::deallocate(_blob, _capacity);
+        _blob = Storage<char>::allocate(assign._bytes);
+        _capacity = assign._bytes;
+    }
+    if (assign._bytes != 0) {
+        std::memcpy(_blob, assign._blob, assign._bytes);
+    }
+    _bytes = assign._bytes;
+    _ends = assign._ends;
+    return *this;
+}
+
+template <typename Offset>
+BasicStringVector<Offset>& BasicStringVector<Offset>::operator=(BasicStringVector&& assign) {
+    if (&assign == this) return *this;
+    Storage<char>::deallocate(_blob, _capacity);
+    _blob = assign._blob;
+    _bytes = assign._bytes;
+    _capacity = assign._capacity;
+    _ends = move(assign._ends);
+    assign._blob = nullptr;
+    assign._bytes = 0;
+    assign._capacity = 0;
+    return *this;
+}
+
+// Iterators –––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename Offset>
+typename BasicStringVector<Offset>::const_iterator BasicStringVector<Offset>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template <typename Offset>
+typename BasicStringVector<Offset>::const_iterator BasicStringVector<Offset>::end() const {
+    return const_iterator(this, size());
+}
+
+// Friends –––––––––––––––––––––––––––––––––––––––––––––––
+
+template <typename O_>
+bool operator==(const BasicStringVector<O_>& first, const BasicStringVector<O_>& second) {
+    // equal ends and equal blobs mean equal strings
+    if (first.size() != second.size() || first._bytes != second._bytes) {
+        return false;
+    }
+    return std::equal(first._ends.begin(), first._ends.end(), second._ends.begin())
+        && (first._bytes == 0 || std::memcmp(first._blob, second._blob, first._bytes) == 0);
+}
+
+template <typename O_>
+bool operator!=(const BasicStringVector<O_>& first, const BasicStringVector<O_>& second) {
+    return !(first == second);
+}
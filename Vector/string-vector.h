@@ -0,0 +1,318 @@
+/**
+ * Created on October 19, 2026. BasicStringVector<Offset> is a
+ * list of strings packed into one character buffer, for use in
+ * projects by BII.
+ *
+ * Every string's characters are appended to a single growing blob,
+ * and a Vector<Offset> records where each string ends, so the whole
+ * list is two allocations no matter how many strings it holds. Strings
+ * are read back as std::string_view into the blob. Growing, copying,
+ * and serializing move the blob with memcpy instead of visiting a heap
+ * string per element, and scanning the strings in order reads memory
+ * front to back.
+ *
+ * Offset bounds the total bytes: StringVector (uint32_t offsets)
+ * holds up to 4 GiB of characters, LargeStringVector (uint64_t) more.
+ * Views stay valid until the next addBack, sort, or assignment.
+ *
+ * Sorting is by indirection: order() sorts an index array by the
+ * strings it points at, and sort() then rebuilds the blob in that
+ * order in one pass, moving each string's characters exactly once.
+ *
+ * @version 1.0.0: October 19, 2026
+ * Added BasicStringVector with addBack, removeBack, clear, reserve,
+ * [], check, front, back, tryAt, order, sort, serialize, deserialize,
+ * iterators, ==, and !=.
+ */
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "../Exceptions/exception.h"
+#include "storage.h"
+#include "vector.h"
+
+template <typename Offset>
+class BasicStringVector {
+    static_assert(std::is_unsigned<Offset>::value, "offsets must be an unsigned integer type");
+
+public:
+    class const_iterator;
+    using iterator = const_iterator;
+
+    // Constructors/Destructor –––––––––––––––––––––––––––––––
+    /**
+     * Default Constructor
+     * Creates an empty list without allocating characters
+     */
+    BasicStringVector();
+
+    /**
+     * Creates a list holding copies of the given strings, with
+     * the blob allocated once at the exact total size
+     */
+    explicit BasicStringVector(const Vector<std::string>& strings);
+
+    /**
+     * Copy Constructor
+     * O(N) asymptotic complexity in the total bytes
+     */
+    BasicStringVector(const BasicStringVector& other);
+
+    /**
+     * Move Constructor
+     * O(1) asymptotic complexity
+     */
+    BasicStringVector(BasicStringVector&& other);
+
+    /**
+     * Destructor
+     */
+    ~BasicStringVector();
+
+    // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the number of strings
+     * O(1) asymptotic complexity
+     */
+    inline size_t size() const;
+
+    /**
+     * Returns true if there are no strings
+     * O(1) asymptotic complexity
+     */
+    inline bool empty() const;
+
+    /**
+     * Returns the total number of characters held
+     * O(1) asymptotic complexity
+     */
+    inline size_t bytes() const;
+
+    /**
+     * Makes room for the given number of characters
+     * beyond those already held
+     */
+    void reserve(size_t characters);
+
+    // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Appends a copy of the given characters
+     * Throws an error if the offsets would overflow
+     * O(length) amortized asymptotic complexity
+     */
+    BasicStringVector& addBack(std::string_view text);
+
+    /**
+     * Removes and returns the last string
+     * Throws an error if the list is empty
+     */
+    std::string removeBack();
+
+    /**
+     * Removes every string, keeping the blob
+     */
+    BasicStringVector& clear();
+
+    // Element Viewing –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the string at the given index
+     * Throws an error for invalid indexes
+     * O(1) asymptotic complexity
+     */
+    std::string_view check(size_t index) const;
+
+    /**
+     * Views the first string
+     * Throws an error if the list is empty
+     */
+    std::string_view front() const;
+
+    /**
+     * Views the last string
+     * Throws an error if the list is empty
+     */
+    std::string_view back() const;
+
+    /**
+     * Views the string at the given index,
+     * or returns nothing for invalid indexes
+     */
+    std::optional<std::string_view> tryAt(size_t index) const;
+
+    // Sorting –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the indexes of the strings in ascending
+     * order, leaving the strings where they are
+     * O(N log N) string comparisons
+     */
+    Vector<size_t> order() const;
+
+    /**
+     * Returns the indexes of the strings ordered by the given
+     * comparison of two string_views
+     */
+    template <typename Compare>
+    Vector<size_t> order(Compare compare) const;
+
+    /**
+     * Sorts the strings in ascending order, rebuilding
+     * the blob once
+     */
+    BasicStringVector& sort();
+
+    /**
+     * Sorts the strings by the given comparison of two string_views
+     */
+    template <typename Compare>
+    BasicStringVector& sort(Compare compare);
+
+    /**
+     * Rearranges the strings so that the i-th is the one that was
+     * at index permutation[i], rebuilding the blob once
+     * Throws an error if permutation has the wrong size, an index
+     * outside the list, or an index more than once
+     */
+    BasicStringVector& permute(const Vector<size_t>& permutation);
+
+    // Serialization –––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Writes the list as its string count, its byte count, the
+     * end offset of every string, and then the blob, each in
+     * native byte order
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * Reads a list written by serialize with the same Offset
+     * Throws an error if the stream ends early or is inconsistent
+     */
+    static BasicStringVector deserialize(std::istream& in);
+
+    // Operators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Views the string at the given index
+     * Throws an error for invalid indexes
+     */
+    std::string_view operator[](size_t index) const;
+
+    /**
+     * Copy Assignment
+     */
+    BasicStringVector& operator=(const BasicStringVector& assign);
+
+    /**
+     * Move Assignment
+     */
+    BasicStringVector& operator=(BasicStringVector&& assign);
+
+    // Iterators –––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Iterator to the first string
+     */
+    const_iterator begin() const;
+
+    /**
+     * Iterator past the last string
+     */
+    const_iterator end() const;
+
+    // Friends –––––––––––––––––––––––––––––––––––––––––––––––
+    /**
+     * Given two lists, returns true if they hold
+     * the same strings in the same order
+     */
+    template <typename O_>
+    friend bool operator==(const BasicStringVector<O_>& first, const BasicStringVector<O_>& second);
+
+    /**
+     * Given two lists, returns true if they don't hold
+     * the same strings in the same order
+     */
+    template <typename O_>
+    friend bool operator!=(const BasicStringVector<O_>& first, const BasicStringVector<O_>& second);
+
+    /**
+     * Walks the strings in order, giving string_views
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::string_view;
+        using pointer = void;
+
+        const_iterator() : _list(nullptr), _index(0) { }
+
+        std::string_view operator*() const { return _list->view(_index); }
+        std::string_view operator[](difference_type offset) const { return _list->view(_index + offset); }
+
+        const_iterator& operator++() { _index++; return *this; }
+        const_iterator operator++(int) { const_iterator before = *this; _index++; return before; }
+        const_iterator& operator--() { _index--; return *this; }
+        const_iterator operator--(int) { const_iterator before = *this; _index--; return before; }
+        const_iterator& operator+=(difference_type offset) { _index += offset; return *this; }
+        const_iterator& operator-=(difference_type offset) { _index -= offset; return *this; }
+        const_iterator operator+(difference_type offset) const { return const_iterator(_list, _index + offset); }
+        const_iterator operator-(difference_type offset) const { return const_iterator(_list, _index - offset); }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+        }
+
+        bool operator==(const const_iterator& other) const { return _index == other._index; }
+        bool operator!=(const const_iterator& other) const { return _index != other._index; }
+        bool operator<(const const_iterator& other) const { return _index < other._index; }
+        bool operator>(const const_iterator& other) const { return _index > other._index; }
+        bool operator<=(const const_iterator& other) const { return _index <= other._index; }
+        bool operator>=(const const_iterator& other) const { return _index >= other._index; }
+
+    private:
+        friend class BasicStringVector;
+
+        const_iterator(const BasicStringVector* list, size_t index) : _list(list), _index(index) { }
+
+        const BasicStringVector* _list;
+        size_t _index;
+    };
+
+private:
+    /* the characters of every string, back to back */
+    char* _blob;
+
+    /* the characters in use */
+    size_t _bytes;
+
+    /* the characters the blob has room for */
+    size_t _capacity;
+
+    /* where each string ends; the i-th string is [_ends[i - 1], _ends[i]) */
+    Vector<Offset> _ends;
+
+    /**
+     * Views the string at an index known to be valid
+     */
+    std::string_view view(size_t index) const;
+
+    /**
+     * Moves the blob into a buffer of the given capacity
+     */
+    void regrow(size_t capacity);
+};
+
+/** Strings of up to 4 GiB of characters in total */
+using StringVector = BasicStringVector<uint32_t>;
+
+/** Strings of any total size */
+using LargeStringVector = BasicStringVector<uint64_t>;
+
+#include "string-vector.cpp"
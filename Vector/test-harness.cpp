@@ -5,8 +5,22 @@
  * 
  */
 #include "vector.h"
+#include "string-vector.h"
+#include "stable-index-vector.h"
+#include "immutable-vector.h"
+#include "jagged-vector.h"
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
 
 using std::cout;
 using std::endl;
@@ -20,15 +34,21 @@ using std::endl;
 #define BOLDBLUE "\033[1m\033[34m"
 
 // Test Settings
-const bool section_A = true; // Constructors/Destructor (6 Methods)
+const bool section_A = true; // Constructors/Destructor (11 Methods)
 const bool section_B = true; // Capacity (4 Methods)
-const bool section_C = true; // Modifiers (8 Methods)
-const bool section_D = true; // Element Viewing (6 Methods)
-const bool section_E = true; // Memory Handling (3 Methods)
+const bool section_C = true; // Modifiers (9 Methods)
+const bool section_D = true; // Element Viewing (14 Methods)
+const bool section_E = true; // Memory Handling (6 Methods)
 const bool section_F = true; // Operators (7 Methods)
-const bool section_G = true; // Iterators (8 Methods)
+const bool section_G = true; // Iterators (12 Methods)
 const bool section_H = true; // Friends (3 Methods)
 const bool section_I = true; // Non-Members (4 Methods)
+const bool section_J = true; // Instrumentation (5 Methods, needs -DBII_STATS)
+const bool section_K = true; // Buffer Cache (6 Methods, needs -DBII_BUFFER_CACHE)
+const bool section_L = true; // String Vector (9 Methods)
+const bool section_M = true; // Stable Index Vector (8 Methods)
+const bool section_N = true; // Immutable Vector (8 Methods)
+const bool section_O = true; // Jagged Vector (7 Methods)
 
 /** 
  * Given two values, returns true if they are equal
@@ -88,6 +108,110 @@ void testA(const int size, int& numTestsPassed, int& numTestsFailed) {
         cout << "Fill Constructor (B) : PASSED" << endl;
         numTestsPassed++;
     }
+
+    // test initializer list construction
+    Vector<std::string> names = {"Ada", "Grace", "Barbara"};
+    Vector<int> single{size};
+    if (!expectEqual(names.size(), 3) || !expectEqual(names.capacity(), 3) || !expectEqual(names[2], "Barbara")
+        || !expectEqual(single.size(), 1) || !expectEqual(single[0], size)) {
+        cout << "Initializer List Constructor : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Initializer List Constructor : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test range construction, from forward and single-pass iterators
+    std::vector<int> source;
+    for (int i = 0; i < size; i++) {
+        source.push_back(i * 3);
+    }
+    Vector<int> range(source.begin(), source.end());
+    Vector<int> inner(vec.begin() + size / 2, vec.end());
+    std::istringstream stream("4 8 15 16 23 42");
+    Vector<int> streamed((std::istream_iterator<int>(stream)), std::istream_iterator<int>());
+    if (!expectEqual(range.size(), size) || !expectEqual(range.capacity(), size)
+        || !std::equal(source.begin(), source.end(), range.begin()) || !expectEqual(inner.size(), size - size / 2)
+        || !expectEqual(inner.front(), size / 2) || !expectEqual(streamed.size(), 6) || !expectEqual(streamed.back(), 42)) {
+        cout << "Range Constructor : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Range Constructor : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test generator construction, with and without an index
+    Vector<long long> squares(size, [](size_t i) { return (long long)i * i; });
+    int counter = 0;
+    Vector<std::string> labels(3, [&counter]() { return std::to_string(counter++); });
+    if (!expectEqual(squares.size(), size) || !expectEqual(squares.capacity(), size)
+        || !expectEqual(squares[randomVal], (long long)randomVal * randomVal) || !expectEqual(labels[2], "2")) {
+        cout << "Generator Constructor : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Generator Constructor : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test for-overwrite construction
+    Vector<int> scratch(size, forOverwrite);
+    for (int i = 0; i < size; i++) {
+        scratch[i] = size - i;
+    }
+    Vector<std::string> blanks(size, forOverwrite);
+    if (!expectEqual(scratch.size(), size) || !expectEqual(scratch.capacity(), size)
+        || !expectEqual(scratch[randomVal], size - randomVal) || !expectEqual(blanks[randomVal], "")) {
+        cout << "For-Overwrite Constructor : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "For-Overwrite Constructor : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that constructors which throw partway destroy what they built
+    struct fragile {
+        int* live;
+        explicit fragile(int* count) : live(count) { ++*live; }
+        fragile(const fragile& other) : live(other.live) {
+            if (*live >= 70) {
+                throw std::runtime_error("copy failed");
+            }
+            ++*live;
+        }
+        ~fragile() { --*live; }
+    };
+    int live = 0;
+    int thrown = 0;
+    try {
+        Vector<std::shared_ptr<int>> partial(100, [&live](size_t i) {
+            if (i == 50) {
+                throw std::runtime_error("generator failed");
+            }
+            live++;
+            return std::shared_ptr<int>(new int(static_cast<int>(i)), [&live](int* value) { live--; delete value; });
+        });
+    } catch (const std::runtime_error&) {
+        thrown++;
+    }
+    {
+        std::vector<fragile> originals;
+        originals.reserve(60);
+        for (int i = 0; i < 60; i++) {
+            originals.emplace_back(&live);
+        }
+        try {
+            Vector<fragile> copied(originals.begin(), originals.end());
+        } catch (const std::runtime_error&) {
+            thrown++;
+        }
+    }
+    if (!expectEqual(thrown, 2) || !expectEqual(live, 0)) {
+        cout << "Constructors (throwing) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Constructors (throwing) : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
@@ -126,8 +250,10 @@ void testB(const int size, int& numTestsPassed, int& numTestsFailed) {
         numTestsPassed++;
     }
 
+    // a filled vector has no spare room until it grows
     Vector<std::string> first(size, "hello");
-    if (!expectEqual(first.open(), size)) {
+    first.addBack("world");
+    if (!expectEqual(first.open(), first.capacity() - size - 1) || !expectEqual(Vector<int>(size, 0).open(), 0)) {
         cout << "Open : FAILED" << endl;
         numTestsFailed++;
     } else {
@@ -155,9 +281,9 @@ void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
         numTestsPassed++;
     }
 
-    // test remove
-    for (int* iter = vec.rbegin(); iter > vec.rend(); iter--) {
-        vec.remove(iter);
+    // test remove, last element first
+    while (vec.rbegin() != vec.rend()) {
+        vec.remove(&*vec.rbegin());
     }
     if (!expectEqual(vec.size(), 0)) { 
         cout << "Remove : FAILED" << endl;
@@ -193,6 +319,19 @@ void testC(const int size, int& numTestsPassed, int& numTestsFailed) {
         numTestsPassed++;
     }
 
+    // test tryRemoveBack on a full and an empty vector
+    Vector<int> drained;
+    drained.addBack(3);
+    std::optional<int> last = drained.tryRemoveBack();
+    std::optional<int> none = drained.tryRemoveBack();
+    if (!last || !expectEqual(*last, 3) || none || !drained.empty()) {
+        cout << "TryRemoveBack : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "TryRemoveBack : PASSED" << endl;
+        numTestsPassed++;
+    }
+
     // test insert
     vec.insert(7, vec.begin());
     if (!expectEqual(vec[0], 7)) {
@@ -268,6 +407,31 @@ void testD(const int size, int& numTestsPassed, int& numTestsFailed) {
         cout << "Front (const) : PASSED" << endl;
         numTestsPassed++;
     }
+
+    // test the non-throwing views on a full and an empty vector
+    const Vector<int> none;
+    bool viewed = vec.tryAt(0) == &vec[0] && copy.tryAt(size - 1) == &copy[size - 1]
+        && vec.tryAt(size) == nullptr && none.tryAt(0) == nullptr;
+    viewed = viewed && vec.tryFront() == &vec.front() && copy.tryBack() == &copy.back()
+        && none.tryFront() == nullptr && none.tryBack() == nullptr;
+    if (!viewed) {
+        cout << "TryAt/TryFront/TryBack : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "TryAt/TryFront/TryBack : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test data
+    const Vector<int>& constant = vec;
+    if (!expectEqual(vec.data(), vec.begin()) || !expectEqual(constant.data(), constant.begin())
+        || !expectEqual(none.data() + none.size(), none.end())) {
+        cout << "Data : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Data : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
@@ -299,6 +463,80 @@ void testE(const int size, int& numTestsPassed, int& numTestsFailed) {
         cout << "Reduce : PASSED" << endl;
         numTestsPassed++;
     }
+
+    // test clear keeps the capacity
+    size_t capacity = vec.capacity();
+    vec.clear();
+    if (!vec.empty() || !expectEqual(vec.capacity(), capacity)) {
+        cout << "Clear : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Clear : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test release frees the capacity, and the vector stays usable
+    vec.release();
+    vec.addBack(1);
+    if (!expectEqual(vec.size(), 1) || !expectEqual(vec.capacity(), initialCapacity)) {
+        cout << "Release : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Release : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test auto-shrinking only happens below a quarter full
+    Vector<std::string> shrinking;
+    shrinking.autoShrink(true);
+    for (int i = 0; i < size; i++) {
+        shrinking.addBack("Eva");
+    }
+    size_t peak = shrinking.capacity();
+    while (shrinking.size() >= peak / 4) {
+        shrinking.removeBack();
+    }
+    bool shrunk = shrinking.capacity() < peak || peak <= initialCapacity;
+    while (!shrinking.empty()) {
+        shrinking.removeBack();
+    }
+    if (!shrunk || shrinking.capacity() > initialCapacity * 2) {
+        cout << "AutoShrink : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AutoShrink : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that assignment carries the auto-shrink setting over from its source
+    Vector<int> policy(0);
+    policy.autoShrink(true);
+    Vector<int> copiedPolicy;
+    Vector<int> movedPolicy;
+    Vector<int> resetPolicy;
+    copiedPolicy = policy;
+    movedPolicy = Vector<int>(policy);
+    resetPolicy.autoShrink(true);
+    resetPolicy = Vector<int>();
+    bool followed = true;
+    for (Vector<int>* target : {&copiedPolicy, &movedPolicy, &resetPolicy}) {
+        for (int i = 0; i < 1000; i++) {
+            target->addBack(i);
+        }
+        size_t full = target->capacity();
+        while (target->size() > 10) {
+            target->removeBack();
+        }
+        bool shrank = target->capacity() < full;
+        followed = followed && (target == &resetPolicy ? !shrank : shrank);
+    }
+    if (!followed) {
+        cout << "AutoShrink (assignment) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AutoShrink (assignment) : PASSED" << endl;
+        numTestsPassed++;
+    }
 }
 
 /**
@@ -354,15 +592,59 @@ void testG(const int size, int& numTestsPassed, int& numTestsFailed) {
     Vector<std::string> other(size, "Hello, World!");
     
     // test regular reverse iterator
-    std::string* riter = vec.rbegin();
-    riter -= randomVal;
-    if (!expectEqual(*iter, "Hello, World!")) {
+    Vector<int> numbers;
+    for (int i = 0; i < size; i++) {
+        numbers.addBack(i);
+    }
+    int expected = size - 1;
+    bool reversed = true;
+    for (Vector<int>::reverse_iterator riter = numbers.rbegin(); riter != numbers.rend(); ++riter) {
+        reversed = reversed && expectEqual(*riter, expected--);
+    }
+    reversed = reversed && expectEqual(expected, -1) && expectEqual(numbers.rend() - numbers.rbegin(), size)
+        && expectEqual(numbers.rbegin().base(), numbers.end());
+    if (!reversed) {
         cout << "Reverse Iterator : FAILED" << endl;
         numTestsFailed++;
     } else {
         cout << "Reverse Iterator : PASSED" << endl;
         numTestsPassed++;
     }
+
+    // test const reverse iterator with a library algorithm
+    const Vector<int>& constant = numbers;
+    std::vector<int> backwards(constant.crbegin(), constant.crend());
+    if (!expectEqual(backwards.size(), numbers.size()) || !std::equal(backwards.rbegin(), backwards.rend(), constant.cbegin())
+        || !expectEqual(constant.rbegin(), constant.crbegin())) {
+        cout << "Reverse Iterator (const) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Reverse Iterator (const) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // an empty vector has nothing to walk in either direction
+    Vector<int> none;
+    if (none.rbegin() != none.rend() || none.cbegin() != none.cend()) {
+        cout << "Reverse Iterator (empty) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Reverse Iterator (empty) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+#if defined(__cpp_lib_ranges)
+    // test that the standard ranges see a contiguous range
+    static_assert(std::ranges::contiguous_range<Vector<int>>, "Vector should be a contiguous range");
+    static_assert(std::contiguous_iterator<Vector<int>::iterator>, "Vector iterators should be contiguous");
+    if (!expectEqual(std::ranges::distance(numbers), size) || !std::ranges::is_sorted(numbers)) {
+        cout << "Ranges : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Ranges : PASSED" << endl;
+        numTestsPassed++;
+    }
+#endif
 }
 
 /**
@@ -448,6 +730,849 @@ void testI(const int size, int& numTestsPassed, int& numTestsFailed) {
     }
 }
 
+/**
+ * Macro for testing Vector Instrumentation methods
+ */
+void testJ(const int size, int& numTestsPassed, int& numTestsFailed) {
+#ifdef BII_STATS
+    Vector<int>::resetGlobalStats();
+    Vector<int> vec;
+    for (int i = 0; i < size; i++) {
+        vec.addBack(i);
+    }
+
+    // test per-instance counters
+    if (!expectEqual(vec.stats().peakCapacity, vec.capacity()) || vec.stats().expandCalls == 0) {
+        cout << "Stats (instance) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Stats (instance) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test global aggregate
+    Vector<int> copy(vec);
+    container_stats global = Vector<int>::globalStats();
+    if (!expectEqual(global.bytesAllocated, vec.stats().bytesAllocated + copy.stats().bytesAllocated)) {
+        cout << "Stats (global) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Stats (global) : PASSED" << endl;
+        numTestsPassed++;
+    }
+    vec.dumpStats(cout);
+#else
+    cout << "SKIP (compile with -DBII_STATS)" << endl;
+#endif
+}
+
+/**
+ * Macro for testing the Vector buffer cache
+ */
+void testK(const int size, int& numTestsPassed, int& numTestsFailed) {
+#ifdef BII_BUFFER_CACHE
+    bufferCache::trim();
+    bufferCache::resetStats();
+
+    // test that a released buffer is handed to the next vector of its size
+    const int* released;
+    {
+        Vector<int> first(100);
+        released = first.data();
+    }
+    Vector<int> second(100);
+    if (!expectEqual(second.data(), released) || !expectEqual(bufferCache::stats().hits, 1)) {
+        cout << "Reuse : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Reuse : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test the hit rate of vectors built and dropped in a loop
+    bufferCache::resetStats();
+    for (int round = 0; round < 100; round++) {
+        Vector<int> scratch;
+        for (int i = 0; i < 200; i++) {
+            scratch.addBack(i);
+        }
+    }
+    cache_stats loop = bufferCache::stats();
+    if (loop.hitRate() < 0.9 || !expectEqual(loop.hits + loop.misses, loop.kept + loop.released)) {
+        cout << "Stats (hit rate) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Stats (hit rate) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that the cache never holds more than its limit
+    bufferCache::limit(4096);
+    bool bounded = true;
+    {
+        Vector<Vector<int>> held;
+        for (int i = 0; i < 64; i++) {
+            held.addBack(Vector<int>(64 + i));
+        }
+        held.clear();
+        bounded = bufferCache::cachedBytes() <= 4096 && bufferCache::stats().released > 0;
+    }
+    if (!bounded || !expectEqual(bufferCache::limit(), 4096)) {
+        cout << "Limit : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Limit : PASSED" << endl;
+        numTestsPassed++;
+    }
+    bufferCache::limit(bufferCache::defaultLimit);
+
+    // test that trimming returns every cached byte
+    size_t trimmedBefore = bufferCache::stats().trimmedBytes;
+    size_t cached = bufferCache::cachedBytes();
+    bufferCache::trim();
+    if (cached == 0 || !expectEqual(bufferCache::cachedBytes(), 0)
+        || !expectEqual(bufferCache::stats().trimmedBytes, trimmedBefore + cached)) {
+        cout << "Trim : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Trim : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that each thread has a cache of its own, and that a buffer
+    // allocated on one thread can be freed on another
+    Vector<int>* crossing = new Vector<int>(size);
+    size_t mainCached = bufferCache::cachedBytes();
+    cache_stats fresh;
+    size_t otherCached = 0;
+    std::thread other([&] {
+        fresh = bufferCache::stats();
+        delete crossing;
+        otherCached = bufferCache::cachedBytes();
+    });
+    other.join();
+    if (!expectEqual(fresh.hits + fresh.misses, 0) || !expectEqual(bufferCache::cachedBytes(), mainCached)
+        || (size_t(size) * sizeof(int) <= bufferCache::largestBytes && otherCached == 0)) {
+        cout << "Threads : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Threads : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that a zero limit turns caching off
+    bufferCache::limit(0);
+    {
+        Vector<int> uncached(100);
+    }
+    bool off = expectEqual(bufferCache::cachedBytes(), 0);
+    bufferCache::limit(bufferCache::defaultLimit);
+    if (!off) {
+        cout << "Limit (zero) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Limit (zero) : PASSED" << endl;
+        numTestsPassed++;
+    }
+#else
+    cout << "SKIP (compile with -DBII_BUFFER_CACHE)" << endl;
+#endif
+}
+
+/**
+ * Macro for testing StringVector methods
+ */
+void testL(const int size, int& numTestsPassed, int& numTestsFailed) {
+    Vector<std::string> words(size, [](size_t i) { return std::string(i % 7, char('a' + i % 26)) + std::to_string(i); });
+    StringVector list(words);
+
+    // test that every string reads back as it was added
+    bool same = expectEqual(list.size(), size_t(size)) && !list.empty();
+    size_t total = 0;
+    for (int i = 0; i < size; i++) {
+        same = same && expectEqual(list[i], words[i]);
+        total += words[i].size();
+    }
+    if (!same || !expectEqual(list.bytes(), total) || !expectEqual(list.front(), words[0])
+        || !expectEqual(list.back(), words[size - 1])) {
+        cout << "Constructor (Vector) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Constructor (Vector) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test addBack with empty strings and with a view into the list itself
+    StringVector grown;
+    for (int i = 0; i < size; i++) {
+        grown.addBack(i % 3 == 0 ? std::string_view() : std::string_view(words[i]));
+    }
+    grown.addBack(grown.back());
+    grown.addBack(grown[grown.size() - 2]);
+    if (!expectEqual(grown.size(), size_t(size) + 2) || !expectEqual(grown[0], "")
+        || !expectEqual(grown[size], grown[size - 1]) || !expectEqual(grown[size + 1], grown[size - 1])
+        || (size > 1 && !expectEqual(grown[1], words[1]))) {
+        cout << "AddBack : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AddBack : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test removeBack and clear
+    std::string removed = grown.removeBack();
+    size_t bytesLeft = grown.bytes();
+    grown.removeBack();
+    bool shrunk = expectEqual(removed, (size - 1) % 3 == 0 ? std::string() : words[size - 1]) && expectEqual(grown.size(), size_t(size))
+        && expectEqual(bytesLeft - grown.bytes(), removed.size());
+    grown.clear();
+    if (!shrunk || !grown.empty() || !expectEqual(grown.bytes(), 0) || !expectEqual(grown.addBack("x").back(), "x")) {
+        cout << "RemoveBack/Clear : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "RemoveBack/Clear : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test check, tryAt, and the errors for invalid indexes
+    bool threw = false;
+    try {
+        list.check(size);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    bool threwEmpty = false;
+    try {
+        StringVector().front();
+    } catch (const empty_vector&) {
+        threwEmpty = true;
+    }
+    if (!threw || !threwEmpty || list.tryAt(size).has_value() || !expectEqual(*list.tryAt(size - 1), words[size - 1])) {
+        cout << "Check/TryAt : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Check/TryAt : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test sorting by indirection against std::sort
+    Vector<std::string> expected = words;
+    std::sort(expected.begin(), expected.end());
+    Vector<size_t> order = list.order();
+    bool ordered = expectEqual(order.size(), size_t(size));
+    for (int i = 0; ordered && i < size; i++) {
+        ordered = expectEqual(words[order[i]], expected[i]);
+    }
+    StringVector sorted = list;
+    sorted.sort();
+    bool sortedSame = std::equal(sorted.begin(), sorted.end(), expected.begin());
+    sorted.sort([](std::string_view left, std::string_view right) { return left > right; });
+    if (!ordered || !sortedSame || !std::equal(sorted.begin(), sorted.end(), expected.rbegin())
+        || !expectEqual(sorted.bytes(), list.bytes())) {
+        cout << "Order/Sort : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Order/Sort : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that permute refuses repeated and outside indexes and leaves the list alone
+    StringVector three;
+    three.addBack(std::string(100, 'a')).addBack("b").addBack("c");
+    StringVector before = three;
+    int rejected = 0;
+    Vector<size_t> repeated;
+    repeated.addBack(0).addBack(0).addBack(0);
+    Vector<size_t> outside;
+    outside.addBack(0).addBack(1).addBack(3);
+    Vector<size_t> reversed;
+    reversed.addBack(2).addBack(1).addBack(0);
+    try {
+        three.permute(repeated);
+    } catch (const std::invalid_argument&) {
+        rejected++;
+    }
+    try {
+        three.permute(outside);
+    } catch (const std::out_of_range&) {
+        rejected++;
+    }
+    bool unchanged = three == before;
+    three.permute(reversed);
+    if (!expectEqual(rejected, 2) || !unchanged || !expectEqual(three[0], "c") || !expectEqual(three[2], std::string(100, 'a'))) {
+        cout << "Permute (invalid) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Permute (invalid) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that serialize and deserialize round-trip, and that a cut stream is refused
+    std::stringstream stream;
+    list.serialize(stream);
+    std::string written = stream.str();
+    StringVector read = StringVector::deserialize(stream);
+    std::stringstream cut(written.substr(0, written.size() - 1));
+    bool refused = false;
+    try {
+        StringVector::deserialize(cut);
+    } catch (const std::runtime_error&) {
+        refused = true;
+    }
+    std::stringstream wide;
+    LargeStringVector(words).serialize(wide);
+    if (read != list || !refused || !expectEqual(LargeStringVector::deserialize(wide).back(), words[size - 1])) {
+        cout << "Serialize/Deserialize : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Serialize/Deserialize : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test copying, moving, and comparing
+    StringVector copy = list;
+    StringVector moved = std::move(copy);
+    StringVector assigned;
+    assigned = moved;
+    assigned.addBack("extra");
+    if (!(moved == list) || !copy.empty() || assigned == list || !expectEqual(assigned.size(), list.size() + 1)) {
+        cout << "Copy/Move/== : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Copy/Move/== : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that the iterators walk the strings in order
+    bool walked = expectEqual(list.end() - list.begin(), size) && expectEqual(list.begin()[size - 1], words[size - 1]);
+    int at = 0;
+    for (std::string_view text : list) {
+        walked = walked && expectEqual(text, words[at++]);
+    }
+    if (!walked || !expectEqual(at, size)) {
+        cout << "Iterators : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Iterators : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Macro for testing StableIndexVector methods
+ */
+void testM(const int size, int& numTestsPassed, int& numTestsFailed) {
+    StableIndexVector<std::string> list;
+    bool indexed = list.empty();
+    for (int i = 0; i < size; i++) {
+        indexed = indexed && expectEqual(list.addBack(std::to_string(i)), i);
+    }
+
+    // test that addBack hands out consecutive indexes
+    if (!indexed || !expectEqual(list.size(), size) || !expectEqual(list.slots(), size)
+        || !expectEqual(list[size - 1], std::to_string(size - 1))) {
+        cout << "AddBack : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AddBack : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test adding an element of the list itself while the slots regrow
+    StableIndexVector<std::string> echoes;
+    StableIndexVector<long> numbers;
+    echoes.addBack(std::string(40, 'e'));
+    numbers.addBack(-9);
+    bool echoed = true;
+    for (int i = 1; i < 200; i++) {
+        echoes.addBack(echoes[0]);
+        numbers.emplaceBack(numbers[i - 1]);
+        echoed = echoed && expectEqual(echoes[i], echoes[0]) && expectEqual(numbers[i], -9);
+    }
+    if (!echoed) {
+        cout << "AddBack (own element) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AddBack (own element) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that erase leaves every other index where it was
+    int erasedCount = 0;
+    for (int i = 0; i < size; i += 3) {
+        list.erase(i);
+        erasedCount++;
+    }
+    bool stable = expectEqual(list.size(), size - erasedCount) && expectEqual(list.tombstones(), erasedCount);
+    for (int i = 0; i < size; i++) {
+        stable = stable && expectEqual(list.contains(i), i % 3 != 0) && (i % 3 == 0 || expectEqual(list[i], std::to_string(i)));
+    }
+    if (!stable || !expectEqual(list.slots(), size)) {
+        cout << "Erase : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Erase : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that iteration visits only the live elements, in index order
+    int visited = 0;
+    bool inOrder = true;
+    size_t previous = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        inOrder = inOrder && it.index() % 3 != 0 && *it == std::to_string(it.index()) && (visited == 0 || it.index() > previous);
+        previous = it.index();
+        visited++;
+    }
+    if (!inOrder || !expectEqual(visited, list.size())) {
+        cout << "Iterators : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Iterators : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that invalid and dead indexes are refused
+    bool threw = false;
+    try {
+        list.check(0);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    bool threwErase = false;
+    try {
+        list.erase(size);
+    } catch (const std::out_of_range&) {
+        threwErase = true;
+    }
+    if (!threw || !threwErase || list.tryAt(0) != nullptr || list.tryAt(size) != nullptr
+        || (size > 1 && !expectEqual(*list.tryAt(1), "1"))) {
+        cout << "Check/TryAt : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Check/TryAt : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that copies keep the same indexes and compare equal
+    StableIndexVector<std::string> copy = list;
+    StableIndexVector<std::string> moved = std::move(copy);
+    StableIndexVector<std::string> other;
+    other = moved;
+    other.addBack("extra");
+    if (!(moved == list) || !copy.empty() || other == list || !expectEqual(other.slots(), size + 1)) {
+        cout << "Copy/Move/== : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Copy/Move/== : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that compact reclaims every tombstone and remaps each index
+    StableIndexVector<std::string> compacted = list;
+    Vector<size_t> remap = compacted.compact();
+    bool remapped = expectEqual(remap.size(), size) && expectEqual(compacted.tombstones(), 0)
+        && expectEqual(compacted.slots(), list.size());
+    for (int i = 0; remapped && i < size; i++) {
+        remapped = i % 3 == 0 ? expectEqual(remap[i], StableIndexVector<std::string>::erased)
+                              : expectEqual(compacted[remap[i]], list[i]);
+    }
+    if (!remapped) {
+        cout << "Compact : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Compact : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test an incremental pass with appends and erases between its steps
+    StableIndexVector<std::string> stepped = list;
+    size_t appended = stepped.addBack("during");
+    bool consistent = true;
+    int steps = 0;
+    // between steps a fixed sample of elements is where the remap says, so the checks stay O(N) overall
+    const int stride = 3 * std::max(1, size / 192);
+    while (!stepped.compactStep(7)) {
+        steps++;
+        for (int i = 1; consistent && i < size; i += stride) {
+            consistent = expectEqual(stepped[stepped.remap()[i]], std::to_string(i));
+        }
+        if (steps == 1 && size > 2) {
+            stepped.erase(stepped.remap()[2]);
+        }
+    }
+    // once the pass is done, every element is where the remap says
+    const Vector<size_t>& steppedRemap = stepped.remap();
+    for (int i = 1; consistent && i < size; i += 3) {
+        consistent = expectEqual(stepped[steppedRemap[i]], std::to_string(i));
+    }
+    // the erase landed behind the pass, so its tombstone waits for the next one
+    bool erasedBehind = steps >= 1 && size > 2;
+    bool finished = !stepped.compacting() && expectEqual(stepped.tombstones(), erasedBehind)
+        && expectEqual(stepped[steppedRemap[appended]], "during");
+    stepped.compact();
+    if (!consistent || !finished || !expectEqual(stepped.tombstones(), 0)
+        || !expectEqual(stepped.size(), list.size() + 1 - erasedBehind)) {
+        cout << "CompactStep : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "CompactStep : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Given an ImmutableVector and the std::vector it should match,
+ * returns true if they hold the same elements, by index and in order
+ */
+template <typename V>
+bool matches(const V& version, const std::vector<int>& reference) {
+    bool same = expectEqual(version.size(), reference.size());
+    for (size_t i = 0; same && i < reference.size(); i++) {
+        same = expectEqual(version[i], reference[i]);
+    }
+    size_t walked = 0;
+    for (auto it = version.begin(); same && it != version.end(); ++it) {
+        same = expectEqual(*it, reference[walked++]);
+    }
+    return same && expectEqual(walked, reference.size());
+}
+
+/**
+ * Macro for testing ImmutableVector methods
+ */
+void testN(const int size, int& numTestsPassed, int& numTestsFailed) {
+    ImmutableVector<int> version;
+    std::vector<int> reference;
+    for (int i = 0; i < size; i++) {
+        version = version.addBack(i * 3);
+        reference.push_back(i * 3);
+    }
+
+    // test that addBack builds the same sequence across several tree levels
+    if (!matches(version, reference) || !expectEqual(version.front(), 0) || !expectEqual(version.back(), (size - 1) * 3)) {
+        cout << "AddBack : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AddBack : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that set and addBack leave the versions they came from alone
+    ImmutableVector<int> snapshot = version;
+    ImmutableVector<int> changed = version.set(size / 2, -1).addBack(-2);
+    std::vector<int> changedReference = reference;
+    changedReference[size / 2] = -1;
+    changedReference.push_back(-2);
+    if (!matches(snapshot, reference) || !matches(version, reference) || !matches(changed, changedReference)
+        || snapshot != version || changed == version) {
+        cout << "Set/Snapshots : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Set/Snapshots : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test concatenating pieces of many sizes, including ones that leave partly filled leaves
+    ImmutableVector<int> joined;
+    std::vector<int> joinedReference;
+    int pieceSizes[] = {1, 31, 33, 0, 1025, 7, size};
+    int next = 0;
+    for (int pieceSize : pieceSizes) {
+        ImmutableVector<int> piece;
+        for (int i = 0; i < pieceSize; i++, next++) {
+            piece = piece.addBack(next);
+            joinedReference.push_back(next);
+        }
+        joined = joined + piece;
+    }
+    ImmutableVector<int> doubled = joined.concat(joined).set(0, -5).addBack(-6);
+    std::vector<int> doubledReference = joinedReference;
+    doubledReference.insert(doubledReference.end(), joinedReference.begin(), joinedReference.end());
+    doubledReference[0] = -5;
+    doubledReference.push_back(-6);
+    if (!matches(joined, joinedReference) || !matches(doubled, doubledReference)) {
+        cout << "Concat : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Concat : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that repeated joins keep the tree shallow: prepending, alternating sides, and
+    // appending after each join; a tree grown a level per join overflows well before 400
+    ImmutableVector<int> piece;
+    std::vector<int> pieceReference;
+    for (int i = 0; i < 33; i++) {
+        piece = piece.addBack(i);
+        pieceReference.push_back(i);
+    }
+    ImmutableVector<int> prepended;
+    ImmutableVector<int> alternated;
+    std::vector<int> prependedReference;
+    std::vector<int> alternatedReference;
+    bool joinedOk = true;
+    try {
+        for (int round = 0; round < 400; round++) {
+            prepended = piece.concat(prepended);
+            prependedReference.insert(prependedReference.begin(), pieceReference.begin(), pieceReference.end());
+            alternated = round % 2 == 0 ? alternated.concat(piece) : piece.concat(alternated);
+            alternated = alternated.addBack(-round);
+            alternatedReference.insert(round % 2 == 0 ? alternatedReference.end() : alternatedReference.begin(),
+                                       pieceReference.begin(), pieceReference.end());
+            alternatedReference.push_back(-round);
+        }
+        prepended = prepended.addBack(-1);
+        prependedReference.push_back(-1);
+    } catch (const std::length_error&) {
+        joinedOk = false;
+    }
+    if (!joinedOk || !matches(prepended, prependedReference) || !matches(alternated, alternatedReference)) {
+        cout << "Concat (repeated joins) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Concat (repeated joins) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test building in place with a transient, and that persistent() freezes what it returns
+    ImmutableVector<int>::transientVector draft = version.transient();
+    for (int i = 0; i < size; i++) {
+        draft.addBack(-i);
+    }
+    draft.set(0, 11);
+    ImmutableVector<int> built = draft.persistent();
+    draft.set(0, 12).addBack(13);
+    std::vector<int> builtReference = reference;
+    for (int i = 0; i < size; i++) {
+        builtReference.push_back(-i);
+    }
+    builtReference[0] = 11;
+    if (!matches(version, reference) || !matches(built, builtReference) || !expectEqual(draft[0], 12)
+        || !expectEqual(draft.size(), builtReference.size() + 1)) {
+        cout << "Transient : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Transient : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test construction from a Vector
+    Vector<int> source(size, [](size_t i) { return static_cast<int>(i * 3); });
+    if (!(ImmutableVector<int>(source) == version) || !ImmutableVector<int>(Vector<int>(0)).empty()) {
+        cout << "Constructor (Vector) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Constructor (Vector) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test the errors for invalid indexes and empty versions
+    bool threw = false;
+    try {
+        version.check(size);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    bool threwEmpty = false;
+    try {
+        ImmutableVector<int>().back();
+    } catch (const empty_vector&) {
+        threwEmpty = true;
+    }
+    if (!threw || !threwEmpty || version.tryAt(size) != nullptr || !expectEqual(*version.tryAt(size - 1), (size - 1) * 3)) {
+        cout << "Check/TryAt : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Check/TryAt : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that versions shared across threads can be read and dropped there
+    ImmutableVector<std::string> names;
+    for (int i = 0; i < size; i++) {
+        names = names.addBack(std::to_string(i));
+    }
+    bool readOk = true;
+    std::thread reader([copy = names, &readOk, size] {
+        ImmutableVector<std::string> mine = copy.addBack("mine");
+        readOk = expectEqual(mine.size(), size_t(size) + 1) && expectEqual(copy[size - 1], std::to_string(size - 1));
+    });
+    names = names.set(0, "changed");
+    reader.join();
+    if (!readOk || !expectEqual(names[0], "changed")) {
+        cout << "Threads : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Threads : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
+/**
+ * Given a jagged vector and a reference, returns true if they
+ * hold the same rows
+ */
+template <typename T>
+bool matches(const JaggedVector<T>& rows, const std::vector<std::vector<T>>& reference) {
+    if (rows.rows() != reference.size()) {
+        return false;
+    }
+    size_t row = 0;
+    for (Span<const T> view : rows) {
+        if (!std::equal(view.begin(), view.end(), reference[row].begin(), reference[row].end())) {
+            return false;
+        }
+        row++;
+    }
+    return true;
+}
+
+/**
+ * Macro for testing JaggedVector methods
+ */
+void testO(const int size, int& numTestsPassed, int& numTestsFailed) {
+    // rows of length 0, 1, ..., 9, repeating
+    JaggedVector<int> built;
+    std::vector<std::vector<int>> reference;
+    for (int i = 0; i < size; i++) {
+        built.addRow();
+        reference.emplace_back();
+        for (int j = 0; j < i % 10; j++) {
+            built.addBack(i * 10 + j);
+            reference.back().push_back(i * 10 + j);
+        }
+    }
+
+    // test that addRow and addBack build the rows in order
+    if (!matches(built, reference) || !expectEqual(built.rows(), size) || !expectEqual(built.rowSize(size - 1), (size - 1) % 10)) {
+        cout << "AddRow/AddBack : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "AddRow/AddBack : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test the conversion from nested vectors, and equality with the built rows
+    Vector<Vector<int>> nested;
+    for (const std::vector<int>& row : reference) {
+        nested.addBack(Vector<int>(row.begin(), row.end()));
+    }
+    JaggedVector<int> converted(nested);
+    JaggedVector<int> copied = converted;
+    copied.addRow().addBack(-1);
+    if (!(converted == built) || converted != built || copied == built || !JaggedVector<int>(Vector<Vector<int>>(0)).empty()) {
+        cout << "Constructor (Vector<Vector<T>>)/Equality : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Constructor (Vector<Vector<T>>)/Equality : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test counting sort from edge lists, with enough edges for several threads
+    const size_t rowCount = 1000;
+    int edgeCount = size + 4 * (int)JaggedVector<std::string>::edgesPerThread;
+    Vector<std::pair<size_t, std::string>> edges(edgeCount);
+    std::vector<std::vector<std::string>> edgeReference(rowCount);
+    for (int e = 0; e < edgeCount; e++) {
+        size_t row = (size_t(e) * 2654435761u) % rowCount;
+        edges.addBack(std::make_pair(row, std::to_string(e)));
+        edgeReference[row].push_back(std::to_string(e));
+    }
+    JaggedVector<std::string> serial(rowCount, edges, 1);
+    JaggedVector<std::string> parallel(rowCount, edges, 4);
+    JaggedVector<std::string> sparse(rowCount * 100, Vector<std::pair<size_t, std::string>>(0));
+    if (!matches(serial, edgeReference) || !(parallel == serial) || !expectEqual(parallel.size(), edgeCount)
+        || !expectEqual(sparse.rows(), rowCount * 100) || !expectEqual(sparse.size(), 0)) {
+        cout << "Constructor (edge list) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Constructor (edge list) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test that views write through to the values
+    for (int& value : built[size - 1]) {
+        value = -value;
+    }
+    const JaggedVector<int>& constant = built;
+    Span<const int> last = constant[size - 1];
+    bool negated = true;
+    for (size_t j = 0; j < last.size(); j++) {
+        negated = negated && expectEqual(last[j], -reference[size - 1][j]);
+    }
+    if (!negated || !expectEqual(constant.values().size(), built.size())
+        || (last.size() > 0 && &last[0] != &constant.values()[constant.size() - last.size()])) {
+        cout << "[]/Check/Values : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "[]/Check/Values : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test the errors for invalid rows, rows outside the edge list, and appending without a row
+    bool threwRow = false;
+    try {
+        constant.check(size);
+    } catch (const std::out_of_range&) {
+        threwRow = true;
+    }
+    bool threwEdge = false;
+    try {
+        Vector<std::pair<size_t, int>> bad;
+        bad.addBack(std::make_pair(size_t(0), 1));
+        bad.addBack(std::make_pair(size_t(5), 2));
+        JaggedVector<int> broken(5, bad);
+    } catch (const std::out_of_range&) {
+        threwEdge = true;
+    }
+    bool threwEmpty = false;
+    try {
+        JaggedVector<int>().addBack(1);
+    } catch (const empty_vector&) {
+        threwEmpty = true;
+    }
+    if (!threwRow || !threwEdge || !threwEmpty) {
+        cout << "Check (invalid rows) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Check (invalid rows) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test removing rows from the back and adding rows from spans
+    JaggedVector<int> trimmed = converted;
+    std::vector<std::vector<int>> trimmedReference = reference;
+    for (int i = 0; i < size / 2; i++) {
+        trimmed.removeRow();
+        trimmedReference.pop_back();
+    }
+    int extra[] = {7, 8, 9};
+    trimmed.addRow(Span<const int>(extra, 3)).addRow(Span<const int>());
+    trimmedReference.push_back({7, 8, 9});
+    trimmedReference.emplace_back();
+    trimmed.reserve(size, size);
+    if (!matches(trimmed, trimmedReference)) {
+        cout << "RemoveRow/AddRow (span) : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "RemoveRow/AddRow (span) : PASSED" << endl;
+        numTestsPassed++;
+    }
+
+    // test clearing, then building again
+    trimmed.clear();
+    bool cleared = trimmed.empty() && expectEqual(trimmed.size(), 0) && trimmed.begin() == trimmed.end();
+    trimmed.addRow().addBack(3);
+    if (!cleared || !expectEqual(trimmed.rows(), 1) || !expectEqual(trimmed[0][0], 3)) {
+        cout << "Clear : FAILED" << endl;
+        numTestsFailed++;
+    } else {
+        cout << "Clear : PASSED" << endl;
+        numTestsPassed++;
+    }
+}
+
 /**
  * Given the desired section and the appropriate information, 
  * performs the tests of that section
@@ -500,6 +1625,12 @@ int main() {
     cout << "Section G : Iterators" << endl;
     cout << "Section H : Friends" << endl;
     cout << "Section I : Non-Members" << endl;
+    cout << "Section J : Instrumentation" << endl;
+    cout << "Section K : Buffer Cache" << endl;
+    cout << "Section L : String Vector" << endl;
+    cout << "Section M : Stable Index Vector" << endl;
+    cout << "Section N : Immutable Vector" << endl;
+    cout << "Section O : Jagged Vector" << endl;
     cout << endl;
 
     // maybe add a request system to see which sections should be tested
@@ -530,6 +1661,12 @@ int main() {
     doTest('G', section_G, testSize, numTestsPassed, numTestsFailed, testG);
     doTest('H', section_H, testSize, numTestsPassed, numTestsFailed, testH);
     doTest('I', section_I, testSize, numTestsPassed, numTestsFailed, testI);
+    doTest('J', section_J, testSize, numTestsPassed, numTestsFailed, testJ);
+    doTest('K', section_K, testSize, numTestsPassed, numTestsFailed, testK);
+    doTest('L', section_L, testSize, numTestsPassed, numTestsFailed, testL);
+    doTest('M', section_M, testSize, numTestsPassed, numTestsFailed, testM);
+    doTest('N', section_N, testSize, numTestsPassed, numTestsFailed, testN);
+    doTest('O', section_O, testSize, numTestsPassed, numTestsFailed, testO);
 
     // Inform user as to which tests passed
     if (!numTestsFailed) {
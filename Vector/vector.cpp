@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <memory>
 #include "vector.h"
+#include "storage.h"
 
 using std::cout;
 using std::endl;
@@ -20,188 +21,294 @@ using std::move;
 // Private Functions –––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-void Vector<T>::expand(int amount) {
-    /**
-     * The creation of 'newArray' may not be RAII compliant, so may
-     * need to change to using smart pointers:
-     * std::unique_ptr<T[]> newArray = std::make_unique<T[amount]>();
-     */
-    T* newArray = new T[amount];
-    for (int i = 0; i < _size; i++) {
-        newArray[i] = _elements[i];
-    }
-    delete [] _elements;
+BII_CONSTEXPR void Vector<T>::expand(int amount) {
+    T* newArray = Storage<T>::allocate(amount);
+    Storage<T>::relocate(_elements, _elements + _size, newArray);
+    Storage<T>::deallocate(_elements, _capacity);
     _elements = newArray;
     _capacity = amount;
+    BII_STATS_ONLY(_stats.expand(amount * sizeof(T), amount);)
+    BII_STATS_ONLY(if (Storage<T>::relocatesByMove()) _stats.moved(_size); else _stats.copied(_size);)
+}
+
+template <typename T>
+BII_CONSTEXPR void Vector<T>::grow() {
+    expand(_capacity == 0 ? initialCapacity : _capacity * 2);
+}
+
+template <typename T>
+BII_CONSTEXPR void Vector<T>::shrinkIfSparse() {
+    if (_autoShrink && _capacity > initialCapacity && _size < _capacity / 4) {
+        expand(std::max(_capacity / 2, initialCapacity));
+    }
 }
 
 // Constructors/Destructor –––––––––––––––––––––––––––––––
 
 template <typename T> 
-Vector<T>::Vector() : 
+BII_CONSTEXPR Vector<T>::Vector() : 
     _size(0), 
     _capacity(initialCapacity), 
-    _elements(new T[initialCapacity]) { }
+    _elements(Storage<T>::allocate(initialCapacity)) { 
+    BII_STATS_ONLY(_stats.allocate(initialCapacity * sizeof(T), initialCapacity);)
+}
 
 template <typename T> 
-Vector<T>::Vector(const int givenSize) : 
+BII_CONSTEXPR Vector<T>::Vector(const int givenSize) : 
     _size(0), 
     _capacity(givenSize), 
-    _elements(new T[givenSize]) { }
+    _elements(Storage<T>::allocate(givenSize)) { 
+    BII_STATS_ONLY(_stats.allocate(givenSize * sizeof(T), givenSize);)
+}
 
 template <typename T>
-Vector<T>::Vector(const Vector<T>& given) : 
-    _size(given._size), 
+BII_CONSTEXPR Vector<T>::Vector(const Vector<T>& given) : 
+    _size(0), 
     _capacity(given._capacity), 
-    _elements(new T[given._capacity]) { 
-    copy(given._elements, given._elements + given._size, _elements);
+    _elements(Storage<T>::allocate(given._capacity)),
+    _autoShrink(given._autoShrink) { 
+    constructionGuard guard(this);
+    Storage<T>::copy(given._elements, given._elements + given._size, _elements);
+    _size = given._size;
+    guard.release();
+    BII_STATS_ONLY(_stats.allocate(given._capacity * sizeof(T), given._capacity); _stats.copied(given._size);)
 }
 
 template <typename T>
-Vector<T>::Vector(Vector<T>&& given) : 
+BII_CONSTEXPR Vector<T>::Vector(Vector<T>&& given) : 
     _size(move(given._size)), 
     _capacity(move(given._capacity)), 
-    _elements(move(given._elements)) { 
+    _elements(move(given._elements)),
+    _autoShrink(given._autoShrink) { 
     given._elements = nullptr;
+    given._size = 0;
+    given._capacity = 0;
+}
+
+template <typename T>
+BII_CONSTEXPR Vector<T>::Vector(int times, const T val) :
+    _size(0),
+    _capacity(times),
+    _elements(Storage<T>::allocate(times)) { 
+    constructionGuard guard(this);
+    Storage<T>::fill(_elements, times, val);
+    _size = times;
+    guard.release();
+    BII_STATS_ONLY(_stats.allocate(times * sizeof(T), times); _stats.copied(times);)
+}
+
+template <typename T>
+BII_CONSTEXPR Vector<T>::Vector(std::initializer_list<T> given) :
+    _size(0),
+    _capacity(static_cast<int>(given.size())),
+    _elements(Storage<T>::allocate(given.size())) {
+    constructionGuard guard(this);
+    Storage<T>::copy(given.begin(), given.end(), _elements);
+    _size = _capacity;
+    guard.release();
+    BII_STATS_ONLY(_stats.allocate(given.size() * sizeof(T), given.size()); _stats.copied(given.size());)
+}
+
+template <typename T>
+template <typename Iterator, typename>
+BII_CONSTEXPR Vector<T>::Vector(Iterator first, Iterator last) :
+    _size(0),
+    _capacity(0),
+    _elements(nullptr) {
+    using category = typename std::iterator_traits<Iterator>::iterator_category;
+    constructionGuard guard(this);
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+        int count = static_cast<int>(std::distance(first, last));
+        _elements = Storage<T>::allocate(count);
+        _capacity = count;
+        Storage<T>::copy(first, last, _elements);
+        _size = count;
+        BII_STATS_ONLY(_stats.allocate(count * sizeof(T), count); _stats.copied(count);)
+    } else {
+        // a single pass cannot be counted ahead of time
+        for (; first != last; ++first) {
+            addBack(*first);
+        }
+    }
+    guard.release();
+}
+
+template <typename T>
+template <typename Generator, typename>
+BII_CONSTEXPR Vector<T>::Vector(int times, Generator generate) :
+    _size(0),
+    _capacity(times),
+    _elements(Storage<T>::allocate(times)) {
+    BII_STATS_ONLY(_stats.allocate(times * sizeof(T), times);)
+    constructionGuard guard(this);
+    for (; _size < times; _size++) {
+        if constexpr (std::is_invocable<Generator&, size_t>::value) {
+            Storage<T>::construct(_elements + _size, generate(static_cast<size_t>(_size)));
+        } else {
+            Storage<T>::construct(_elements + _size, generate());
+        }
+    }
+    guard.release();
 }
 
 template <typename T>
-Vector<T>::Vector(int times, const T val) :
-    _size(times),
-    _capacity(times * 2),
-    _elements(new T[times * 2]) { 
-    for (int i = 0; i < times; i++) {
-        _elements[i] = val;
-    }
+BII_CONSTEXPR Vector<T>::Vector(int times, for_overwrite_t) :
+    _size(0),
+    _capacity(times),
+    _elements(Storage<T>::allocate(times)) {
+    constructionGuard guard(this);
+    Storage<T>::defaultConstruct(_elements, times);
+    _size = times;
+    guard.release();
+    BII_STATS_ONLY(_stats.allocate(times * sizeof(T), times);)
 }
 
-// template <typename T>
-// Vector<T>::Vector(const iterator otherBegin, const iterator otherEnd) : 
-//     _size(0),
-//     _capacity(),
-//     _elements(new T[times * 2]) { 
-//     for (iterator iter = otherBegin; iter < otherEnd; iter++) {
-//         addBack(*iter);
-//     }
-// }
-
 template <typename T>
-Vector<T>::~Vector() {
-    delete [] _elements;
+BII_CONSTEXPR Vector<T>::~Vector() {
+    Storage<T>::destroy(_elements, _elements + _size);
+    Storage<T>::deallocate(_elements, _capacity);
 }
 
 // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-inline size_t Vector<T>::size() const {
+BII_CONSTEXPR inline size_t Vector<T>::size() const {
     return _size;
 }
 
 template <typename T>
-inline bool Vector<T>::empty() const {
+BII_CONSTEXPR inline bool Vector<T>::empty() const {
     return _size == 0;
 }
 
 template <typename T>
-inline size_t Vector<T>::capacity() const {
+BII_CONSTEXPR inline size_t Vector<T>::capacity() const {
     return _capacity;
 }
 
 template <typename T>
-inline size_t Vector<T>::open() const {
+BII_CONSTEXPR inline size_t Vector<T>::open() const {
     return _capacity - _size;
 }
 
 // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-Vector<T>& Vector<T>::addBack(const T& value) {
+BII_CONSTEXPR Vector<T>& Vector<T>::addBack(const T& value) {
     if (_size == _capacity) {
-        expand(_capacity * 2);
+        // value may live in the buffer that grow releases
+        T element(value);
+        grow();
+        Storage<T>::construct(_elements + _size, move(element));
+    } else {
+        Storage<T>::construct(_elements + _size, value);
     }
-    _elements[_size] = value;
     _size++;
     return *this;
 }
 
 template <typename T>
-Vector<T>& Vector<T>::addBack(T&& value) {
+BII_CONSTEXPR Vector<T>& Vector<T>::addBack(T&& value) {
     if (_size == _capacity) {
-        expand(_capacity * 2);
+        T element(move(value));
+        grow();
+        Storage<T>::construct(_elements + _size, move(element));
+    } else {
+        Storage<T>::construct(_elements + _size, move(value));
     }
-    _elements[_size] = move(value);
     _size++;
     return *this;
 }
 
 template <typename T>
-T& Vector<T>::removeBack() {
+BII_CONSTEXPR T Vector<T>::removeBack() {
     if (empty()) {
         cout << "removeBack failed\n";
-        throw empty_vector();
+        BII_THROW(empty_vector());
+    }
+    T element(move(_elements[_size - 1]));
+    Storage<T>::destroy(_elements + _size - 1, _elements + _size);
+    _size--;
+    shrinkIfSparse();
+    return element;
+}
+
+template <typename T>
+BII_CONSTEXPR std::optional<T> Vector<T>::tryRemoveBack() {
+    if (empty()) {
+        return std::nullopt;
     }
+    std::optional<T> element(move(_elements[_size - 1]));
+    Storage<T>::destroy(_elements + _size - 1, _elements + _size);
     _size--;
-    return _elements[_size];
+    shrinkIfSparse();
+    return element;
 }
 
 template <typename T>
-void Vector<T>::remove(const iterator index) {
+BII_CONSTEXPR void Vector<T>::remove(const iterator index) {
     if (index >= end() || index < begin()) {
         cout << "remove failed\n";
-        throw std::out_of_range("Trying to access index outside of vector");
-    }
-    iterator counter = index;
-    while (counter < end()) {
-        *counter = *(counter + 1);
-        counter++;
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
     }
+    std::move(index + 1, end(), index);
+    BII_STATS_ONLY(_stats.moved(end() - index - 1);)
+    Storage<T>::destroy(end() - 1, end());
     _size--;
+    shrinkIfSparse();
 }
 
 template <typename T>
-Vector<T>& Vector<T>::merge(const Vector<T>& other) {
-    if (other._size > open()) {
-        reserve(other._size - open());
-    }
-    for (int i = 0; i < other._size; i++) {
-        addBack(other._elements[i]);
+BII_CONSTEXPR Vector<T>& Vector<T>::merge(const Vector<T>& other) {
+    // other may be this vector, so fix the count before growing
+    const int count = other._size;
+    if (static_cast<size_t>(count) > open()) {
+        reserve(count - open());
     }
+    Storage<T>::copy(other._elements, other._elements + count, _elements + _size);
+    _size += count;
+    BII_STATS_ONLY(_stats.copied(count);)
     return *this;
 }
 
 template <typename T>
-void Vector<T>::insert(const T& value, const iterator index) {
+BII_CONSTEXPR void Vector<T>::insert(const T& value, const iterator index) {
     if (index < begin() || index >= end()) {
         cout << "Insert failed\n";
-        throw std::out_of_range("Trying to access index outside of vector");
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
     }
+    // grow moves the elements (and value may be one of them),
+    // so work from a copy and an offset
+    T element(value);
+    size_t offset = index - begin();
     if (_size == _capacity) {
-        expand(_capacity * 2);
-    }
-    for (iterator iter = end(); iter > index; iter--) {
-        *iter = *(iter - 1);
+        grow();
     }
-    *index = value;
+    iterator position = begin() + offset;
+    Storage<T>::construct(end(), move(*(end() - 1)));
+    std::move_backward(position, end() - 1, end());
+    BII_STATS_ONLY(_stats.moved(end() - position);)
+    *position = move(element);
     _size++;
 }
 
 template <typename T>
-Vector<T> Vector<T>::innerVec(const iterator first, const iterator second) {
+BII_CONSTEXPR Vector<T> Vector<T>::innerVec(const iterator first, const iterator second) {
     if (empty()) {
         cout << "innerVec failed\n";
-        throw empty_vector();
+        BII_THROW(empty_vector());
     }
     if (first < begin() || first > end()) {
         cout << "innerVec failed\n";
-        throw std::out_of_range("Trying to access index outside of vector");
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
     }
     if (second < begin() || second > end()) {
         cout << "innerVec failed\n";
-        throw std::out_of_range("Trying to access index outside of vector");
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
     }
     if (first > second) {
         cout << "innerVec failed\n";
-        throw std::out_of_range("Given indices not in proper order");
+        BII_THROW(std::out_of_range("Given indices not in proper order"));
     }
 
     Vector<T> inner;
@@ -212,7 +319,7 @@ Vector<T> Vector<T>::innerVec(const iterator first, const iterator second) {
 }
 
 template <typename T>
-Vector<T>& Vector<T>::swap(const iterator first, const iterator second) {
+BII_CONSTEXPR Vector<T>& Vector<T>::swap(const iterator first, const iterator second) {
     T element = move(*first);
     *first = move(*second);
     *second = element;
@@ -222,170 +329,291 @@ Vector<T>& Vector<T>::swap(const iterator first, const iterator second) {
 // Elements Viewing ––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-T& Vector<T>::check(const size_t index)  {
+BII_CONSTEXPR T& Vector<T>::check(const size_t index)  {
     return const_cast<T&>(static_cast<const Vector<T>*>(this)->check(index));
 }
 
 template <typename T>
-const T& Vector<T>::check(const size_t index) const {
+BII_CONSTEXPR const T& Vector<T>::check(const size_t index) const {
     if (index >= _size || index < 0) {
         cout << "Check failed\n";
-        throw std::out_of_range("Trying to access index outside of vector");
+        BII_THROW(std::out_of_range("Trying to access index outside of vector"));
     }
     return *(begin() + index);
 }
 
 template <typename T>
-inline T& Vector<T>::front() {
+BII_CONSTEXPR inline T& Vector<T>::front() {
     return const_cast<T&>(static_cast<const Vector<T>*>(this)->front());
 }
 
 template <typename T>
-inline const T& Vector<T>::front() const {
+BII_CONSTEXPR inline const T& Vector<T>::front() const {
     if (empty()) {
         cout << "front failed\n";
-        throw empty_vector();
+        BII_THROW(empty_vector());
     }
     return _elements[0];
 }
 
 template <typename T>
-inline T& Vector<T>::back() {
+BII_CONSTEXPR inline T& Vector<T>::back() {
     return const_cast<T&>(static_cast<const Vector<T>*>(this)->back());
 }
 
 template <typename T>
-inline const T& Vector<T>::back() const {
+BII_CONSTEXPR inline const T& Vector<T>::back() const {
     if (empty()) {
         cout << "back failed\n";
-        throw empty_vector();
+        BII_THROW(empty_vector());
     }
     return _elements[_size - 1];
 }
 
+template <typename T>
+BII_CONSTEXPR inline T* Vector<T>::tryAt(const size_t index) {
+    return const_cast<T*>(static_cast<const Vector<T>*>(this)->tryAt(index));
+}
+
+template <typename T>
+BII_CONSTEXPR inline const T* Vector<T>::tryAt(const size_t index) const {
+    return index < static_cast<size_t>(_size) ? _elements + index : nullptr;
+}
+
+template <typename T>
+BII_CONSTEXPR inline T* Vector<T>::tryFront() {
+    return const_cast<T*>(static_cast<const Vector<T>*>(this)->tryFront());
+}
+
+template <typename T>
+BII_CONSTEXPR inline const T* Vector<T>::tryFront() const {
+    return empty() ? nullptr : _elements;
+}
+
+template <typename T>
+BII_CONSTEXPR inline T* Vector<T>::tryBack() {
+    return const_cast<T*>(static_cast<const Vector<T>*>(this)->tryBack());
+}
+
+template <typename T>
+BII_CONSTEXPR inline const T* Vector<T>::tryBack() const {
+    return empty() ? nullptr : _elements + _size - 1;
+}
+
+template <typename T>
+BII_CONSTEXPR inline T* Vector<T>::data() {
+    return _elements;
+}
+
+template <typename T>
+BII_CONSTEXPR inline const T* Vector<T>::data() const {
+    return _elements;
+}
+
 // Memory Handling –––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-void Vector<T>::reserve(const size_t length) {
+BII_CONSTEXPR void Vector<T>::reserve(const size_t length) {
     if (length <= 0) {
         cout << "reserve failed\n";
-        throw bad_reserve();
+        BII_THROW(bad_reserve());
     }
     expand(_capacity + length);
 }
 
 template <typename T>
-void Vector<T>::reduce() {
+BII_CONSTEXPR void Vector<T>::reduce() {
+    if (_capacity == _size) {
+        return;
+    }
     expand(_size);
 }
 
 template <typename T>
-Vector<T>& Vector<T>::clear() {
-    expand(initialCapacity);
+BII_CONSTEXPR Vector<T>& Vector<T>::clear() {
+    Storage<T>::destroy(_elements, _elements + _size);
     _size = 0;
     return *this;
 }
 
+template <typename T>
+BII_CONSTEXPR Vector<T>& Vector<T>::release() {
+    clear();
+    Storage<T>::deallocate(_elements, _capacity);
+    _elements = nullptr;
+    _capacity = 0;
+    return *this;
+}
+
+template <typename T>
+BII_CONSTEXPR Vector<T>& Vector<T>::autoShrink(const bool enabled) {
+    _autoShrink = enabled;
+    shrinkIfSparse();
+    return *this;
+}
+
 // Operators –––––––––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-T& Vector<T>::operator[](const size_t index) {
+BII_CONSTEXPR T& Vector<T>::operator[](const size_t index) {
     return check(index);
 }
 
 template <typename T>
-const T& Vector<T>::operator[](const size_t index) const {
+BII_CONSTEXPR const T& Vector<T>::operator[](const size_t index) const {
     return check(index);
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator+=(const T& value) {
+BII_CONSTEXPR Vector<T>& Vector<T>::operator+=(const T& value) {
     addBack(value);
     return *this;
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator+=(T&& value) {
+BII_CONSTEXPR Vector<T>& Vector<T>::operator+=(T&& value) {
     addBack(value);
     return *this;
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator+=(const Vector<T>& other) {
+BII_CONSTEXPR Vector<T>& Vector<T>::operator+=(const Vector<T>& other) {
     merge(other);
     return *this;
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& assign) {
+BII_CONSTEXPR Vector<T>& Vector<T>::operator=(const Vector<T>& assign) {
     if (&assign == this) return *this;
+    clear();
+    if (_capacity < assign._size) {
+        // the current buffer is too small, so trade it for a copy
+        // of the assigned vector's capacity
+        T* newArray = Storage<T>::allocate(assign._capacity);
+        Storage<T>::deallocate(_elements, _capacity);
+        _elements = newArray;
+        _capacity = assign._capacity;
+        BII_STATS_ONLY(_stats.allocate(assign._capacity * sizeof(T), assign._capacity);)
+    }
+    Storage<T>::copy(assign._elements, assign._elements + assign._size, _elements);
     _size = assign._size;
-    _capacity = assign._capacity;
-    T* newArray = new T[assign._capacity];
-    copy(assign._elements, assign._elements + assign._size, newArray);
-    delete [] _elements;
-    _elements = newArray;
+    _autoShrink = assign._autoShrink;
+    BII_STATS_ONLY(_stats.copied(assign._size);)
     return *this;
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator=(Vector<T>&& assign) {
+BII_CONSTEXPR Vector<T>& Vector<T>::operator=(Vector<T>&& assign) {
     if (&assign == this) return *this;
+    release();
     _size = move(assign._size);
     _capacity = move(assign._capacity);
-    delete [] _elements;
     _elements = move(assign._elements);
+    _autoShrink = assign._autoShrink;
     assign._elements = nullptr;
+    assign._size = 0;
+    assign._capacity = 0;
     return *this;
 }
 
 // Iterators –––––––––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-T* Vector<T>::begin() {
+BII_CONSTEXPR T* Vector<T>::begin() {
     return const_cast<T*>(static_cast<const Vector<T>*>(this)->begin());
 }
 
 template <typename T>
-T* Vector<T>::end() {
+BII_CONSTEXPR T* Vector<T>::end() {
     return const_cast<T*>(static_cast<const Vector<T>*>(this)->end());
 }
 
 template <typename T>
-const T* Vector<T>::begin() const {
+BII_CONSTEXPR const T* Vector<T>::begin() const {
     return _elements;
 }
 
 template <typename T>
-const T* Vector<T>::end() const {
+BII_CONSTEXPR const T* Vector<T>::end() const {
     return _elements + size();
 }
 
-// ADD REVERSE ITERATORS
 template <typename T>
-T* Vector<T>::rbegin() {
-    return const_cast<T*>(static_cast<const Vector<T>*>(this)->rbegin());
+BII_CONSTEXPR const T* Vector<T>::cbegin() const {
+    return begin();
+}
+
+template <typename T>
+BII_CONSTEXPR const T* Vector<T>::cend() const {
+    return end();
+}
+
+template <typename T>
+BII_CONSTEXPR typename Vector<T>::reverse_iterator Vector<T>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T>
+BII_CONSTEXPR typename Vector<T>::reverse_iterator Vector<T>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T>
+BII_CONSTEXPR typename Vector<T>::const_reverse_iterator Vector<T>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T>
+BII_CONSTEXPR typename Vector<T>::const_reverse_iterator Vector<T>::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+template <typename T>
+BII_CONSTEXPR typename Vector<T>::const_reverse_iterator Vector<T>::crbegin() const {
+    return rbegin();
+}
+
+template <typename T>
+BII_CONSTEXPR typename Vector<T>::const_reverse_iterator Vector<T>::crend() const {
+    return rend();
+}
+
+// Instrumentation –––––––––––––––––––––––––––––––––––––––
+
+#ifdef BII_STATS
+template <typename T>
+const container_stats& Vector<T>::stats() const {
+    return _stats.local();
+}
+
+template <typename T>
+void Vector<T>::dumpStats(std::ostream& out) const {
+    _stats.local().dump(out, "Vector");
 }
 
 template <typename T>
-T* Vector<T>::rend() {
-    return const_cast<T*>(static_cast<const Vector<T>*>(this)->rend());
+container_stats Vector<T>::globalStats() {
+    return vectorGlobalStats().snapshot();
 }
 
 template <typename T>
-const T* Vector<T>::rbegin() const {
-    return _elements + size() - 1;
+void Vector<T>::dumpGlobalStats(std::ostream& out) {
+    vectorGlobalStats().dump(out, "Vector (global)");
+#ifdef BII_BUFFER_CACHE
+    bufferCache::stats().dump(out, "Buffer (this thread)");
+#endif
 }
 
 template <typename T>
-const T* Vector<T>::rend() const {
-    return _elements - 1;
+void Vector<T>::resetGlobalStats() {
+    vectorGlobalStats().reset();
 }
+#endif
 
 // Friends –––––––––––––––––––––––––––––––––––––––––––––––
 
 template <typename T>
-bool operator==(const Vector<T>& first, const Vector<T>& second) {
+BII_CONSTEXPR bool operator==(const Vector<T>& first, const Vector<T>& second) {
     if (first._size != second._size) {
         return false;
     }
@@ -398,7 +626,7 @@ bool operator==(const Vector<T>& first, const Vector<T>& second) {
 }
 
 template <typename T>
-bool operator!=(const Vector<T>& first, const Vector<T>& second) {
+BII_CONSTEXPR bool operator!=(const Vector<T>& first, const Vector<T>& second) {
     return !(first == second);
 }
 
@@ -421,7 +649,7 @@ std::ostream& operator<<(std::ostream& out, const Vector<T>& vec) {
  * given element
  */
 template <typename T>
-Vector<T> operator+(const Vector<T>& lhs, const T& rhs) {
+BII_CONSTEXPR Vector<T> operator+(const Vector<T>& lhs, const T& rhs) {
     Vector<T> copy = lhs;
     copy += rhs;
     return copy;
@@ -432,7 +660,7 @@ Vector<T> operator+(const Vector<T>& lhs, const T& rhs) {
  * given element
  */
 template <typename T>
-Vector<T> operator+(const T& lhs, const Vector<T>& rhs) {
+BII_CONSTEXPR Vector<T> operator+(const T& lhs, const Vector<T>& rhs) {
     Vector<T> copy = rhs;
     copy += lhs;
     return copy;
@@ -443,7 +671,7 @@ Vector<T> operator+(const T& lhs, const Vector<T>& rhs) {
  * other
  */
 template <typename T>
-Vector<T> operator+(const Vector<T>& lhs, const Vector<T>& rhs) {
+BII_CONSTEXPR Vector<T> operator+(const Vector<T>& lhs, const Vector<T>& rhs) {
     Vector<T> copy = lhs;
     for (const T* iter = rhs.begin(); iter < rhs.end(); iter++) {
         copy += *iter;
@@ -455,7 +683,7 @@ Vector<T> operator+(const Vector<T>& lhs, const Vector<T>& rhs) {
  * Swaps the contents of the two given vectors
  */
 template <typename T>
-void swap(Vector<T>& first, Vector<T>& second) {
+BII_CONSTEXPR void swap(Vector<T>& first, Vector<T>& second) {
     Vector<T> lvalue = move(first);
     first = move(second);
     second = move(lvalue);
@@ -47,6 +47,54 @@
  * factor, so probably needs to be changed. Changed insert, innerVec, remove to use iterators
  * instead of size_t indexes.
  * 
+ * @version 1.0.6: October 19, 2026
+ * Added optional allocation and growth instrumentation (see Stats/stats.h).
+ * Compiling with BII_STATS adds stats, dumpStats, globalStats, dumpGlobalStats,
+ * and resetGlobalStats; without it the hooks compile away entirely.
+ * 
+ * @version 1.0.7: October 19, 2026
+ * Moved the underlying array onto uninitialized storage (see storage.h), so
+ * unused capacity is no longer default constructed. clear now keeps the
+ * capacity; release frees it. reduce does nothing when already tight. Added
+ * autoShrink, which halves the capacity once the size falls below a quarter
+ * of it. removeBack now returns the removed element by value.
+ * 
+ * @version 1.0.8: October 19, 2026
+ * Marked every member function BII_CONSTEXPR, so under C++20 a Vector can be
+ * built and used during constant evaluation (see StaticVector for keeping the
+ * result in the binary).
+ * 
+ * @version 1.0.9: October 19, 2026
+ * Added tryRemoveBack, tryAt, tryFront, and tryBack, which report an
+ * empty vector or a bad index through their return value instead of
+ * printing and throwing. empty_vector moved to Exceptions/exception.h,
+ * and every throw goes through BII_THROW, so the vector also builds
+ * with -fno-exceptions.
+ * 
+ * @version 1.0.10: October 19, 2026
+ * Fixed the reverse iterators: rbegin and rend now return
+ * std::reverse_iterator, so ++ walks toward the front and rend no
+ * longer points before the array. Added cbegin, cend, crbegin, crend,
+ * data, and the standard member types. iterator stays a raw pointer,
+ * which is already a contiguous iterator, so std::ranges, the parallel
+ * algorithms, and the memmove paths of std::copy all apply to it.
+ * 
+ * @version 1.0.11: October 19, 2026
+ * Added range, initializer list, generator, and for-overwrite
+ * constructors. Each allocates once, at exactly the size it needs,
+ * and constructs the elements in place. The fill constructor no
+ * longer allocates twice the room it fills.
+ * 
+ * @version 1.0.12: October 19, 2026
+ * Compiling with BII_BUFFER_CACHE serves every buffer from a per-thread
+ * cache of recently released buffers (see buffer-cache.h), so vectors
+ * created and destroyed in a loop stop calling malloc. With BII_STATS
+ * too, dumpGlobalStats also prints the calling thread's cache hit rate.
+ * 
+ * @version 1.0.13: October 19, 2026
+ * A constructor that throws while filling its array (a throwing
+ * copy, generator, or default constructor) now destroys what it
+ * built and frees the array instead of leaking both.
  * 
 */
 #pragma once
@@ -55,6 +103,14 @@
 #include <exception>
 #include <algorithm>
 #include <memory>
+#include <optional>
+#include <iterator>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include "../Exceptions/exception.h"
+#include "../Stats/stats.h"
+#include "storage.h"
 
 using std::cout;
 using std::endl;
@@ -63,12 +119,44 @@ using std::move;
 
 const int initialCapacity = 10;
 
+/**
+ * Tag for constructors that leave trivial elements uninitialized,
+ * for buffers that are about to be overwritten anyway
+ */
+struct for_overwrite_t {
+    explicit for_overwrite_t() = default;
+};
+
+inline constexpr for_overwrite_t forOverwrite{};
+
+#ifdef BII_STATS
+/**
+ * Aggregate instrumentation for every Vector in the process
+ */
+inline global_stats& vectorGlobalStats() {
+    static global_stats stats;
+    return stats;
+}
+#endif
+
 template <typename T>
 class Vector {
 public:
 
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    // plain pointers: the elements are contiguous, and library
+    // algorithms recognize pointers without any iterator traits
     using iterator = T*;
     using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     // Constructors/Destructor –––––––––––––––––––––––––––––––
     /** 
@@ -77,7 +165,7 @@ public:
      * Sets size to 0
      * Creates a new vector of size initialCapacity
      */
-    Vector();
+    BII_CONSTEXPR Vector();
 
     /** 
      * Destructor
@@ -85,89 +173,123 @@ public:
      * Sets size to 0
      * Creates a new vector of size initialCapacity
      */
-    Vector(const int givenSize);
+    BII_CONSTEXPR Vector(const int givenSize);
 
     /** 
      * Copy Constructor
      * Creates a new vector with the same capacity, size, and elements as the given l-value vector
      */
-    Vector(const Vector<T>& given);
+    BII_CONSTEXPR Vector(const Vector<T>& given);
 
     /** 
      * Move Constructor
      * Creates a new vector with the same capacity, size, and elements as the given r-value vector
      */
-    Vector(Vector<T>&& given);
+    BII_CONSTEXPR Vector(Vector<T>&& given);
 
     /**
      * Fill Constructor
-     * Creates a new vector and fills it with the given value
+     * Creates a new vector holding times copies of the given value,
+     * with no spare capacity
+     */
+    BII_CONSTEXPR Vector(int times, const T val);
+
+    /**
+     * Member Initializer List Constructor
+     * Creates a new vector with the given elements,
+     * with no spare capacity
      */
-    Vector(int times, const T val);
+    BII_CONSTEXPR Vector(std::initializer_list<T> given);
 
     /**
      * Range Constructor
-     * Creates a new vector and populates it with the elements of another vector between
-     * the given indices of the other vector
+     * Creates a new vector from the elements in [first, last). Forward
+     * iterators are measured first, so the array is allocated once at
+     * the exact size; single-pass input iterators grow as with addBack
+     */
+    template <typename Iterator, typename = typename std::iterator_traits<Iterator>::iterator_category>
+    BII_CONSTEXPR Vector(Iterator first, Iterator last);
+
+    /**
+     * Generator Constructor
+     * Creates a new vector of times elements, constructing the
+     * element at index i from generate(i), or from generate()
+     * if it takes no arguments
      */
-    // Vector(const iterator otherBegin, const iterator otherEnd);
+    template <typename Generator, typename = typename std::enable_if<!std::is_convertible<Generator, T>::value &&
+        (std::is_invocable<Generator&, size_t>::value || std::is_invocable<Generator&>::value)>::type>
+    BII_CONSTEXPR Vector(int times, Generator generate);
+
+    /**
+     * For-Overwrite Constructor
+     * Creates a new vector of times default-initialized elements:
+     * trivial types are left uninitialized, for the caller to write
+     */
+    BII_CONSTEXPR Vector(int times, for_overwrite_t);
 
     /** 
      * Returns the memory used by the vector
      */
-    ~Vector();
+    BII_CONSTEXPR ~Vector();
     
     // Capacity ––––––––––––––––––––––––––––––––––––––––––––––
     /**
      * Returns the size of the vector
      * O(1) asymptotic complexity
      */
-    inline size_t size() const;
+    BII_CONSTEXPR inline size_t size() const;
 
     /**
      * Returns true if the vector is empty
      * O(1) asymptotic complexity
      */
-    inline bool empty() const;
+    BII_CONSTEXPR inline bool empty() const;
 
     /**
      * Returns the current capacity of the vector
      * O(1) asymptotic complexity
      */
-    inline size_t capacity() const;
+    BII_CONSTEXPR inline size_t capacity() const;
 
     /**
      * Returns the amount of open space left in the vector
      * O(1) asymptotic complexity
      */ 
-    inline size_t open() const;
+    BII_CONSTEXPR inline size_t open() const;
     
     // Modifiers –––––––––––––––––––––––––––––––––––––––––––––
     /**
      * Adds an l-value element to the back of the vector
      * O(1) asymptotic complexity
      */ 
-    Vector<T>& addBack(const T& value);
+    BII_CONSTEXPR Vector<T>& addBack(const T& value);
 
     /**
      * Adds an r-value element to the back of the vector
      * O(1) asymptotic complexity
      */ 
-    Vector<T>& addBack(T&& value);
+    BII_CONSTEXPR Vector<T>& addBack(T&& value);
 
     /** 
      * Returns and removes the last element in the vector
      * Throws an error if trying to remove an empty element
      * O(1) asymptotic complexity 
      */
-    T& removeBack();
+    BII_CONSTEXPR T removeBack();
+
+    /**
+     * Returns and removes the last element in the vector,
+     * or returns nothing if the vector is empty
+     * O(1) asymptotic complexity
+     */
+    BII_CONSTEXPR std::optional<T> tryRemoveBack();
 
     /**
      * Removes the value in the vector at the given index
      * Throws an error for invalid indexes
      * O(N) asymptotic complexity
      */
-    void remove(const iterator index);
+    BII_CONSTEXPR void remove(const iterator index);
 
     /**
      * Inserts a value at a certain index in the vector
@@ -175,7 +297,7 @@ public:
      * of the vector or if the index is negative
      * O(n) runtime speed
      */
-    void insert(const T& value, const iterator index);
+    BII_CONSTEXPR void insert(const T& value, const iterator index);
 
     /**
      * Given another vector, adds the elements of 
@@ -183,7 +305,7 @@ public:
      * O(n) runtime speed where n is the size
      * of the other vector
      */
-    Vector<T>& merge(const Vector<T>& other);
+    BII_CONSTEXPR Vector<T>& merge(const Vector<T>& other);
 
     // add a version of merge for rvalue references
 
@@ -192,61 +314,134 @@ public:
      * the two given indexes, inclusive.
      * Throws an error if the vector is empty or if the indexes are invalid
      */
-    Vector<T> innerVec(const iterator first, const iterator second);
+    BII_CONSTEXPR Vector<T> innerVec(const iterator first, const iterator second);
 
     /**
      * Given two indices, swaps the elements at the given
      * indices
      */
-    Vector<T>& swap(const iterator first, const iterator second);
+    BII_CONSTEXPR Vector<T>& swap(const iterator first, const iterator second);
     
     // Element Viewing –––––––––––––––––––––––––––––––––––––––
     /**
      * Returns a reference to the value at a given index
      * Throws an error for invalid indexes
      */
-    T& check(const size_t index);
+    BII_CONSTEXPR T& check(const size_t index);
 
     /**
      * Returns the value at a given index
      * Throws an error for invalid indexes
      */
-    const T& check(const size_t index) const;
+    BII_CONSTEXPR const T& check(const size_t index) const;
 
     /**
      * Return a reference to the first element in the vector
      * Throws an error if the vector is empty
      * O(1) runtime speed
      */
-    inline T& front();
+    BII_CONSTEXPR inline T& front();
 
     /**
      * Return the value of the first element in the vector
      * Throws an error if the vector is empty
      * O(1) runtime speed
      */
-    inline const T& front() const;
+    BII_CONSTEXPR inline const T& front() const;
 
     /**
      * Return a reference to the last element in the vector
      * Throws an error if the vector is empty 
      * O(1) runtime speed
      */
-    inline T& back();
+    BII_CONSTEXPR inline T& back();
 
     /**
      * Return the value of the last element in the vector
      * Throws an error if the vector is empty 
      * O(1) runtime speed
      */
-    inline const T& back() const;
+    BII_CONSTEXPR inline const T& back() const;
+
+    /**
+     * Returns a pointer to the value at a given index,
+     * or nullptr for invalid indexes
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline T* tryAt(const size_t index);
+
+    /**
+     * Returns a pointer to the value at a given index,
+     * or nullptr for invalid indexes (const)
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline const T* tryAt(const size_t index) const;
+
+    /**
+     * Returns a pointer to the first element in the vector,
+     * or nullptr if the vector is empty
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline T* tryFront();
+
+    /**
+     * Returns a pointer to the first element in the vector,
+     * or nullptr if the vector is empty (const)
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline const T* tryFront() const;
+
+    /**
+     * Returns a pointer to the last element in the vector,
+     * or nullptr if the vector is empty
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline T* tryBack();
+
+    /**
+     * Returns a pointer to the last element in the vector,
+     * or nullptr if the vector is empty (const)
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline const T* tryBack() const;
+
+    /**
+     * Returns a pointer to the first element, for passing the
+     * elements to functions that take a pointer and a size
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline T* data();
+
+    /**
+     * Returns a pointer to the first element (const)
+     * O(1) runtime speed
+     */
+    BII_CONSTEXPR inline const T* data() const;
 
     // Memory Handling –––––––––––––––––––––––––––––––––––––––
     /**
-     * Clears the existing vector and resets capacity to 
-     * initialCapacity
+     * Destroys every element but keeps the capacity, so
+     * refilling the vector does not reallocate
+     * O(n) asymptotic complexity
      */
-    Vector<T>& clear();
+    BII_CONSTEXPR Vector<T>& clear();
+
+    /**
+     * Destroys every element and frees the underlying
+     * array, leaving a capacity of 0
+     * O(n) asymptotic complexity
+     */
+    BII_CONSTEXPR Vector<T>& release();
+
+    /**
+     * Turns automatic shrinking on or off. While on, removing
+     * elements halves the capacity whenever the size falls
+     * below a quarter of it (never below initialCapacity).
+     * Growth doubles at full and shrinking waits for a quarter,
+     * so alternating adds and removes never thrash. Off by default;
+     * copies, moves, and assignments take the setting of their source.
+     */
+    BII_CONSTEXPR Vector<T>& autoShrink(const bool enabled);
 
     /**
      * Enlarges the vector by a given length on top
@@ -254,36 +449,36 @@ public:
      * Throws an error if the length is less than or
      * equal to 0 
      */
-    void reserve(const size_t length);
+    BII_CONSTEXPR void reserve(const size_t length);
 
     /**
      * Reduces the capacity of the current vector to
-     * match its size
+     * match its size. Does nothing if they already match.
      */
-    void reduce();
+    BII_CONSTEXPR void reduce();
     
     // Operators –––––––––––––––––––––––––––––––––––––––––––––
     /**
      * Returns a reference to the value at a given index
      */
-    T& operator[](const size_t index);
+    BII_CONSTEXPR T& operator[](const size_t index);
 
     /**
      * Returns a the value at a given index
      */
-    const T& operator[](const size_t index) const;
+    BII_CONSTEXPR const T& operator[](const size_t index) const;
 
     /**
      * Adds an lvalue element to the back of the vector
      * O(1) runtime speed
      */ 
-    Vector<T>& operator+=(const T& value);
+    BII_CONSTEXPR Vector<T>& operator+=(const T& value);
 
     /**
      * Adds an rvalue element to the back of the vector
      * O(1) runtime speed
      */ 
-    Vector<T>& operator+=(T&& value);
+    BII_CONSTEXPR Vector<T>& operator+=(T&& value);
 
     /**
      * Adds the elements of the other vector to the back
@@ -291,58 +486,107 @@ public:
      * O(n) runtime speed where n is the size of the other
      * vector
      */ 
-    Vector<T>& operator+=(const Vector<T>& other);
+    BII_CONSTEXPR Vector<T>& operator+=(const Vector<T>& other);
 
     /**
      * Copy Assignment
      */
-    Vector<T>& operator=(const Vector<T>& assign);
+    BII_CONSTEXPR Vector<T>& operator=(const Vector<T>& assign);
 
     /**
      * Move Assignment
      */
-    Vector<T>& operator=(Vector<T>&& assign);
+    BII_CONSTEXPR Vector<T>& operator=(Vector<T>&& assign);
     
     // Iterators –––––––––––––––––––––––––––––––––––––––––––––
     /**
      * Iterator with initial position at front of the vector
      */
-    iterator begin();
+    BII_CONSTEXPR iterator begin();
 
     /**
      * Iterator with initial position at back of the vector
      */
-    iterator end();
+    BII_CONSTEXPR iterator end();
 
     /**
      * Const iterator with initial position at front of the vector
      */
-    const_iterator begin() const;
+    BII_CONSTEXPR const_iterator begin() const;
 
     /**
      * Const iterator with initial position at back of the vector
      */
-    const_iterator end() const;
+    BII_CONSTEXPR const_iterator end() const;
 
     /**
-     * Reverse iterator with initial position at back of the vector
+     * Const iterator with initial position at front of the vector
+     */
+    BII_CONSTEXPR const_iterator cbegin() const;
+
+    /**
+     * Const iterator with initial position at back of the vector
      */
-    iterator rbegin();
+    BII_CONSTEXPR const_iterator cend() const;
 
     /**
-     * Reverse iterator with initial position at front of the vector
+     * Reverse iterator with initial position at the last element
      */
-    iterator rend();
+    BII_CONSTEXPR reverse_iterator rbegin();
 
     /**
-     * Const reverse iterator with initial position at back of the vector
+     * Reverse iterator with position before the first element
      */
-    const_iterator rbegin() const;
+    BII_CONSTEXPR reverse_iterator rend();
 
     /**
-     * Const reverse iterator with initial position at front of the vector
+     * Const reverse iterator with initial position at the last element
      */
-    const_iterator rend() const;
+    BII_CONSTEXPR const_reverse_iterator rbegin() const;
+
+    /**
+     * Const reverse iterator with position before the first element
+     */
+    BII_CONSTEXPR const_reverse_iterator rend() const;
+
+    /**
+     * Const reverse iterator with initial position at the last element
+     */
+    BII_CONSTEXPR const_reverse_iterator crbegin() const;
+
+    /**
+     * Const reverse iterator with position before the first element
+     */
+    BII_CONSTEXPR const_reverse_iterator crend() const;
+
+#ifdef BII_STATS
+    // Instrumentation –––––––––––––––––––––––––––––––––––––––
+    /**
+     * Returns the allocation and growth counters of this vector
+     */
+    const container_stats& stats() const;
+
+    /**
+     * Prints the counters of this vector
+     */
+    void dumpStats(std::ostream& out) const;
+
+    /**
+     * Returns the counters aggregated over every vector
+     */
+    static container_stats globalStats();
+
+    /**
+     * Prints the counters aggregated over every vector, and the
+     * calling thread's buffer cache counters when the cache is on
+     */
+    static void dumpGlobalStats(std::ostream& out);
+
+    /**
+     * Sets the aggregated counters back to zero
+     */
+    static void resetGlobalStats();
+#endif
     
     // Friends –––––––––––––––––––––––––––––––––––––––––––––––
     /**
@@ -351,7 +595,7 @@ public:
      * O(n) runtime speed
      */
     template <typename T_>
-    friend bool operator==(const Vector<T_>& first, const Vector<T_>& second);
+    friend BII_CONSTEXPR bool operator==(const Vector<T_>& first, const Vector<T_>& second);
 
     /**
      * Given two vectors, returns true if they don't have the same elements
@@ -359,7 +603,7 @@ public:
      * O(n) runtime speed
      */
     template <typename T_>
-    friend bool operator!=(const Vector<T_>& first, const Vector<T_>& second);
+    friend BII_CONSTEXPR bool operator!=(const Vector<T_>& first, const Vector<T_>& second);
 
     /**
      * Given an output stream and a vector, prints the elements of the vector
@@ -377,7 +621,6 @@ public:
     
     // Functions to Implement ––––––––––––––––––––––––––––––––
     // void operator{}(const T& elements);
-    // Vector{const T& element};
 
 private:
     /* the underlying array */
@@ -389,24 +632,56 @@ private:
     /* the maximum capacity of the current vector */
     int _capacity;
 
+    /* true if removals shrink sparse arrays */
+    bool _autoShrink = false;
+
+#ifdef BII_STATS
+    /* allocation and growth counters */
+    stats_recorder _stats = stats_recorder(vectorGlobalStats());
+#endif
+
+    /**
+     * Destroys the elements built so far and frees the array
+     * unless released, so a constructor that throws partway
+     * through filling its array cannot leak it
+     */
+    struct constructionGuard {
+        Vector<T>* building;
+
+        BII_CONSTEXPR explicit constructionGuard(Vector<T>* vector) : building(vector) { }
+
+        BII_CONSTEXPR void release() {
+            building = nullptr;
+        }
+
+        BII_CONSTEXPR ~constructionGuard() {
+            if (building != nullptr) {
+                Storage<T>::destroy(building->_elements, building->_elements + building->_size);
+                Storage<T>::deallocate(building->_elements, building->_capacity);
+            }
+        }
+    };
+
     /** 
-     * Enlarges the size of the underlying array by the 
-     * given amount
+     * Moves the elements into a new underlying array with
+     * room for the given number of elements
      */
-    void expand(int amount);
-};
+    BII_CONSTEXPR void expand(int amount);
 
+    /**
+     * Doubles the capacity, starting from initialCapacity
+     * if the vector holds no array
+     */
+    BII_CONSTEXPR void grow();
 
-/**
- * Exception handler for attempts to access
- * an empty vector
- */
-struct empty_vector : public std::exception {
-    const char * what () const throw () {
-        return "Trying to access an empty vector";
-    }
+    /**
+     * Halves the capacity if auto-shrinking is on and
+     * the size has fallen below a quarter of it
+     */
+    BII_CONSTEXPR void shrinkIfSparse();
 };
 
+
 /**
  * Exception handler for reserving invalid
  * amounts of memory